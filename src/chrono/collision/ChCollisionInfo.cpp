@@ -27,7 +27,9 @@ ChCollisionInfo::ChCollisionInfo()
       vN(ChVector<>(1, 0, 0)),
       distance(0),
       eff_radius(default_eff_radius),
-      reaction_cache(nullptr) {}
+      reaction_cache(nullptr),
+      featureA(-1),
+      featureB(-1) {}
 
 ChCollisionInfo::ChCollisionInfo(const ChCollisionInfo& other, const bool swap) {
     if (!swap) {
@@ -38,6 +40,8 @@ ChCollisionInfo::ChCollisionInfo(const ChCollisionInfo& other, const bool swap)
         vpA = other.vpA;
         vpB = other.vpB;
         vN = other.vN;
+        featureA = other.featureA;
+        featureB = other.featureB;
     } else {
         // copy by swapping models
         modelA = other.modelB;
@@ -47,6 +51,8 @@ ChCollisionInfo::ChCollisionInfo(const ChCollisionInfo& other, const bool swap)
         vpA = other.vpB;
         vpB = other.vpA;
         vN = -other.vN;
+        featureA = other.featureB;
+        featureB = other.featureA;
     }
     distance = other.distance;
     eff_radius = other.eff_radius;
@@ -63,6 +69,9 @@ void ChCollisionInfo::SwapModels() {
     vpA = vpB;
     vpB = vtemp;
     vN = Vmul(vN, -1.0);
+    int ftemp = featureA;
+    featureA = featureB;
+    featureB = ftemp;
 }
 
 void ChCollisionInfo::SetDefaultEffectiveCurvatureRadius(double radius) {
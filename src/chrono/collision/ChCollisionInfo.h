@@ -36,6 +36,8 @@ class ChApi ChCollisionInfo {
     double distance;           ///< distance (negative for penetration)
     double eff_radius;         ///< effective radius of curvature at contact (SMC only)
     float* reaction_cache;     ///< pointer to some persistent user cache of reactions
+    int featureA;              ///< narrowphase feature on A (e.g. child shape, triangle, or point index), -1 if unknown
+    int featureB;              ///< narrowphase feature on B (e.g. child shape, triangle, or point index), -1 if unknown
 
     /// Basic default constructor.
     ChCollisionInfo();
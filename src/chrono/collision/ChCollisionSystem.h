@@ -15,6 +15,8 @@
 #ifndef CH_COLLISIONSYSTEM_H
 #define CH_COLLISIONSYSTEM_H
 
+#include <vector>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/core/ChApiCE.h"
@@ -168,6 +170,23 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const = 0;
 
+    /// Perform ray-hit tests with the collision models for a batch of rays, from 'from[i]' to 'to[i]'.
+    /// On return, 'results' has one entry per ray. Return the number of rays that hit a collision model.
+    /// The default implementation tests one ray at a time. Derived classes may override this function to process
+    /// the rays in parallel or to test coherent rays (e.g., parallel rays cast from neighboring points) together.
+    virtual int RayHit(const std::vector<ChVector<>>& from,
+                       const std::vector<ChVector<>>& to,
+                       std::vector<ChRayhitResult>& results) const {
+        assert(from.size() == to.size());
+        results.resize(from.size());
+        int num_hits = 0;
+        for (size_t i = 0; i < from.size(); i++) {
+            if (RayHit(from[i], to[i], results[i]))
+                num_hits++;
+        }
+        return num_hits;
+    }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) {
         // version number
@@ -238,6 +238,8 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
 
                     icontact.shapeA = icontact.modelA->GetShape(indexA).get();
                     icontact.shapeB = icontact.modelB->GetShape(indexB).get();
+                    icontact.featureA = pt.m_index0;
+                    icontact.featureB = pt.m_index1;
 
                     // Execute some user custom callback, if any
                     bool add_contact = true;
@@ -368,6 +370,24 @@ bool ChCollisionSystemBullet::RayHit(const ChVector<>& from,
     return true;
 }
 
+int ChCollisionSystemBullet::RayHit(const std::vector<ChVector<>>& from,
+                                    const std::vector<ChVector<>>& to,
+                                    std::vector<ChRayhitResult>& results) const {
+    assert(from.size() == to.size());
+    int num_rays = (int)from.size();
+    results.resize(num_rays);
+
+    // Bullet ray queries are thread-safe (each query uses its own traversal stack of the broadphase tree).
+    int num_hits = 0;
+#pragma omp parallel for reduction(+ : num_hits)
+    for (int i = 0; i < num_rays; i++) {
+        if (RayHit(from[i], to[i], results[i], btBroadphaseProxy::DefaultFilter, btBroadphaseProxy::AllFilter))
+            num_hits++;
+    }
+
+    return num_hits;
+}
+
 void ChCollisionSystemBullet::SetContactBreakingThreshold(double threshold) {
     gContactBreakingThreshold = (btScalar)threshold;
 }
@@ -97,6 +97,12 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models for a batch of rays.
+    /// The rays are tested in parallel, each against the Bullet broadphase tree.
+    virtual int RayHit(const std::vector<ChVector<>>& from,
+                       const std::vector<ChVector<>>& to,
+                       std::vector<ChRayhitResult>& results) const override;
+
     // Get the underlying Bullet collision world.
     btCollisionWorld* GetBulletCollisionWorld() { return bt_collision_world; }
 
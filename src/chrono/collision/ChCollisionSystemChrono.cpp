@@ -19,7 +19,6 @@
 
 #include "chrono/physics/ChSystem.h"
 #include "chrono/collision/ChCollisionSystemChrono.h"
-#include "chrono/collision/chrono/ChRayTest.h"
 
 namespace chrono {
 namespace collision {
@@ -56,10 +55,22 @@ void ChCollisionSystemChrono::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemChrono::EnableIncrementalBroadphase(bool val) {
+    broadphase.SetIncremental(val);
+}
+
+void ChCollisionSystemChrono::EnableHybridBroadphase(bool val, int max_bins) {
+    broadphase.SetHybrid(val, (uint)max_bins);
+}
+
 void ChCollisionSystemChrono::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
 }
 
+void ChCollisionSystemChrono::EnableBatchedNarrowphase(bool val) {
+    narrowphase.SetBatched(val);
+}
+
 void ChCollisionSystemChrono::EnableActiveBoundingBox(const ChVector<>& aabb_min, const ChVector<>& aabb_max) {
     active_aabb_min = FromChVector(aabb_min);
     active_aabb_max = FromChVector(aabb_max);
@@ -348,7 +359,11 @@ void ChCollisionSystemChrono::PostProcess() {
 
 void ChCollisionSystemChrono::Run() {
     ResetTimers();
+    RunBroadphase();
+    RunNarrowphase();
+}
 
+void ChCollisionSystemChrono::RunBroadphase() {
     if (use_aabb_active) {
         std::vector<char>& active = *cd_data->state_data.active_rigid;
         const std::vector<char>& collide = *cd_data->state_data.collide_rigid;
@@ -371,7 +386,9 @@ void ChCollisionSystemChrono::Run() {
     GenerateAABB();
     broadphase.Process();
     m_timer_broad.stop();
+}
 
+void ChCollisionSystemChrono::RunNarrowphase() {
     // Narrowphase
     m_timer_narrow.start();
     narrowphase.Process();
@@ -394,6 +411,7 @@ void ChCollisionSystemChrono::ReportContacts(ChContactContainer* container) {
 
     // Loop over all current contacts, create the cinfo structure and add contact to the container.
     // Note that inclusions in the contact container cannot be done in parallel.
+    int feature = 0;
     for (uint i = 0; i < cd_data->num_rigid_contacts; i++) {
         auto b1 = bids[i].x;                  // global IDs of bodies in contact
         auto b2 = bids[i].y;                  //
@@ -413,6 +431,13 @@ void ChCollisionSystemChrono::ReportContacts(ChContactContainer* container) {
         cinfo.distance = cd_data->dpth_rigid_rigid[i];
         cinfo.eff_radius = cd_data->erad_rigid_rigid[i];
 
+        // The contacts between a pair of shapes are consecutive, in the order generated by the narrowphase. Use the
+        // index of the contact within its shape pair as narrowphase feature, so that the points of a multi-contact
+        // pair (e.g. box-box) are identified separately.
+        feature = (i > 0 && sids[i] == sids[i - 1]) ? feature + 1 : 0;
+        cinfo.featureA = feature;
+        cinfo.featureB = feature;
+
         // Execute user custom callback, if any
         bool add_contact = true;
         if (this->narrow_callback)
@@ -633,21 +658,10 @@ bool ChCollisionSystemChrono::RayHit(const ChVector<>& from, const ChVector<>& t
         return false;
     }
 
-    ChRayTest tester(cd_data);
+    ChRayTest tester(cd_data, broadphase.GetTree());
     ChRayTest::RayHitInfo info;
     if (tester.Check(FromChVector(from), FromChVector(to), info)) {
-        // Hit point
-        result.hit = true;
-        result.abs_hitNormal = ToChVector(info.normal);
-        result.abs_hitPoint = ToChVector(info.point);
-        result.dist_factor = info.t;
-
-        // ID of the body carring the closest hit shape
-        uint bid = cd_data->shape_data.id_rigid[info.shapeID];
-
-        // Collision model of hit body
-        result.hitModel = m_system->Get_bodylist()[bid]->GetCollisionModel().get();
-
+        SetRayhitResult(info, result);
         return true;
     }
 
@@ -659,8 +673,77 @@ bool ChCollisionSystemChrono::RayHit(const ChVector<>& from,
                                      const ChVector<>& to,
                                      ChCollisionModel* model,
                                      ChRayhitResult& result) const {
+    result.hit = false;
+
+    // Collect the shapes of the specified collision model
+    auto body = static_cast<ChCollisionModelChrono*>(model)->GetBody();
+    if (!body)
+        return false;
+    uint body_id = body->GetId();
+    const auto& id_rigid = cd_data->shape_data.id_rigid;
+    std::vector<uint> shapes;
+    for (uint i = 0; i < (uint)id_rigid.size(); i++) {
+        if (id_rigid[i] == body_id)
+            shapes.push_back(i);
+    }
+    if (shapes.empty())
+        return false;
+
+    ChRayTest tester(cd_data);
+    ChRayTest::RayHitInfo info;
+    if (tester.Check(FromChVector(from), FromChVector(to), shapes, info)) {
+        SetRayhitResult(info, result);
+        return true;
+    }
+
     return false;
 }
 
+int ChCollisionSystemChrono::RayHit(const std::vector<ChVector<>>& from,
+                                    const std::vector<ChVector<>>& to,
+                                    std::vector<ChRayhitResult>& results) const {
+    assert(from.size() == to.size());
+    int num_rays = (int)from.size();
+    results.resize(num_rays);
+    for (auto& result : results)
+        result.hit = false;
+
+    if (cd_data->num_active_bins == 0)
+        return 0;
+
+    std::vector<real3> start(num_rays);
+    std::vector<real3> end(num_rays);
+    for (int i = 0; i < num_rays; i++) {
+        start[i] = FromChVector(from[i]);
+        end[i] = FromChVector(to[i]);
+    }
+
+    ChRayTest tester(cd_data);
+    std::vector<ChRayTest::RayHitInfo> info;
+    std::vector<char> hit;
+    uint num_hits = tester.Check(start, end, info, hit);
+
+    for (int i = 0; i < num_rays; i++) {
+        if (hit[i])
+            SetRayhitResult(info[i], results[i]);
+    }
+
+    return (int)num_hits;
+}
+
+void ChCollisionSystemChrono::SetRayhitResult(const ChRayTest::RayHitInfo& info, ChRayhitResult& result) const {
+    // Hit point
+    result.hit = true;
+    result.abs_hitNormal = ToChVector(info.normal);
+    result.abs_hitPoint = ToChVector(info.point);
+    result.dist_factor = info.t;
+
+    // ID of the body carring the closest hit shape
+    uint bid = cd_data->shape_data.id_rigid[info.shapeID];
+
+    // Collision model of hit body
+    result.hitModel = m_system->Get_bodylist()[bid]->GetCollisionModel().get();
+}
+
 }  // end namespace collision
 }  // end namespace chrono
@@ -27,6 +27,7 @@
 #include "chrono/collision/chrono/ChCollisionData.h"
 #include "chrono/collision/chrono/ChBroadphase.h"
 #include "chrono/collision/chrono/ChNarrowphase.h"
+#include "chrono/collision/chrono/ChRayTest.h"
 
 #include "chrono/multicore_math/ChMulticoreMath.h"
 
@@ -67,12 +68,28 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Enable/disable the incremental broadphase (default: false).
+    /// Recommended for scenes where most shapes do not move from one step to the next (e.g. shapes on fixed or
+    /// sleeping bodies). See ChBroadphase::SetIncremental.
+    void EnableIncrementalBroadphase(bool val);
+
+    /// Enable/disable the hybrid grid / AABB-tree broadphase (default: false).
+    /// Recommended for scenes with widely varying shape sizes (e.g. a large terrain mesh or a long conveyor next to many
+    /// small grains). Shapes overlapping more than `max_bins` grid bins are stored in an AABB tree instead of the grid.
+    /// See ChBroadphase::SetHybrid.
+    void EnableHybridBroadphase(bool val, int max_bins = 64);
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     void SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm);
 
+    /// Enable/disable the batched narrowphase (default: false).
+    /// Recommended for scenes dominated by sphere-sphere, box-sphere, and box-box interactions (e.g. granular material
+    /// in a container). Only used with the PRIMS and HYBRID narrowphase algorithms. See ChNarrowphase::SetBatched.
+    void EnableBatchedNarrowphase(bool val);
+
     /// Enable monitoring of shapes outside active bounding box (default: false).
     /// If enabled, objects whose collision shapes exit the active bounding box are deactivated (frozen).
     /// The size of the bounding box is specified by its min and max extents.
@@ -118,6 +135,13 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// Return the time (in seconds) for narrowphase collision detection.
     virtual double GetTimerCollisionNarrow() const override;
 
+    /// Return the time (in seconds) spent in the broadphase on the static part of the scene.
+    /// Always 0 if the incremental broadphase is not enabled.
+    double GetTimerCollisionBroadStatic() const { return broadphase.GetTimerStatic(); }
+
+    /// Return the time (in seconds) spent in the broadphase on the moving part of the scene.
+    double GetTimerCollisionBroadMoving() const { return broadphase.GetTimerMoving(); }
+
     /// Fill in the provided contact container with collision information after Run().
     virtual void ReportContacts(ChContactContainer* container) override;
 
@@ -126,16 +150,21 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     virtual void ReportProximities(ChProximityContainer* mproximitycontainer) override {}
 
     /// Perform a ray-hit test with all collision models.
-    /// Currently not implemented.
     virtual bool RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& result) const override;
 
     /// Perform a ray-hit test with the specified collision model.
-    /// Currently not implemented.
     virtual bool RayHit(const ChVector<>& from,
                         const ChVector<>& to,
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models for a batch of rays.
+    /// The rays are processed in packets of consecutive rays traversing a bounding volume hierarchy over the collision
+    /// shapes (see ChRayTest). For best performance, neighboring rays in the input lists should be coherent.
+    virtual int RayHit(const std::vector<ChVector<>>& from,
+                       const std::vector<ChVector<>>& to,
+                       std::vector<ChRayhitResult>& results) const override;
+
     /// Return the pairs of IDs for overlapping contact shapes.
     virtual std::vector<vec2> GetOverlappingPairs();
 
@@ -146,6 +175,15 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// Generate the current axis-aligned bounding boxes of collision shapes.
     void GenerateAABB();
 
+    /// Run the broadphase (including the update of the active bodies and of the shape AABBs).
+    void RunBroadphase();
+
+    /// Run the narrowphase on the candidate pairs produced by the broadphase.
+    void RunNarrowphase();
+
+    /// Fill a ray-hit result from the information on the closest hit shape.
+    void SetRayhitResult(const ChRayTest::RayHitInfo& info, ChRayhitResult& result) const;
+
     std::shared_ptr<ChCollisionData> cd_data;
 
     collision::ChBroadphase broadphase;    ///< methods for broad-phase collision detection
@@ -0,0 +1,149 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/collision/chrono/ChAABBTree.h"
+
+namespace chrono {
+namespace collision {
+
+void ChAABBTree::Clear() {
+    m_shapes.clear();
+    m_items.clear();
+    m_item_min.clear();
+    m_item_max.clear();
+    m_nodes.clear();
+    m_depth.clear();
+    m_level_start.clear();
+    m_level_nodes.clear();
+}
+
+void ChAABBTree::Build(const std::vector<uint>& shapes,
+                       const std::vector<real3>& aabb_min,
+                       const std::vector<real3>& aabb_max) {
+    Clear();
+    if (shapes.empty())
+        return;
+
+    m_shapes = shapes;
+    m_items = shapes;
+    m_nodes.reserve(2 * shapes.size());
+    m_depth.reserve(2 * shapes.size());
+
+    m_nodes.push_back(Node());
+    m_depth.push_back(0);
+    BuildNode(0, 0, (uint)m_items.size(), 0, aabb_min, aabb_max);
+
+    // Group the nodes by depth (used in the level-by-level refit)
+    uint num_levels = *std::max_element(m_depth.begin(), m_depth.end()) + 1;
+    m_level_start.assign(num_levels + 1, 0);
+    for (auto d : m_depth)
+        m_level_start[d + 1]++;
+    for (uint l = 0; l < num_levels; l++)
+        m_level_start[l + 1] += m_level_start[l];
+    m_level_nodes.resize(m_nodes.size());
+    std::vector<uint> fill(m_level_start.begin(), m_level_start.end() - 1);
+    for (uint n = 0; n < (uint)m_nodes.size(); n++)
+        m_level_nodes[fill[m_depth[n]]++] = n;
+
+    Refit(aabb_min, aabb_max);
+}
+
+void ChAABBTree::BuildNode(uint node,
+                           uint start,
+                           uint count,
+                           uint depth,
+                           const std::vector<real3>& aabb_min,
+                           const std::vector<real3>& aabb_max) {
+    m_nodes[node].start = start;
+    m_nodes[node].count = count;
+    m_nodes[node].left = 0;
+
+    // The traversal stack in Query holds at most one pending node per level
+    if (count <= leaf_size || depth + 2 >= (uint)max_depth)
+        return;
+
+    // Split at the median of the AABB centers along the longest axis of the bounding box of the centers
+    real3 cmin(C_REAL_MAX);
+    real3 cmax(-C_REAL_MAX);
+    for (uint i = start; i < start + count; i++) {
+        real3 c = aabb_min[m_items[i]] + aabb_max[m_items[i]];
+        cmin = Min(cmin, c);
+        cmax = Max(cmax, c);
+    }
+    real3 extent = cmax - cmin;
+    int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z ? 1 : 2);
+
+    uint half = count / 2;
+    std::nth_element(m_items.begin() + start, m_items.begin() + start + half, m_items.begin() + start + count,
+                     [&](uint a, uint b) {
+                         return aabb_min[a][axis] + aabb_max[a][axis] < aabb_min[b][axis] + aabb_max[b][axis];
+                     });
+
+    // Children are always allocated in consecutive pairs
+    uint left = (uint)m_nodes.size();
+    m_nodes[node].left = left;
+    m_nodes[node].count = 0;
+    m_nodes.push_back(Node());
+    m_nodes.push_back(Node());
+    m_depth.push_back(depth + 1);
+    m_depth.push_back(depth + 1);
+
+    BuildNode(left, start, half, depth + 1, aabb_min, aabb_max);
+    BuildNode(left + 1, start + half, count - half, depth + 1, aabb_min, aabb_max);
+}
+
+void ChAABBTree::Refit(const std::vector<real3>& aabb_min, const std::vector<real3>& aabb_max) {
+    int num_items = (int)m_items.size();
+    if (num_items == 0)
+        return;
+
+    m_item_min.resize(num_items);
+    m_item_max.resize(num_items);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_items; i++) {
+        m_item_min[i] = aabb_min[m_items[i]];
+        m_item_max[i] = aabb_max[m_items[i]];
+    }
+
+    // Process the levels from the leaves up; all nodes in a level are independent
+    for (int l = (int)m_level_start.size() - 2; l >= 0; l--) {
+        int begin = (int)m_level_start[l];
+        int end = (int)m_level_start[l + 1];
+#pragma omp parallel for
+        for (int k = begin; k < end; k++) {
+            Node& node = m_nodes[m_level_nodes[k]];
+            if (node.count > 0) {
+                real3 bmin = m_item_min[node.start];
+                real3 bmax = m_item_max[node.start];
+                for (uint i = node.start + 1; i < node.start + node.count; i++) {
+                    bmin = Min(bmin, m_item_min[i]);
+                    bmax = Max(bmax, m_item_max[i]);
+                }
+                node.bmin = bmin;
+                node.bmax = bmax;
+            } else {
+                const Node& left = m_nodes[node.left];
+                const Node& right = m_nodes[node.left + 1];
+                node.bmin = Min(left.bmin, right.bmin);
+                node.bmax = Max(left.bmax, right.bmax);
+            }
+        }
+    }
+}
+
+}  // end namespace collision
+}  // end namespace chrono
@@ -0,0 +1,119 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Description: AABB tree (bounding volume hierarchy) over a set of collision
+// shapes, used by the hybrid broadphase
+//
+// =============================================================================
+
+#pragma once
+
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/collision/chrono/ChCollisionUtils.h"
+
+namespace chrono {
+namespace collision {
+
+/// @addtogroup collision_mc
+/// @{
+
+/// Bounding volume hierarchy of axis-aligned bounding boxes over a subset of the collision shapes.
+/// The tree is built top-down, splitting the shapes at the median of their AABB centers along the longest axis of the
+/// node box, so that its depth is logarithmic in the number of shapes. Once built, the node boxes can be updated for
+/// new shape AABBs without changing the tree topology (Refit); the nodes of each tree level are refitted in parallel,
+/// from the leaves up.
+class ChApi ChAABBTree {
+  public:
+    ChAABBTree() {}
+
+    /// Build the tree over the specified shapes, using their current AABBs.
+    void Build(const std::vector<uint>& shapes, const std::vector<real3>& aabb_min, const std::vector<real3>& aabb_max);
+
+    /// Update all node boxes for the current shape AABBs, keeping the tree topology.
+    void Refit(const std::vector<real3>& aabb_min, const std::vector<real3>& aabb_max);
+
+    /// Remove all shapes from the tree.
+    void Clear();
+
+    /// Return the list of shapes in the tree (in the order provided to Build).
+    const std::vector<uint>& GetShapes() const { return m_shapes; }
+
+    /// Return the number of nodes in the tree.
+    size_t GetNumNodes() const { return m_nodes.size(); }
+
+    /// Invoke the function f(shape) for each shape in the tree whose AABB overlaps the specified box.
+    template <typename F>
+    void Query(const real3& bmin, const real3& bmax, F f) const;
+
+  private:
+    /// Tree node. For a leaf, the node shapes are items[start, start + count). For an internal node, count = 0 and
+    /// the two children are left and left + 1.
+    struct Node {
+        real3 bmin;
+        real3 bmax;
+        uint left;
+        uint start;
+        uint count;
+    };
+
+    static const uint leaf_size = 4;  ///< maximum number of shapes in a leaf
+    static const int max_depth = 64;  ///< size of the traversal stack
+
+    void BuildNode(uint node,
+                   uint start,
+                   uint count,
+                   uint depth,
+                   const std::vector<real3>& aabb_min,
+                   const std::vector<real3>& aabb_max);
+
+    std::vector<uint> m_shapes;       ///< shapes in the tree
+    std::vector<uint> m_items;        ///< shape IDs, ordered by leaf
+    std::vector<real3> m_item_min;    ///< shape AABBs, ordered by leaf (lower corners)
+    std::vector<real3> m_item_max;    ///< shape AABBs, ordered by leaf (upper corners)
+    std::vector<Node> m_nodes;        ///< tree nodes (root at index 0)
+    std::vector<uint> m_depth;        ///< depth of each node
+    std::vector<uint> m_level_start;  ///< start of each level in m_level_nodes
+    std::vector<uint> m_level_nodes;  ///< node indices, grouped by depth
+};
+
+template <typename F>
+void ChAABBTree::Query(const real3& bmin, const real3& bmax, F f) const {
+    if (m_nodes.empty())
+        return;
+
+    uint stack[max_depth];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const Node& node = m_nodes[stack[--top]];
+        if (!ch_utils::overlap(bmin, bmax, node.bmin, node.bmax))
+            continue;
+        if (node.count > 0) {
+            for (uint i = node.start; i < node.start + node.count; i++) {
+                if (ch_utils::overlap(bmin, bmax, m_item_min[i], m_item_max[i]))
+                    f(m_items[i]);
+            }
+        } else {
+            stack[top++] = node.left;
+            stack[top++] = node.left + 1;
+        }
+    }
+}
+
+/// @} collision_mc
+
+}  // end namespace collision
+}  // end namespace chrono
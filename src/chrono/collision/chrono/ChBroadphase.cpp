@@ -39,7 +39,23 @@ ChBroadphase::ChBroadphase()
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
-      cd_data(nullptr) {}
+      cd_data(nullptr),
+      incremental(false),
+      inc_valid(false),
+      num_moving_shapes(0),
+      hybrid(false),
+      hybrid_max_bins(64) {}
+
+void ChBroadphase::SetIncremental(bool val) {
+    incremental = val;
+    inc_valid = false;
+}
+
+void ChBroadphase::SetHybrid(bool val, uint max_bins) {
+    hybrid = val;
+    hybrid_max_bins = max_bins;
+    inc_valid = false;
+}
 
 // -----------------------------------------------------------------------------
 
@@ -211,16 +227,51 @@ void ChBroadphase::ComputeTopLevelResolution() {
 
 // Use spatial subdivision to detect the list of POSSIBLE collisions
 void ChBroadphase::Process() {
-    // Compute overall AABB and then offset all AABBs
+    m_timer_static.reset();
+    m_timer_moving.reset();
+
+    // Compute overall AABB
     DetermineBoundingBox();
+
+    // In incremental mode, keep the current grid if possible. Otherwise, create a grid with a margin around the
+    // overall AABB, so that it can be reused as long as shapes remain inside it.
+    bool use_incremental = incremental && !hybrid;
+    bool reuse_grid = use_incremental && CanReuseGrid();
+    if (reuse_grid) {
+        cd_data->min_bounding_point = inc_min_point;
+        cd_data->max_bounding_point = inc_max_point;
+        cd_data->global_origin = inc_min_point;
+    } else if (use_incremental) {
+        real3 margin = real(0.1) * (cd_data->max_bounding_point - cd_data->min_bounding_point);
+        cd_data->min_bounding_point = cd_data->min_bounding_point - margin;
+        cd_data->max_bounding_point = cd_data->max_bounding_point + margin;
+        cd_data->global_origin = cd_data->min_bounding_point;
+    }
+
+    // Offset all AABBs
     OffsetAABB();
 
     // Determine resolution of the top level grid
-    ComputeTopLevelResolution();
+    if (!reuse_grid)
+        ComputeTopLevelResolution();
 
     if (cd_data->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        if (reuse_grid) {
+            IncrementalBroadphase();
+        } else {
+            m_timer_moving.start();
+            OneLevelBroadphase();
+            if (hybrid)
+                TreeBroadphase();
+            m_timer_moving.stop();
+            num_moving_shapes = cd_data->num_rigid_shapes;
+            if (use_incremental)
+                StoreIncrementalState();
+        }
         cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
+    } else {
+        inc_valid = false;
+        cd_data->tree_shapes.clear();
     }
     return;
 }
@@ -240,7 +291,6 @@ void ChBroadphase::OneLevelBroadphase() {
     std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
     std::vector<uint>& bin_active = cd_data->bin_active;
     std::vector<uint>& bin_start_index = cd_data->bin_start_index;
-    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
     std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
 
     const int num_shapes = cd_data->num_rigid_shapes;
@@ -267,19 +317,34 @@ void ChBroadphase::OneLevelBroadphase() {
         f_Count_AABB_BIN_Intersection(i, inv_bin_size, aabb_min, aabb_max, bin_intersections);
     }
 
+    // In hybrid mode, shapes which overlap too many bins are not binned (they are stored in the AABB tree)
+    std::vector<uint>& tree_shapes = cd_data->tree_shapes;
+    tree_shapes.clear();
+    if (hybrid) {
+        shape_large.resize(num_shapes);
+#pragma omp parallel for
+        for (int i = 0; i < num_shapes; i++) {
+            shape_large[i] = bin_intersections[i] > hybrid_max_bins;
+            if (shape_large[i])
+                bin_intersections[i] = 0;
+        }
+        for (int i = 0; i < num_shapes; i++) {
+            if (shape_large[i])
+                tree_shapes.push_back(i);
+        }
+    }
+
     // Calculate total number of bin - shape AABB intersections
     Thrust_Exclusive_Scan(bin_intersections);
     num_bin_aabb_intersections = bin_intersections.back();
 
     bin_number.resize(num_bin_aabb_intersections);
     bin_aabb_number.resize(num_bin_aabb_intersections);
-    bin_active.resize(num_bin_aabb_intersections);       // will be resized after calculation of num_active_bins
-    bin_start_index.resize(num_bin_aabb_intersections);  // will be resized after calculation of num_active_bins
 
     // For each shape, store the bin index and the shape ID for intersections with this shape 
 #pragma omp parallel for
     for (int i = 0; i < num_shapes; i++) {
-        if (obj_data_id[i] == UINT_MAX)
+        if (obj_data_id[i] == UINT_MAX || (hybrid && shape_large[i]))
             continue;
         f_Store_AABB_BIN_Intersection(i, bins_per_axis, inv_bin_size, aabb_min, aabb_max, bin_intersections, bin_number,
                                       bin_aabb_number);
@@ -287,18 +352,13 @@ void ChBroadphase::OneLevelBroadphase() {
 
     // Find the number of active bins (i.e. with at least one shape AABB intersection)
     Thrust_Sort_By_Key(bin_number, bin_aabb_number);
-    num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
+    ActiveBins();
 
     if (num_active_bins <= 0) {
         num_possible_collisions = 0;
         return;
     }
 
-    bin_active.resize(num_active_bins);
-    bin_start_index.resize(num_active_bins + 1);
-    bin_start_index[num_active_bins] = 0;
-
-    Thrust_Exclusive_Scan(bin_start_index);
     bin_num_contact.resize(num_active_bins + 1);
     bin_num_contact[num_active_bins] = 0;
 
@@ -324,8 +384,393 @@ void ChBroadphase::OneLevelBroadphase() {
 
     pair_shapeIDs.resize(num_possible_collisions);
 
-    // For use in ray intersection tests, also create an "extended" vector of start indices that also includes bins with
-    // no shape AABB intersections. 
+    // For use in ray intersection tests, also create an "extended" vector of start indices
+    ExtendedBinIndex();
+}
+
+// -----------------------------------------------------------------------------
+
+// Check whether the pair (shapeA, shapeB), found in the AABB tree, is a candidate collision pair. Same filters as for
+// pairs found in the grid (AABB overlap is guaranteed by the tree query). Pairs of two tree shapes are reported only
+// from the shape with the lower index.
+static bool _TreePair(uint shapeA,
+                      uint shapeB,
+                      const std::vector<char>& shape_large,
+                      const std::vector<uint>& body_id,
+                      const std::vector<short2>& fam_data,
+                      const std::vector<char>& body_active,
+                      const std::vector<char>& body_collide) {
+    if (shapeA == shapeB)
+        return false;
+    if (shape_large[shapeA] && shapeB < shapeA)
+        return false;
+    uint bodyA = body_id[shapeA];
+    uint bodyB = body_id[shapeB];
+    if (bodyA == UINT_MAX || bodyB == UINT_MAX)
+        return false;
+    if (bodyA == bodyB)
+        return false;
+    if (body_collide[bodyA] == 0 || body_collide[bodyB] == 0)
+        return false;
+    if (!body_active[bodyA] && !body_active[bodyB])
+        return false;
+    return collide(fam_data[shapeA], fam_data[shapeB]);
+}
+
+// Find the candidate pairs involving at least one shape stored in the AABB tree (hybrid mode) and append them to the
+// list of candidate pairs found in the grid.
+void ChBroadphase::TreeBroadphase() {
+    const std::vector<uint>& tree_shapes = cd_data->tree_shapes;
+    if (tree_shapes.empty()) {
+        tree.Clear();
+        return;
+    }
+
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    // Rebuild the tree if the set of large shapes changed; otherwise only update its bounding boxes
+    if (tree.GetShapes() != tree_shapes)
+        tree.Build(tree_shapes, aabb_min, aabb_max);
+    else
+        tree.Refit(aabb_min, aabb_max);
+
+    // Count the tree pairs for each shape
+    tree_num_pairs.resize(num_shapes + 1);
+    tree_num_pairs[num_shapes] = 0;
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        uint count = 0;
+        if (obj_data_id[i] != UINT_MAX) {
+            tree.Query(aabb_min[i], aabb_max[i], [&](uint j) {
+                if (_TreePair(i, j, shape_large, obj_data_id, fam_data, obj_active, obj_collide))
+                    count++;
+            });
+        }
+        tree_num_pairs[i] = count;
+    }
+
+    Thrust_Exclusive_Scan(tree_num_pairs);
+    uint num_tree_pairs = tree_num_pairs.back();
+    if (num_tree_pairs == 0)
+        return;
+
+    // Append the tree pairs after the grid pairs
+    uint offset = num_possible_collisions;
+    pair_shapeIDs.resize(offset + num_tree_pairs);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        if (obj_data_id[i] == UINT_MAX)
+            continue;
+        uint index = offset + tree_num_pairs[i];
+        tree.Query(aabb_min[i], aabb_max[i], [&](uint j) {
+            if (_TreePair(i, j, shape_large, obj_data_id, fam_data, obj_active, obj_collide)) {
+                uint shapeA = std::min((uint)i, j);
+                uint shapeB = std::max((uint)i, j);
+                pair_shapeIDs[index++] = ((long long)shapeA << 32 | (long long)shapeB);
+            }
+        });
+    }
+
+    num_possible_collisions = offset + num_tree_pairs;
+}
+
+// -----------------------------------------------------------------------------
+
+// Check whether the current grid can be reused by the incremental broadphase.
+bool ChBroadphase::CanReuseGrid() const {
+    if (!inc_valid || inc_bin_min.size() != cd_data->num_rigid_shapes)
+        return false;
+
+    // Grid settings changed since the last grid rebuild
+    if (grid_type != inc_grid_type)
+        return false;
+    switch (grid_type) {
+        case GridType::FIXED_RESOLUTION:
+            if (grid_resolution.x != inc_grid_resolution.x || grid_resolution.y != inc_grid_resolution.y ||
+                grid_resolution.z != inc_grid_resolution.z)
+                return false;
+            break;
+        case GridType::FIXED_BIN_SIZE:
+            if (!(bin_size == inc_bin_size))
+                return false;
+            break;
+        case GridType::FIXED_DENSITY:
+            if (grid_density != inc_grid_density)
+                return false;
+            break;
+    }
+
+    // All shapes must be contained in the current grid
+    const real3& min_point = cd_data->min_bounding_point;
+    const real3& max_point = cd_data->max_bounding_point;
+    return min_point.x >= inc_min_point.x && min_point.y >= inc_min_point.y && min_point.z >= inc_min_point.z &&
+           max_point.x <= inc_max_point.x && max_point.y <= inc_max_point.y && max_point.z <= inc_max_point.z;
+}
+
+// Encode the state of a shape that affects its broadphase pairs (excluded shape, body active and collide flags).
+static char _ShapeFlags(uint body, const std::vector<char>& active, const std::vector<char>& collide) {
+    if (body == UINT_MAX)
+        return 0;
+    return 1 | (active[body] ? 2 : 0) | (collide[body] ? 4 : 0);
+}
+
+// Save the data needed for the next incremental pass, after a full grid rebuild.
+void ChBroadphase::StoreIncrementalState() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    inc_bin_min.resize(num_shapes);
+    inc_bin_max.resize(num_shapes);
+    inc_flags.resize(num_shapes);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        inc_bin_min[i] = HashMin(aabb_min[i], inv_bin_size);
+        inc_bin_max[i] = HashMax(aabb_max[i], inv_bin_size);
+        inc_flags[i] = _ShapeFlags(obj_data_id[i], obj_active, obj_collide);
+    }
+
+    inc_aabb_min = aabb_min;
+    inc_aabb_max = aabb_max;
+    inc_fam = fam_data;
+
+    inc_grid_type = grid_type;
+    inc_grid_resolution = grid_resolution;
+    inc_bin_size = bin_size;
+    inc_grid_density = grid_density;
+    inc_min_point = cd_data->min_bounding_point;
+    inc_max_point = cd_data->max_bounding_point;
+    inc_valid = true;
+}
+
+// Incremental broadphase pass on the current grid (see SetIncremental).
+void ChBroadphase::IncrementalBroadphase() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    std::vector<uint>& bin_active = cd_data->bin_active;
+    std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    uint& num_active_bins = cd_data->num_active_bins;
+    uint& num_bin_aabb_intersections = cd_data->num_bin_aabb_intersections;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    // Static part: classify shapes and keep the candidate pairs of static shapes
+    // --------------------------------------------------------------------------
+
+    m_timer_static.start();
+
+    shape_rebinned.resize(num_shapes);
+    shape_static.resize(num_shapes);
+
+    int num_rebinned = 0;
+    int num_moving = 0;
+
+#pragma omp parallel for reduction(+ : num_rebinned, num_moving)
+    for (int i = 0; i < num_shapes; i++) {
+        char flags = _ShapeFlags(obj_data_id[i], obj_active, obj_collide);
+        vec3 gmin = HashMin(aabb_min[i], inv_bin_size);
+        vec3 gmax = HashMax(aabb_max[i], inv_bin_size);
+
+        // A shape is re-binned if it overlaps a different set of bins or if it was included/excluded
+        bool rebinned = (flags & 1) != (inc_flags[i] & 1);
+        if (flags & 1) {
+            rebinned = rebinned || gmin.x != inc_bin_min[i].x || gmin.y != inc_bin_min[i].y ||
+                       gmin.z != inc_bin_min[i].z || gmax.x != inc_bin_max[i].x || gmax.y != inc_bin_max[i].y ||
+                       gmax.z != inc_bin_max[i].z;
+        }
+
+        // A shape is static if nothing that affects its candidate pairs has changed
+        bool is_static = !rebinned && flags == inc_flags[i] && aabb_min[i] == inc_aabb_min[i] &&
+                         aabb_max[i] == inc_aabb_max[i] && fam_data[i].x == inc_fam[i].x &&
+                         fam_data[i].y == inc_fam[i].y;
+
+        shape_rebinned[i] = rebinned;
+        shape_static[i] = is_static;
+        num_rebinned += rebinned;
+        num_moving += !is_static;
+
+        inc_bin_min[i] = gmin;
+        inc_bin_max[i] = gmax;
+        inc_flags[i] = flags;
+    }
+
+    num_moving_shapes = num_moving;
+
+    inc_aabb_min = aabb_min;
+    inc_aabb_max = aabb_max;
+    inc_fam = fam_data;
+
+    // Keep the candidate pairs of two static shapes (the result of their AABB-AABB test has not changed)
+    size_t num_static_pairs = 0;
+    for (size_t k = 0; k < num_possible_collisions; k++) {
+        long long pair = pair_shapeIDs[k];
+        if (shape_static[pair >> 32] && shape_static[pair & 0xffffffff])
+            pair_shapeIDs[num_static_pairs++] = pair;
+    }
+
+    m_timer_static.stop();
+
+    // Moving part: re-bin shapes and test candidate pairs involving at least one moving shape
+    // ----------------------------------------------------------------------------------------
+
+    m_timer_moving.start();
+
+    if (num_rebinned > 0) {
+        // Remove the bin intersections of re-binned shapes (this preserves the order by bin index)
+        size_t num_kept = 0;
+        for (size_t k = 0; k < bin_number.size(); k++) {
+            if (!shape_rebinned[bin_aabb_number[k]]) {
+                bin_number[num_kept] = bin_number[k];
+                bin_aabb_number[num_kept] = bin_aabb_number[k];
+                num_kept++;
+            }
+        }
+        bin_number.resize(num_kept);
+        bin_aabb_number.resize(num_kept);
+
+        // Collect and sort the bin intersections of re-binned shapes
+        new_bin_number.clear();
+        new_bin_aabb_number.clear();
+        for (int i = 0; i < num_shapes; i++) {
+            if (!shape_rebinned[i] || obj_data_id[i] == UINT_MAX)
+                continue;
+            const vec3& gmin = inc_bin_min[i];
+            const vec3& gmax = inc_bin_max[i];
+            for (int a = gmin.x; a <= gmax.x; a++) {
+                for (int b = gmin.y; b <= gmax.y; b++) {
+                    for (int c = gmin.z; c <= gmax.z; c++) {
+                        new_bin_number.push_back(Hash_Index(vec3(a, b, c), bins_per_axis));
+                        new_bin_aabb_number.push_back(i);
+                    }
+                }
+            }
+        }
+        Thrust_Sort_By_Key(new_bin_number, new_bin_aabb_number);
+
+        // Merge the two sorted lists of bin intersections
+        size_t num_new = new_bin_number.size();
+        bin_number.resize(num_kept + num_new);
+        bin_aabb_number.resize(num_kept + num_new);
+        size_t i = num_kept;
+        size_t j = num_new;
+        for (size_t k = num_kept + num_new; k > 0; k--) {
+            if (j == 0 || (i > 0 && bin_number[i - 1] > new_bin_number[j - 1])) {
+                bin_number[k - 1] = bin_number[i - 1];
+                bin_aabb_number[k - 1] = bin_aabb_number[i - 1];
+                i--;
+            } else {
+                bin_number[k - 1] = new_bin_number[j - 1];
+                bin_aabb_number[k - 1] = new_bin_aabb_number[j - 1];
+                j--;
+            }
+        }
+        num_bin_aabb_intersections = (uint)bin_number.size();
+
+        // Update the active bins
+        ActiveBins();
+        if (num_active_bins > 0)
+            ExtendedBinIndex();
+    }
+
+    if (num_active_bins <= 0) {
+        num_possible_collisions = 0;
+        pair_shapeIDs.clear();
+        m_timer_moving.stop();
+        return;
+    }
+
+    bin_num_contact.resize(num_active_bins + 1);
+    bin_num_contact[num_active_bins] = 0;
+
+    // Count the number of AABB-AABB intersections involving a moving shape in each active bin -> bin_num_contact
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_active_bins; i++) {
+        f_Count_AABB_AABB_Intersection(i, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_active,
+                                       bin_aabb_number, bin_start_index, fam_data, obj_active, obj_collide, obj_data_id,
+                                       bin_num_contact, &shape_static);
+    }
+
+    // Store the new pairs after the pairs of static shapes
+    thrust::exclusive_scan(bin_num_contact.begin(), bin_num_contact.end(), bin_num_contact.begin(),
+                           (uint)num_static_pairs);
+    num_possible_collisions = bin_num_contact.back();
+    pair_shapeIDs.resize(num_possible_collisions);
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_active_bins; index++) {
+        f_Store_AABB_AABB_Intersection(index, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_active,
+                                       bin_aabb_number, bin_start_index, bin_num_contact, fam_data, obj_active,
+                                       obj_collide, obj_data_id, pair_shapeIDs, &shape_static);
+    }
+
+    m_timer_moving.stop();
+}
+
+// -----------------------------------------------------------------------------
+
+// Find the active bins (i.e. with at least one shape AABB intersection) and the start index of their intersections,
+// from the list of bin - shape AABB intersections sorted by bin index.
+void ChBroadphase::ActiveBins() {
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_active = cd_data->bin_active;
+    std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    uint& num_active_bins = cd_data->num_active_bins;
+
+    bin_active.resize(bin_number.size());
+    bin_start_index.resize(bin_number.size());
+    num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
+
+    if (num_active_bins <= 0)
+        return;
+
+    bin_active.resize(num_active_bins);
+    bin_start_index.resize(num_active_bins + 1);
+    bin_start_index[num_active_bins] = 0;
+
+    Thrust_Exclusive_Scan(bin_start_index);
+}
+
+// Create an "extended" vector of start indices that also includes bins with no shape AABB intersections (used in ray
+// intersection tests).
+void ChBroadphase::ExtendedBinIndex() {
+    const std::vector<uint>& bin_active = cd_data->bin_active;
+    const std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
+    const uint num_bins = cd_data->num_bins;
+    const uint num_active_bins = cd_data->num_active_bins;
+
     bin_start_index_ext.resize(num_bins + 1);
 
 #pragma omp parallel for
@@ -18,8 +18,10 @@
 
 #pragma once
 
+#include "chrono/core/ChTimer.h"
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/chrono/ChCollisionData.h"
+#include "chrono/collision/chrono/ChAABBTree.h"
 
 namespace chrono {
 namespace collision {
@@ -43,8 +45,59 @@ class ChApi ChBroadphase {
     /// Collision detection results are loaded in the shared data object (see ChCollisionData).
     void Process();
 
+    /// Enable/disable incremental broadphase (default: false).
+    /// In incremental mode, the broadphase grid is kept fixed for as long as all shape AABBs remain inside it (the
+    /// grid is created with a margin around the current AABB of all shapes). At each call to Process(), only the
+    /// shapes whose AABB overlaps a different set of bins than at the previous call are re-binned, and the list of
+    /// candidate pairs from the previous call is reused for all pairs of "static" shapes (shapes whose AABB, body
+    /// state, and collision family have not changed, such as shapes on fixed or sleeping bodies). AABB-AABB tests
+    /// are performed only for pairs involving at least one moving shape.
+    /// The resulting list of candidate pairs is the same as in non-incremental mode, up to ordering.
+    void SetIncremental(bool val);
+
+    /// Return true if the incremental broadphase is enabled.
+    bool IsIncremental() const { return incremental; }
+
+    /// Return the time (in seconds) spent in the last call to Process() on the static part of the scene (shape
+    /// classification, reuse of bins and candidate pairs). Always 0 if not in incremental mode.
+    double GetTimerStatic() const { return m_timer_static(); }
+
+    /// Return the time (in seconds) spent in the last call to Process() on the moving part of the scene (re-binning
+    /// and AABB-AABB tests for pairs involving moving shapes). In non-incremental mode, this is the time for a full
+    /// grid rebuild.
+    double GetTimerMoving() const { return m_timer_moving(); }
+
+    /// Return the number of shapes which were not considered static in the last call to Process().
+    uint GetNumMovingShapes() const { return num_moving_shapes; }
+
+    /// Enable/disable the hybrid grid / AABB-tree broadphase (default: false).
+    /// In hybrid mode, shapes whose AABB overlaps more than `max_bins` bins of the broadphase grid (e.g., the triangles
+    /// of a large terrain mesh or a long conveyor next to many small grains) are not binned. These shapes are instead
+    /// stored in an AABB tree (see ChAABBTree), which is rebuilt when the set of large shapes changes and otherwise
+    /// refitted in parallel. Pairs of small shapes are found with the uniform grid; pairs involving at least one large
+    /// shape are found by querying the tree with each shape AABB, in parallel.
+    /// The resulting list of candidate pairs is the same as with the grid alone, up to ordering.
+    /// The incremental broadphase (see SetIncremental) is not used in hybrid mode.
+    void SetHybrid(bool val, uint max_bins = 64);
+
+    /// Return true if the hybrid grid / AABB-tree broadphase is enabled.
+    bool IsHybrid() const { return hybrid; }
+
+    /// Return the number of shapes stored in the AABB tree in the last call to Process() (hybrid mode only).
+    uint GetNumTreeShapes() const { return (uint)cd_data->tree_shapes.size(); }
+
+    /// Return the AABB tree over the shapes not stored in the grid, as of the last call to Process().
+    /// Return nullptr if no shapes are stored in the tree (e.g., if not in hybrid mode).
+    const ChAABBTree* GetTree() const { return cd_data->tree_shapes.empty() ? nullptr : &tree; }
+
   private:
     void OneLevelBroadphase();
+    void TreeBroadphase();
+    void ActiveBins();
+    void ExtendedBinIndex();
+    void IncrementalBroadphase();
+    void StoreIncrementalState();
+    bool CanReuseGrid() const;
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
@@ -58,6 +111,37 @@ class ChApi ChBroadphase {
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
     real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
 
+    // Incremental broadphase data
+    bool incremental;                  ///< incremental mode enabled
+    bool inc_valid;                    ///< data from a previous pass is available
+    GridType inc_grid_type;            ///< grid type used at the last grid rebuild
+    vec3 inc_grid_resolution;          ///< grid resolution used at the last grid rebuild
+    real3 inc_bin_size;                ///< desired bin size used at the last grid rebuild
+    real inc_grid_density;             ///< grid density used at the last grid rebuild
+    real3 inc_min_point;               ///< lower corner of the current grid
+    real3 inc_max_point;               ///< upper corner of the current grid
+    std::vector<vec3> inc_bin_min;     ///< [num_rigid_shapes] first bin overlapped by each shape AABB
+    std::vector<vec3> inc_bin_max;     ///< [num_rigid_shapes] last bin overlapped by each shape AABB
+    std::vector<real3> inc_aabb_min;   ///< [num_rigid_shapes] shape AABBs (grid frame) at the previous pass
+    std::vector<real3> inc_aabb_max;   ///< [num_rigid_shapes] shape AABBs (grid frame) at the previous pass
+    std::vector<char> inc_flags;       ///< [num_rigid_shapes] shape state (body active/collide flags)
+    std::vector<short2> inc_fam;       ///< [num_rigid_shapes] shape collision family at the previous pass
+    std::vector<char> shape_rebinned;  ///< [num_rigid_shapes] shapes which overlap a different set of bins
+    std::vector<char> shape_static;    ///< [num_rigid_shapes] shapes unchanged since the previous pass
+    std::vector<uint> new_bin_number;       ///< bin indices for intersections of re-binned shapes
+    std::vector<uint> new_bin_aabb_number;  ///< shape IDs for intersections of re-binned shapes
+    uint num_moving_shapes;                 ///< number of non-static shapes at the last pass
+
+    // Hybrid broadphase data
+    bool hybrid;                          ///< hybrid grid / AABB-tree broadphase enabled
+    uint hybrid_max_bins;                 ///< shapes overlapping more bins are stored in the tree
+    ChAABBTree tree;                      ///< AABB tree over the large shapes
+    std::vector<char> shape_large;        ///< [num_rigid_shapes] shapes stored in the tree
+    std::vector<uint> tree_num_pairs;     ///< [num_rigid_shapes+1] number of tree pairs for each shape
+
+    ChTimer<> m_timer_static;  ///< timer for the static part of the broadphase
+    ChTimer<> m_timer_moving;  ///< timer for the moving part of the broadphase
+
     friend class ChCollisionSystemChrono;
     friend class ChCollisionSystemChronoMulticore;
 };
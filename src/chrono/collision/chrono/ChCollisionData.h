@@ -212,6 +212,7 @@ class ChApi ChCollisionData {
     std::vector<uint> bin_start_index;      ///< [num_active_bins+1]
     std::vector<uint> bin_start_index_ext;  ///< [num_bins+1]
     std::vector<uint> bin_num_contact;      ///< [num_active_bins+1]
+    std::vector<uint> tree_shapes;          ///< shapes stored in the AABB tree, not in the grid (hybrid broadphase)
 
     // Indexing variables
     // ------------------
@@ -141,6 +141,7 @@ ChApi void f_Store_AABB_BIN_Intersection(const uint index,
                                          std::vector<uint>& aabb_number);
 
 /// Function to count AABB-AABB intersection.
+/// If provided, pairs of two shapes flagged in shape_static are skipped.
 ChApi void f_Count_AABB_AABB_Intersection(const uint index,
                                           const real3 inv_bin_size_vec,
                                           const vec3 bins_per_axis,
@@ -153,9 +154,11 @@ ChApi void f_Count_AABB_AABB_Intersection(const uint index,
                                           const std::vector<char>& body_active,
                                           const std::vector<char>& body_collide,
                                           const std::vector<uint>& body_id,
-                                          std::vector<uint>& num_contact);
+                                          std::vector<uint>& num_contact,
+                                          const std::vector<char>* shape_static = nullptr);
 
 /// Function to store AABB-AABB intersections.
+/// If provided, pairs of two shapes flagged in shape_static are skipped.
 ChApi void f_Store_AABB_AABB_Intersection(const uint index,
                                           const real3 inv_bin_size_vec,
                                           const vec3 bins_per_axis,
@@ -169,7 +172,8 @@ ChApi void f_Store_AABB_AABB_Intersection(const uint index,
                                           const std::vector<char>& body_active,
                                           const std::vector<char>& body_collide,
                                           const std::vector<uint>& body_id,
-                                          std::vector<long long>& potential_contacts);
+                                          std::vector<long long>& potential_contacts,
+                                          const std::vector<char>* shape_static = nullptr);
 
 /// @}
 
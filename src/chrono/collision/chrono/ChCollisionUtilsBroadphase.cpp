@@ -97,7 +97,8 @@ void f_Count_AABB_AABB_Intersection(const uint index,
                                     const std::vector<char>& body_active,
                                     const std::vector<char>& body_collide,
                                     const std::vector<uint>& body_id,
-                                    std::vector<uint>& num_contact) {
+                                    std::vector<uint>& num_contact,
+                                    const std::vector<char>* shape_static) {
     uint start = bin_start_index[index];
     uint end = bin_start_index[index + 1];
     uint count = 0;
@@ -134,6 +135,8 @@ void f_Count_AABB_AABB_Intersection(const uint index,
                 continue;
             if (!body_active[bodyA] && !body_active[bodyB])
                 continue;
+            if (shape_static && (*shape_static)[shapeA] && (*shape_static)[shapeB])
+                continue;
             if (!collide(famA, fam_data[shapeB]))
                 continue;
             if (!overlap(Amin, Amax, Bmin, Bmax))
@@ -161,7 +164,8 @@ void f_Store_AABB_AABB_Intersection(const uint index,
                                     const std::vector<char>& body_active,
                                     const std::vector<char>& body_collide,
                                     const std::vector<uint>& body_id,
-                                    std::vector<long long>& potential_contacts) {
+                                    std::vector<long long>& potential_contacts,
+                                    const std::vector<char>* shape_static) {
     uint start = bin_start_index[index];
     uint end = bin_start_index[index + 1];
     // Terminate early if there is only one object in the bin
@@ -199,6 +203,8 @@ void f_Store_AABB_AABB_Intersection(const uint index,
                 continue;
             if (!body_active[bodyA] && !body_active[bodyB])
                 continue;
+            if (shape_static && (*shape_static)[shapeA] && (*shape_static)[shapeB])
+                continue;
             if (!collide(famA, fam_data[shapeB]))
                 continue;
             if (!overlap(Amin, Amax, Bmin, Bmax))
@@ -38,6 +38,8 @@ using namespace chrono::collision::ch_utils;
 
 ChNarrowphase::ChNarrowphase()
     : algorithm(Algorithm::HYBRID),
+      batched(false),
+      num_batched_pairs(0),
       num_potential_rigid_contacts(0),
       num_potential_fluid_contacts(0),
       num_potential_rigid_fluid_contacts(0),
@@ -275,6 +277,10 @@ void ChNarrowphase::DispatchPRIMS() {
 
         int nC;
 
+        // Skip pairs already processed by the batched kernels
+        if (num_batched_pairs > 0 && pair_group[index] != 0)
+            continue;
+
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
         if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
@@ -303,6 +309,10 @@ void ChNarrowphase::DispatchHybridMPR() {
 
         int nC;
 
+        // Skip pairs already processed by the batched kernels
+        if (num_batched_pairs > 0 && pair_group[index] != 0)
+            continue;
+
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
         if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
@@ -347,6 +357,12 @@ void ChNarrowphase::ProcessRigidRigid() {
     contact_rigid_active.resize(num_potentialContacts);
     thrust::fill(contact_rigid_active.begin(), contact_rigid_active.end(), false);
 
+    // Process the sphere-sphere, box-sphere, and box-box pairs with the batched kernels (analytical algorithms only).
+    // The remaining pairs are then processed with the scalar dispatch.
+    num_batched_pairs = 0;
+    if (batched && algorithm != Algorithm::MPR)
+        DispatchBatched();
+
     switch (algorithm) {
         case Algorithm::MPR:
             DispatchMPR();
@@ -64,6 +64,20 @@ class ChApi ChNarrowphase {
     /// Collision detection results are loaded in the shared data object (see ChCollisionData).
     void Process();
 
+    /// Enable/disable the batched rigid-rigid narrowphase (default: false).
+    /// If enabled, and if using the PRIMS or HYBRID algorithm, the candidate pairs are grouped by shape-type pair and
+    /// the sphere-sphere, box-sphere, and box-box groups are processed batch_width pairs at a time by vectorized
+    /// kernels operating on structure-of-arrays data (for box-box pairs, only the separating-axis culling is
+    /// vectorized). All other pairs are processed with the scalar dispatch. The resulting contacts are the same as
+    /// those obtained with the scalar dispatch.
+    void SetBatched(bool val) { batched = val; }
+
+    /// Return true if the batched rigid-rigid narrowphase is enabled.
+    bool IsBatched() const { return batched; }
+
+    /// Return the number of candidate pairs processed by the batched kernels during the last call to Process.
+    uint GetNumBatchedPairs() const { return num_batched_pairs; }
+
     /// Minkovski Portal Refinement convex-convex collision detection (adapted from Xeno Collide).
     /// Each candidate pair can result in 0 or 1 contacts. For each contact, the function calculates and returns:
     ///   - pointA:   contact point on first shape (in global frame)
@@ -112,6 +126,9 @@ class ChApi ChNarrowphase {
     static const int max_neighbors = 64;
     static const int max_rigid_neighbors = 32;
 
+    /// Number of candidate pairs processed together by the batched kernels (one SIMD lane per pair).
+    static const int batch_width = 8;
+
   private:
     /// Calculate total number of potential contacts.
     int PreprocessCount();
@@ -133,6 +150,10 @@ class ChApi ChNarrowphase {
     void DispatchMPR();
     void DispatchPRIMS();
     void DispatchHybridMPR();
+    void DispatchBatched();
+    void DispatchBatchSphereSphere();
+    void DispatchBatchBoxSphere();
+    void DispatchBatchBoxBox();
     void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
     void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
 
@@ -149,6 +170,13 @@ class ChApi ChNarrowphase {
 
     Algorithm algorithm;
 
+    bool batched;                     ///< use batched kernels for the sphere-sphere, box-sphere, and box-box pairs
+    uint num_batched_pairs;           ///< number of pairs processed by the batched kernels
+    std::vector<char> pair_group;     ///< batch group of each candidate pair
+    std::vector<uint> batch_sph_sph;  ///< candidate pairs in the sphere-sphere group
+    std::vector<uint> batch_box_sph;  ///< candidate pairs in the box-sphere group
+    std::vector<uint> batch_box_box;  ///< candidate pairs in the box-box group
+
     std::vector<uint> f_bin_intersections;
     std::vector<uint> f_bin_number;
     std::vector<uint> f_bin_number_out;  //// TODO: rename to f_bin_active
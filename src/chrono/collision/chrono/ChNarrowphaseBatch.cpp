@@ -0,0 +1,456 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Batched narrowphase kernels. Candidate pairs are grouped by shape-type pair
+// and each group is processed ChNarrowphase::batch_width pairs at a time: the
+// shape data of a batch is gathered into structure-of-arrays lanes, the contact
+// kernel is evaluated for all lanes with a vectorized loop (inactive lanes are
+// masked out), and the resulting contacts are scattered to the contact arrays.
+// The kernels use the same arithmetic as the scalar functions in
+// ChNarrowphasePRIMS.cpp. The box-box group only vectorizes the separating-axis
+// culling on the face normals of the two boxes; contacts for the surviving
+// lanes are generated with the scalar box_box function.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono/collision/chrono/ChNarrowphase.h"
+#include "chrono/collision/chrono/ChCollisionUtils.h"
+
+// Always include ChConfig.h *before* any Thrust headers!
+#include "chrono/ChConfig.h"
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace chrono {
+namespace collision {
+
+using namespace chrono::collision::ch_utils;
+
+// Batch groups
+enum BatchGroup { BATCH_NONE = 0, BATCH_SPHERE_SPHERE = 1, BATCH_BOX_SPHERE = 2, BATCH_BOX_BOX = 3 };
+
+// Scalar box-box contact generation (defined in ChNarrowphasePRIMS.cpp).
+int box_box(const real3& posT,
+            const quaternion& rotT,
+            const real3& hdimsT,
+            const real3& posO,
+            const quaternion& rotO,
+            const real3& hdimsO,
+            const real& separation,
+            real3* norm,
+            real* depth,
+            real3* ptT,
+            real3* ptO,
+            real* eff_radius);
+
+// Predicate for selecting the candidate pairs in a given batch group.
+struct _InGroup {
+    _InGroup(char g) : group(g) {}
+    bool operator()(char g) const { return g == group; }
+    char group;
+};
+
+// Rotate the vector (vx,vy,vz) by the quaternion (q0,q1,q2,q3) (same operations as Rotate).
+static inline void _Rotate(real q0,
+                           real q1,
+                           real q2,
+                           real q3,
+                           real vx,
+                           real vy,
+                           real vz,
+                           real& rx,
+                           real& ry,
+                           real& rz) {
+    real tx = 2 * (q2 * vz - q3 * vy);
+    real ty = 2 * (q3 * vx - q1 * vz);
+    real tz = 2 * (q1 * vy - q2 * vx);
+    rx = vx + q0 * tx + (q2 * tz - q3 * ty);
+    ry = vy + q0 * ty + (q3 * tx - q1 * tz);
+    rz = vz + q0 * tz + (q1 * ty - q2 * tx);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChNarrowphase::DispatchBatched() {
+    const int* obj_data_T = cd_data->shape_data.typ_rigid.data();
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+
+    // Classify the candidate pairs
+    pair_group.resize(num_potential_rigid_contacts);
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+        int type1 = obj_data_T[pair_shapeIDs[index] >> 32];
+        int type2 = obj_data_T[pair_shapeIDs[index] & 0xffffffff];
+        if (type1 == ChCollisionShape::Type::SPHERE && type2 == ChCollisionShape::Type::SPHERE)
+            pair_group[index] = BATCH_SPHERE_SPHERE;
+        else if ((type1 == ChCollisionShape::Type::BOX && type2 == ChCollisionShape::Type::SPHERE) ||
+                 (type1 == ChCollisionShape::Type::SPHERE && type2 == ChCollisionShape::Type::BOX))
+            pair_group[index] = BATCH_BOX_SPHERE;
+        else if (type1 == ChCollisionShape::Type::BOX && type2 == ChCollisionShape::Type::BOX)
+            pair_group[index] = BATCH_BOX_BOX;
+        else
+            pair_group[index] = BATCH_NONE;
+    }
+
+    // Collect the pairs in each group (in increasing order of the pair index)
+    thrust::counting_iterator<uint> first(0);
+    thrust::counting_iterator<uint> last(num_potential_rigid_contacts);
+
+    batch_sph_sph.resize(num_potential_rigid_contacts);
+    auto end_ss =
+        thrust::copy_if(THRUST_PAR first, last, pair_group.begin(), batch_sph_sph.begin(), _InGroup(BATCH_SPHERE_SPHERE));
+    batch_sph_sph.resize(end_ss - batch_sph_sph.begin());
+
+    batch_box_sph.resize(num_potential_rigid_contacts);
+    auto end_bs =
+        thrust::copy_if(THRUST_PAR first, last, pair_group.begin(), batch_box_sph.begin(), _InGroup(BATCH_BOX_SPHERE));
+    batch_box_sph.resize(end_bs - batch_box_sph.begin());
+
+    batch_box_box.resize(num_potential_rigid_contacts);
+    auto end_bb =
+        thrust::copy_if(THRUST_PAR first, last, pair_group.begin(), batch_box_box.begin(), _InGroup(BATCH_BOX_BOX));
+    batch_box_box.resize(end_bb - batch_box_box.begin());
+
+    num_batched_pairs = (uint)(batch_sph_sph.size() + batch_box_sph.size() + batch_box_box.size());
+
+    if (!batch_sph_sph.empty())
+        DispatchBatchSphereSphere();
+    if (!batch_box_sph.empty())
+        DispatchBatchBoxSphere();
+    if (!batch_box_box.empty())
+        DispatchBatchBoxBox();
+}
+
+// -----------------------------------------------------------------------------
+
+void ChNarrowphase::DispatchBatchSphereSphere() {
+    const int num_pairs = (int)batch_sph_sph.size();
+    const int num_batches = (num_pairs + batch_width - 1) / batch_width;
+    const real separation = 2 * cd_data->collision_envelope;
+
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+    const uint* obj_data_ID = cd_data->shape_data.id_rigid.data();
+    const int* obj_start = cd_data->shape_data.start_rigid.data();
+    const real* obj_radius = cd_data->shape_data.sphere_rigid.data();
+    const real3* obj_pos = cd_data->shape_data.obj_data_A_global.data();
+
+    real3* norm = cd_data->norm_rigid_rigid.data();
+    real3* ptA = cd_data->cpta_rigid_rigid.data();
+    real3* ptB = cd_data->cptb_rigid_rigid.data();
+    real* contactDepth = cd_data->dpth_rigid_rigid.data();
+    real* effective_radius = cd_data->erad_rigid_rigid.data();
+
+#pragma omp parallel for
+    for (int batch = 0; batch < num_batches; batch++) {
+        const int start = batch * batch_width;
+        const int lanes = std::min(batch_width, num_pairs - start);
+
+        // Gather the shape data (unused lanes replicate the last pair of the batch)
+        uint index[batch_width];
+        real ax[batch_width], ay[batch_width], az[batch_width], ra[batch_width];
+        real bx[batch_width], by[batch_width], bz[batch_width], rb[batch_width];
+        for (int l = 0; l < batch_width; l++) {
+            index[l] = batch_sph_sph[start + std::min(l, lanes - 1)];
+            int sA = int(pair_shapeIDs[index[l]] >> 32);
+            int sB = int(pair_shapeIDs[index[l]] & 0xffffffff);
+            ax[l] = obj_pos[sA].x;
+            ay[l] = obj_pos[sA].y;
+            az[l] = obj_pos[sA].z;
+            ra[l] = obj_radius[obj_start[sA]];
+            bx[l] = obj_pos[sB].x;
+            by[l] = obj_pos[sB].y;
+            bz[l] = obj_pos[sB].z;
+            rb[l] = obj_radius[obj_start[sB]];
+        }
+
+        // Evaluate the sphere-sphere kernel on all lanes (see sphere_sphere)
+        char hit[batch_width];
+        real nx[batch_width], ny[batch_width], nz[batch_width], depth[batch_width], erad[batch_width];
+#pragma omp simd
+        for (int l = 0; l < batch_width; l++) {
+            real dx = bx[l] - ax[l];
+            real dy = by[l] - ay[l];
+            real dz = bz[l] - az[l];
+            real dist2 = dx * dx + dy * dy + dz * dz;
+            real radSum = ra[l] + rb[l];
+            real radSum_s = radSum + separation;
+            hit[l] = (l < lanes) && (dist2 < radSum_s * radSum_s) && (dist2 >= 1e-12);
+            real dist = std::sqrt(hit[l] ? dist2 : 1);
+            nx[l] = dx / dist;
+            ny[l] = dy / dist;
+            nz[l] = dz / dist;
+            depth[l] = dist - radSum;
+            erad[l] = ra[l] * rb[l] / radSum;
+        }
+
+        // Scatter the contacts from the active lanes
+        for (int l = 0; l < lanes; l++) {
+            if (!hit[l])
+                continue;
+            long long p = pair_shapeIDs[index[l]];
+            uint icoll = contact_index[index[l]];
+            real3 n(nx[l], ny[l], nz[l]);
+            norm[icoll] = n;
+            ptA[icoll] = real3(ax[l], ay[l], az[l]) + n * ra[l];
+            ptB[icoll] = real3(bx[l], by[l], bz[l]) - n * rb[l];
+            contactDepth[icoll] = depth[l];
+            effective_radius[icoll] = erad[l];
+            Dispatch_Finalize(icoll, obj_data_ID[p >> 32], obj_data_ID[p & 0xffffffff], 1);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChNarrowphase::DispatchBatchBoxSphere() {
+    const int num_pairs = (int)batch_box_sph.size();
+    const int num_batches = (num_pairs + batch_width - 1) / batch_width;
+    const real separation = 2 * cd_data->collision_envelope;
+    const real edge_radius = GetDefaultEdgeRadius();
+
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+    const uint* obj_data_ID = cd_data->shape_data.id_rigid.data();
+    const int* obj_data_T = cd_data->shape_data.typ_rigid.data();
+    const int* obj_start = cd_data->shape_data.start_rigid.data();
+    const real* obj_radius = cd_data->shape_data.sphere_rigid.data();
+    const real3* obj_box = cd_data->shape_data.box_like_rigid.data();
+    const real3* obj_pos = cd_data->shape_data.obj_data_A_global.data();
+    const quaternion* obj_rot = cd_data->shape_data.obj_data_R_global.data();
+
+    real3* norm = cd_data->norm_rigid_rigid.data();
+    real3* ptA = cd_data->cpta_rigid_rigid.data();
+    real3* ptB = cd_data->cptb_rigid_rigid.data();
+    real* contactDepth = cd_data->dpth_rigid_rigid.data();
+    real* effective_radius = cd_data->erad_rigid_rigid.data();
+
+#pragma omp parallel for
+    for (int batch = 0; batch < num_batches; batch++) {
+        const int start = batch * batch_width;
+        const int lanes = std::min(batch_width, num_pairs - start);
+
+        // Gather the box and sphere data (unused lanes replicate the last pair of the batch).
+        // 'flip' marks the lanes for which the sphere is the first shape of the pair.
+        uint index[batch_width];
+        char flip[batch_width];
+        real px[batch_width], py[batch_width], pz[batch_width];
+        real q0[batch_width], q1[batch_width], q2[batch_width], q3[batch_width];
+        real hx[batch_width], hy[batch_width], hz[batch_width];
+        real sx[batch_width], sy[batch_width], sz[batch_width], rs[batch_width];
+        for (int l = 0; l < batch_width; l++) {
+            index[l] = batch_box_sph[start + std::min(l, lanes - 1)];
+            int sA = int(pair_shapeIDs[index[l]] >> 32);
+            int sB = int(pair_shapeIDs[index[l]] & 0xffffffff);
+            flip[l] = obj_data_T[sA] == ChCollisionShape::Type::SPHERE;
+            int box = flip[l] ? sB : sA;
+            int sph = flip[l] ? sA : sB;
+            const real3& hdims = obj_box[obj_start[box]];
+            const quaternion& rot = obj_rot[box];
+            px[l] = obj_pos[box].x;
+            py[l] = obj_pos[box].y;
+            pz[l] = obj_pos[box].z;
+            q0[l] = rot.w;
+            q1[l] = rot.x;
+            q2[l] = rot.y;
+            q3[l] = rot.z;
+            hx[l] = hdims.x;
+            hy[l] = hdims.y;
+            hz[l] = hdims.z;
+            sx[l] = obj_pos[sph].x;
+            sy[l] = obj_pos[sph].y;
+            sz[l] = obj_pos[sph].z;
+            rs[l] = obj_radius[obj_start[sph]];
+        }
+
+        // Evaluate the box-sphere kernel on all lanes (see box_sphere)
+        char hit[batch_width];
+        real nx[batch_width], ny[batch_width], nz[batch_width];
+        real cx[batch_width], cy[batch_width], cz[batch_width];
+        real depth[batch_width], erad[batch_width];
+#pragma omp simd
+        for (int l = 0; l < batch_width; l++) {
+            // Sphere position in the box frame
+            real lx, ly, lz;
+            _Rotate(q0[l], -q1[l], -q2[l], -q3[l], sx[l] - px[l], sy[l] - py[l], sz[l] - pz[l], lx, ly, lz);
+
+            // Snap to the box surface
+            bool out_x = std::abs(lx) > hx[l];
+            bool out_y = std::abs(ly) > hy[l];
+            bool out_z = std::abs(lz) > hz[l];
+            real bpx = out_x ? (lx > 0 ? hx[l] : -hx[l]) : lx;
+            real bpy = out_y ? (ly > 0 ? hy[l] : -hy[l]) : ly;
+            real bpz = out_z ? (lz > 0 ? hz[l] : -hz[l]) : lz;
+            int num_out = (int)out_x + (int)out_y + (int)out_z;
+
+            real dx = lx - bpx;
+            real dy = ly - bpy;
+            real dz = lz - bpz;
+            real dist2 = dx * dx + dy * dy + dz * dz;
+            real radius_s = rs[l] + separation;
+            hit[l] = (l < lanes) && (dist2 < radius_s * radius_s) && (dist2 > 1e-12f);
+
+            real dist = std::sqrt(hit[l] ? dist2 : 1);
+            depth[l] = dist - rs[l];
+            _Rotate(q0[l], q1[l], q2[l], q3[l], dx / dist, dy / dist, dz / dist, nx[l], ny[l], nz[l]);
+            _Rotate(q0[l], q1[l], q2[l], q3[l], bpx, bpy, bpz, cx[l], cy[l], cz[l]);
+            cx[l] += px[l];
+            cy[l] += py[l];
+            cz[l] += pz[l];
+
+            // Contact on a face (code 1, 2, or 4) or with an edge or corner (including the case of the sphere center
+            // inside the box, code 0)
+            erad[l] = (num_out == 1) ? rs[l] : rs[l] * edge_radius / (rs[l] + edge_radius);
+        }
+
+        // Scatter the contacts from the active lanes
+        for (int l = 0; l < lanes; l++) {
+            if (!hit[l])
+                continue;
+            long long p = pair_shapeIDs[index[l]];
+            uint icoll = contact_index[index[l]];
+            real3 n(nx[l], ny[l], nz[l]);
+            real3 pt_box(cx[l], cy[l], cz[l]);
+            real3 pt_sph = real3(sx[l], sy[l], sz[l]) - n * rs[l];
+            if (flip[l]) {
+                norm[icoll] = -n;
+                ptA[icoll] = pt_sph;
+                ptB[icoll] = pt_box;
+            } else {
+                norm[icoll] = n;
+                ptA[icoll] = pt_box;
+                ptB[icoll] = pt_sph;
+            }
+            contactDepth[icoll] = depth[l];
+            effective_radius[icoll] = erad[l];
+            Dispatch_Finalize(icoll, obj_data_ID[p >> 32], obj_data_ID[p & 0xffffffff], 1);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChNarrowphase::DispatchBatchBoxBox() {
+    const int num_pairs = (int)batch_box_box.size();
+    const int num_batches = (num_pairs + batch_width - 1) / batch_width;
+    const real separation = 2 * cd_data->collision_envelope;
+
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+    const uint* obj_data_ID = cd_data->shape_data.id_rigid.data();
+    const int* obj_start = cd_data->shape_data.start_rigid.data();
+    const real3* obj_box = cd_data->shape_data.box_like_rigid.data();
+    const real3* obj_pos = cd_data->shape_data.obj_data_A_global.data();
+    const quaternion* obj_rot = cd_data->shape_data.obj_data_R_global.data();
+
+    real3* norm = cd_data->norm_rigid_rigid.data();
+    real3* ptA = cd_data->cpta_rigid_rigid.data();
+    real3* ptB = cd_data->cptb_rigid_rigid.data();
+    real* contactDepth = cd_data->dpth_rigid_rigid.data();
+    real* effective_radius = cd_data->erad_rigid_rigid.data();
+
+#pragma omp parallel for
+    for (int batch = 0; batch < num_batches; batch++) {
+        const int start = batch * batch_width;
+        const int lanes = std::min(batch_width, num_pairs - start);
+
+        // Gather the data of the two boxes (unused lanes replicate the last pair of the batch)
+        uint index[batch_width];
+        real dx[batch_width], dy[batch_width], dz[batch_width];
+        real t0[batch_width], t1[batch_width], t2[batch_width], t3[batch_width];
+        real o0[batch_width], o1[batch_width], o2[batch_width], o3[batch_width];
+        real ht[3][batch_width], ho[3][batch_width];
+        for (int l = 0; l < batch_width; l++) {
+            index[l] = batch_box_box[start + std::min(l, lanes - 1)];
+            int sA = int(pair_shapeIDs[index[l]] >> 32);
+            int sB = int(pair_shapeIDs[index[l]] & 0xffffffff);
+            const real3& hdimsA = obj_box[obj_start[sA]];
+            const real3& hdimsB = obj_box[obj_start[sB]];
+            dx[l] = obj_pos[sB].x - obj_pos[sA].x;
+            dy[l] = obj_pos[sB].y - obj_pos[sA].y;
+            dz[l] = obj_pos[sB].z - obj_pos[sA].z;
+            t0[l] = obj_rot[sA].w;
+            t1[l] = obj_rot[sA].x;
+            t2[l] = obj_rot[sA].y;
+            t3[l] = obj_rot[sA].z;
+            o0[l] = obj_rot[sB].w;
+            o1[l] = obj_rot[sB].x;
+            o2[l] = obj_rot[sB].y;
+            o3[l] = obj_rot[sB].z;
+            for (int i = 0; i < 3; i++) {
+                ht[i][l] = hdimsA[i];
+                ho[i][l] = hdimsB[i];
+            }
+        }
+
+        // Separating-axis test on the 6 face normals for all lanes (see box_intersects_box). A lane is culled only if
+        // the boxes are separated by more than a small tolerance along one of these axes; box_box repeats the complete
+        // test for the remaining lanes, so the culling does not change the generated contacts.
+        char hit[batch_width];
+#pragma omp simd
+        for (int l = 0; l < batch_width; l++) {
+            // Position and orientation of the second box in the frame of the first box
+            real p[3];
+            _Rotate(t0[l], -t1[l], -t2[l], -t3[l], dx[l], dy[l], dz[l], p[0], p[1], p[2]);
+            real qw = t0[l] * o0[l] + t1[l] * o1[l] + t2[l] * o2[l] + t3[l] * o3[l];
+            real qx = t0[l] * o1[l] - o0[l] * t1[l] - (t2[l] * o3[l] - t3[l] * o2[l]);
+            real qy = t0[l] * o2[l] - o0[l] * t2[l] - (t3[l] * o1[l] - t1[l] * o3[l]);
+            real qz = t0[l] * o3[l] - o0[l] * t3[l] - (t1[l] * o2[l] - t2[l] * o1[l]);
+
+            // Rotation matrix (same layout as Mat33(quaternion), R[i][j] = R(i,j))
+            real R[3][3];
+            R[0][0] = 1 - 2 * (qy * qy + qz * qz);
+            R[1][0] = 2 * (qx * qy + qz * qw);
+            R[2][0] = 2 * (qx * qz - qy * qw);
+            R[0][1] = 2 * (qx * qy - qz * qw);
+            R[1][1] = 1 - 2 * (qx * qx + qz * qz);
+            R[2][1] = 2 * (qy * qz + qx * qw);
+            R[0][2] = 2 * (qx * qz + qy * qw);
+            R[1][2] = 2 * (qy * qz - qx * qw);
+            R[2][2] = 1 - 2 * (qx * qx + qy * qy);
+
+            real tol = 1e-6 * (ht[0][l] + ht[1][l] + ht[2][l] + ho[0][l] + ho[1][l] + ho[2][l]);
+            bool separated = false;
+            for (int i = 0; i < 3; i++) {
+                // Axis i of the first box
+                real r2 = std::abs(R[i][0]) * ho[0][l] + std::abs(R[i][1]) * ho[1][l] + std::abs(R[i][2]) * ho[2][l];
+                separated |= ht[i][l] + r2 - std::abs(p[i]) + separation < -tol;
+                // Axis i of the second box
+                real r1 = std::abs(R[0][i]) * ht[0][l] + std::abs(R[1][i]) * ht[1][l] + std::abs(R[2][i]) * ht[2][l];
+                real pi = R[0][i] * p[0] + R[1][i] * p[1] + R[2][i] * p[2];
+                separated |= r1 + ho[i][l] - std::abs(pi) + separation < -tol;
+            }
+            hit[l] = (l < lanes) && !separated;
+        }
+
+        // Generate and scatter the contacts for the surviving lanes (up to 8 per pair, see PreprocessCount)
+        for (int l = 0; l < lanes; l++) {
+            if (!hit[l])
+                continue;
+            long long p = pair_shapeIDs[index[l]];
+            int sA = int(p >> 32);
+            int sB = int(p & 0xffffffff);
+            uint icoll = contact_index[index[l]];
+            int nC = box_box(obj_pos[sA], obj_rot[sA], obj_box[obj_start[sA]], obj_pos[sB], obj_rot[sB],
+                             obj_box[obj_start[sB]], separation, &norm[icoll], &contactDepth[icoll], &ptA[icoll],
+                             &ptB[icoll], &effective_radius[icoll]);
+            if (nC > 0)
+                Dispatch_Finalize(icoll, obj_data_ID[sA], obj_data_ID[sB], nC);
+        }
+    }
+}
+
+}  // end namespace collision
+}  // end namespace chrono
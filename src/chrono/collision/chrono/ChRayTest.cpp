@@ -12,6 +12,8 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/collision/chrono/ChRayTest.h"
 #include "chrono/collision/chrono/ChCollisionUtils.h"
 
@@ -24,7 +26,8 @@ namespace collision {
 
 using namespace chrono::collision::ch_utils;
 
-ChRayTest::ChRayTest(std::shared_ptr<ChCollisionData> data) : cd_data(data), num_bin_tests(0), num_shape_tests(0) {}
+ChRayTest::ChRayTest(std::shared_ptr<ChCollisionData> data, const ChAABBTree* tree)
+    : cd_data(data), tree(tree), num_bin_tests(0), num_shape_tests(0) {}
 
 // =============================================================================
 
@@ -424,11 +427,34 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
         }
     }
 
-    // Walk through each bin intersected by the ray (DDA).
     ConvexShape shape(-1, &cd_data->shape_data);
     real mindist2 = C_REAL_MAX;
+    real3 shape_normal;
     bool hit = false;
 
+    // Shapes stored in the AABB tree of the hybrid broadphase are not binned; test them first.
+    // If available, query the tree for the shapes overlapping the ray bounding box (relative to the global origin).
+    bool hit_tree = false;
+    auto check_tree_shape = [&](uint index) {
+        num_shape_tests++;
+        shape.index = index;
+        if (CheckShape(shape, start, end, shape_normal, mindist2)) {
+            hit_tree = true;
+            info.shapeID = index;
+            info.normal = shape_normal;
+        }
+    };
+    if (tree) {
+        const real3& origin = cd_data->global_origin;
+        tree->Query(Min(start, end) - origin, Max(start, end) - origin, check_tree_shape);
+    } else {
+        for (auto index : cd_data->tree_shapes)
+            check_tree_shape(index);
+    }
+    real ray_length = Length(ray);
+
+    // Walk through each bin intersected by the ray (DDA).
+
     ////std::cout << "Ray start: [" << start.x << "," << start.y << "," << start.z << "]" << std::endl;
     ////std::cout << "Ray end:   [" << end.x << "," << end.y << "," << end.z << "]" << std::endl;
 
@@ -445,13 +471,19 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
             num_shape_tests++;
             shape.index = bin_aabb_number[j];
             ////std::cout << "    Test SHAPE: " << shape.index << std::endl;
-            if (CheckShape(shape, start, end, info.normal, mindist2))
+            if (CheckShape(shape, start, end, shape_normal, mindist2)) {
                 hit = true;
+                info.shapeID = shape.index;
+                info.normal = shape_normal;
+            }
         }
 
+        // A hit on a tree shape is final as soon as it is closer than the exit point from the current bin.
+        if (hit_tree && !hit && Sqrt(mindist2) <= Min(t_next[0], Min(t_next[1], t_next[2])) * ray_length)
+            break;
+
         // If a shape in the current bin was hit, stop.
         if (hit) {
-            info.shapeID = shape.index;         // Identifier of closest hit shape
             info.dist = Sqrt(mindist2);         // Distance from ray origin
             info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
             info.point = start + info.t * ray;  // Intersection point
@@ -468,9 +500,174 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
         t_next[axis] += delta[axis];
     }
 
+    // No closer hit in the grid than the hit on a tree shape
+    if (!hit && hit_tree) {
+        info.dist = Sqrt(mindist2);
+        info.t = info.dist / ray_length;
+        info.point = start + info.t * ray;
+        return true;
+    }
+
+    return hit;
+}
+
+bool ChRayTest::Check(const real3& start, const real3& end, const std::vector<uint>& shapes, RayHitInfo& info) {
+    ConvexShape shape(-1, &cd_data->shape_data);
+    real mindist2 = C_REAL_MAX;
+    real3 shape_normal;
+    bool hit = false;
+
+    for (auto index : shapes) {
+        num_shape_tests++;
+        shape.index = index;
+        if (CheckShape(shape, start, end, shape_normal, mindist2)) {
+            hit = true;
+            info.shapeID = index;
+            info.normal = shape_normal;
+        }
+    }
+
+    if (hit) {
+        real ray_length = Length(end - start);
+        info.dist = Sqrt(mindist2);
+        info.t = info.dist / ray_length;
+        info.point = start + info.t * (end - start);
+    }
+
     return hit;
 }
 
+// Process the rays in packets of consecutive rays. For each packet, the BVH over all shape AABBs is traversed once with
+// the bounding box of the packet rays. Each candidate shape is then culled against all rays of the packet with a slab
+// test on the shape AABB; the loops over the packet lanes operate on structure-of-arrays data and are vectorized by the
+// compiler. Only the lanes which pass the slab test (and for which the AABB is closer than the current closest hit) are
+// checked against the actual shape.
+uint ChRayTest::Check(const std::vector<real3>& start,
+                      const std::vector<real3>& end,
+                      std::vector<RayHitInfo>& info,
+                      std::vector<char>& hit) {
+    assert(start.size() == end.size());
+    int num_rays = (int)start.size();
+    info.resize(num_rays);
+    hit.assign(num_rays, 0);
+
+    // Shape AABBs are expressed relative to the global origin
+    const real3& origin = cd_data->global_origin;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+
+    // Collect all shapes known to the broadphase (binned and unbinned) and build the BVH over their AABBs
+    std::vector<uint> shapes(cd_data->bin_aabb_number);
+    shapes.insert(shapes.end(), cd_data->tree_shapes.begin(), cd_data->tree_shapes.end());
+    std::sort(shapes.begin(), shapes.end());
+    shapes.erase(std::unique(shapes.begin(), shapes.end()), shapes.end());
+
+    ChAABBTree tree;
+    tree.Build(shapes, aabb_min, aabb_max);
+
+    int num_packets = (num_rays + packet_width - 1) / packet_width;
+    uint num_hits = 0;
+    uint num_tests = 0;
+
+#pragma omp parallel reduction(+ : num_hits, num_tests)
+    {
+        ConvexShape shape(-1, &cd_data->shape_data);
+        std::vector<uint> candidates;
+
+#pragma omp for schedule(dynamic, 4)
+        for (int p = 0; p < num_packets; p++) {
+            int first = p * packet_width;
+            int count = std::min(packet_width, num_rays - first);
+
+            // Packet rays in SoA layout (relative to the global origin) and packet bounding box.
+            // Unused lanes replicate the first ray of the packet.
+            real ox[packet_width], oy[packet_width], oz[packet_width];
+            real ix[packet_width], iy[packet_width], iz[packet_width];
+            real len2[packet_width];
+            real mindist2[packet_width];
+            int hit_id[packet_width];
+            real3 normal[packet_width];
+            real3 pmin(+C_REAL_MAX);
+            real3 pmax(-C_REAL_MAX);
+            for (int l = 0; l < packet_width; l++) {
+                int r = first + (l < count ? l : 0);
+                real3 o = start[r] - origin;
+                real3 d = end[r] - start[r];
+                ox[l] = o.x;
+                oy[l] = o.y;
+                oz[l] = o.z;
+                ix[l] = (d.x != 0) ? 1 / d.x : C_REAL_MAX;
+                iy[l] = (d.y != 0) ? 1 / d.y : C_REAL_MAX;
+                iz[l] = (d.z != 0) ? 1 / d.z : C_REAL_MAX;
+                len2[l] = Length2(d);
+                mindist2[l] = C_REAL_MAX;
+                hit_id[l] = -1;
+                pmin = Min(pmin, Min(o, o + d));
+                pmax = Max(pmax, Max(o, o + d));
+            }
+
+            // Candidate shapes: shapes with an AABB overlapping the packet bounding box
+            candidates.clear();
+            tree.Query(pmin, pmax, [&candidates](uint s) { candidates.push_back(s); });
+
+            for (auto s : candidates) {
+                const real3& bmin = aabb_min[s];
+                const real3& bmax = aabb_max[s];
+
+                // Slab test of all packet rays against the shape AABB
+                char active[packet_width];
+                int num_active = 0;
+                for (int l = 0; l < packet_width; l++) {
+                    real tx1 = (bmin.x - ox[l]) * ix[l];
+                    real tx2 = (bmax.x - ox[l]) * ix[l];
+                    real ty1 = (bmin.y - oy[l]) * iy[l];
+                    real ty2 = (bmax.y - oy[l]) * iy[l];
+                    real tz1 = (bmin.z - oz[l]) * iz[l];
+                    real tz2 = (bmax.z - oz[l]) * iz[l];
+                    real tnear = Max(Max(Min(tx1, tx2), Min(ty1, ty2)), Max(Min(tz1, tz2), real(0)));
+                    real tfar = Min(Min(Max(tx1, tx2), Max(ty1, ty2)), Min(Max(tz1, tz2), real(1)));
+                    active[l] = (tnear <= tfar) && (tnear * tnear * len2[l] <= mindist2[l]);
+                    num_active += active[l];
+                }
+                if (num_active == 0)
+                    continue;
+
+                // Exact ray-shape tests for the active lanes
+                shape.index = s;
+                for (int l = 0; l < count; l++) {
+                    if (!active[l])
+                        continue;
+                    num_tests++;
+                    real3 shape_normal;
+                    if (CheckShape(shape, start[first + l], end[first + l], shape_normal, mindist2[l])) {
+                        hit_id[l] = s;
+                        normal[l] = shape_normal;
+                    }
+                }
+            }
+
+            // Collect results
+            for (int l = 0; l < count; l++) {
+                if (hit_id[l] < 0)
+                    continue;
+                int r = first + l;
+                RayHitInfo& ri = info[r];
+                ri.shapeID = hit_id[l];
+                ri.normal = normal[l];
+                ri.dist = Sqrt(mindist2[l]);
+                ri.t = ri.dist / Sqrt(len2[l]);
+                ri.point = start[r] + ri.t * (end[r] - start[r]);
+                hit[r] = 1;
+                num_hits++;
+            }
+        }
+    }
+
+    num_shape_tests += num_tests;
+
+    return num_hits;
+}
+
 // Narrowphase dispatcher for ray intersection test.  It uses analytical formulaes for known primitive shapes with
 // fallback on a generic ray-convex intersection test.
 bool ChRayTest::CheckShape(const ConvexBase& shape,
@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <vector>
+
+#include "chrono/collision/chrono/ChAABBTree.h"
 #include "chrono/collision/chrono/ChCollisionData.h"
 #include "chrono/collision/chrono/ChConvexShape.h"
 
@@ -39,7 +42,10 @@ class ChApi ChRayTest {
         real dist;     ///< distance to hit point from ray origin
     };
 
-    ChRayTest(std::shared_ptr<ChCollisionData> data);
+    /// Construct a ray tester for the given collision data. If the broadphase stores some shapes in an AABB tree
+    /// (hybrid mode), that tree should be provided, so that single-ray tests only check the tree shapes overlapping the
+    /// ray bounding box; otherwise, all tree shapes are checked.
+    ChRayTest(std::shared_ptr<ChCollisionData> data, const ChAABBTree* tree = nullptr);
 
     /// Check for intersection of the given ray with all collision shapes in the system.
     /// Uses a variant of the 3D Digital Differential Analyser (Akira Fujimoto, "ARTS: Accelerated Ray Tracing Systems",
@@ -49,12 +55,34 @@ class ChApi ChRayTest {
                RayHitInfo& info     ///< [output] test result info
     );
 
+    /// Check for intersection of the given ray with the specified subset of collision shapes (e.g., the shapes of a
+    /// single collision model). The shapes are tested one by one; no broadphase information is used.
+    bool Check(const real3& start,               ///< ray start point
+               const real3& end,                 ///< ray end point
+               const std::vector<uint>& shapes,  ///< indices of candidate shapes
+               RayHitInfo& info                  ///< [output] test result info
+    );
+
+    /// Check for intersection of a batch of rays with all collision shapes in the system.
+    /// The rays are processed in packets of `packet_width` consecutive rays. A bounding volume hierarchy is built over
+    /// the AABBs of all collision shapes and traversed once per packet, with the bounding box of the packet rays. The
+    /// resulting candidate shapes are culled against all rays of the packet at once (slab test, with the packet rays
+    /// stored in structure-of-arrays layout) before the exact ray-shape tests. Packets are processed in parallel.
+    /// On return, 'info' and 'hit' have one entry per ray. Return the number of rays with a hit.
+    uint Check(const std::vector<real3>& start,  ///< ray start points
+               const std::vector<real3>& end,    ///< ray end points
+               std::vector<RayHitInfo>& info,    ///< [output] test result info
+               std::vector<char>& hit            ///< [output] ray hit flags
+    );
+
     /// Return the number of bins visited by the DDA algorithm during the last ray test.
     uint GetNumBinTests() const { return num_bin_tests; }
 
-    /// Return the number of ray-shape checks required by the last ray test.
+    /// Return the number of ray-shape checks required by the last ray test (or batch of ray tests).
     uint GetNumShapeTests() const { return num_shape_tests; }
 
+    static const int packet_width = 8;  ///< number of rays processed together in a batch ray test
+
   private:
     /// Dispatcher for analytic functions for ray intersection with primitive shapes.
     bool CheckShape(const ConvexBase& shape,  ///< candidate shape
@@ -65,6 +93,7 @@ class ChApi ChRayTest {
     );
 
     std::shared_ptr<ChCollisionData> cd_data;  ///< shared collision detection data
+    const ChAABBTree* tree;                    ///< broadphase AABB tree over the unbinned shapes (may be null)
     uint num_bin_tests;                        ///< number of bins visited during last ray test
     uint num_shape_tests;                      ///< number of shape checked during last ray test
 };
@@ -23,6 +23,38 @@ virtual void SetElement(int row, int col, double el, bool overwrite = true) {
     overwrite ? coeffRef(row, col) = el : coeffRef(row, col) += el;
 }
 
+/// Add 'el' to the element (row, col), without reallocating the matrix storage.
+/// If the element is not stored yet, it is inserted in the free space reserved for its inner vector (uncompressed mode
+/// only). Only the inner vector of the element is modified, so that elements in different inner vectors (rows, for a
+/// RowMajor matrix) can be added concurrently. Return false if the element is not stored and there is no free space
+/// for it in its inner vector (in which case the matrix is not modified).
+bool AddElementInPlace(int row, int col, double el) {
+    const StorageIndex outer = IsRowMajor ? row : col;
+    const StorageIndex inner = IsRowMajor ? col : row;
+    const StorageIndex start = m_outerIndex[outer];
+    const StorageIndex end = m_innerNonZeros ? start + m_innerNonZeros[outer] : m_outerIndex[outer + 1];
+    StorageIndex* indices = m_data.indexPtr();
+    Scalar* values = m_data.valuePtr();
+
+    StorageIndex pos = static_cast<StorageIndex>(std::lower_bound(indices + start, indices + end, inner) - indices);
+    if (pos < end && indices[pos] == inner) {
+        values[pos] += el;
+        return true;
+    }
+
+    if (!m_innerNonZeros || end >= m_outerIndex[outer + 1])
+        return false;
+
+    for (StorageIndex k = end; k > pos; k--) {
+        indices[k] = indices[k - 1];
+        values[k] = values[k - 1];
+    }
+    indices[pos] = inner;
+    values[pos] = el;
+    m_innerNonZeros[outer]++;
+    return true;
+}
+
 void setZeroValues() {
     for (int k = 0; k < outerSize(); ++k) {
         for (InnerIterator it(*this, k); it; ++it) {
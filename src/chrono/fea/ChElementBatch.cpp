@@ -0,0 +1,635 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Batched evaluation of the internal forces and Jacobians of ANCF elements.
+//
+// All supported ANCF elements use the same "Continuous Integration" scheme: at
+// each quadrature point, the deformation gradient is obtained from the nodal
+// coordinates and the precomputed shape function derivatives, the (scaled)
+// 2nd Piola-Kirchhoff stresses are obtained from the Green-Lagrange strains
+// with a 6x6 stiffness matrix, and the result is projected back on the nodal
+// coordinates. The only differences between element types are the number of
+// shape functions and how quadrature points are grouped by stiffness matrix
+// (one group for the hexahedron, one group per layer for the shell, and two
+// groups for the Enhanced Continuum Mechanics split of the beam).
+//
+// Elements of the same type are processed in blocks of W elements stored in a
+// structure-of-arrays layout: every per-element quantity is stored as W
+// consecutive values (one per SIMD lane), so that all lane loops vectorize.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <map>
+
+#include "chrono/core/ChTypes.h"
+#include "chrono/fea/ChElementBatch.h"
+#include "chrono/fea/ChElementBeamANCF_3333.h"
+#include "chrono/fea/ChElementHexaANCF_3843.h"
+#include "chrono/fea/ChElementShellANCF_3833.h"
+
+namespace chrono {
+namespace fea {
+
+// Group of consecutive quadrature points of an ANCF element which use the same stiffness matrix.
+struct _QuadratureGroup {
+    int col;            // first column of the group in the element shape function derivative matrix
+    int nip;            // number of quadrature points in the group
+    const double* kGQ;  // minus the quadrature weights times the element Jacobian determinant
+    double D[36];       // 6x6 stiffness matrix (row-major), Voigt order [E11,E22,E33,2*E23,2*E13,2*E12]
+};
+
+// Voigt index of the symmetric tensor component (I,J).
+static const int _voigt[3][3] = {{0, 5, 4}, {5, 1, 3}, {4, 3, 2}};
+
+// -----------------------------------------------------------------------------
+
+// Batch of same-type ANCF elements using the "Continuous Integration" method.
+template <class ELEMENT>
+class ChElementBatchANCF : public ChElementBatch {
+  public:
+    static const int NSF = ELEMENT::NSF;  // number of shape functions
+    static const int NDOF = 3 * NSF;      // number of element coordinates
+    static const int W = 4;               // number of elements per block (SIMD lanes)
+
+    ChElementBatchANCF(const std::vector<ELEMENT*>& elements);
+
+    /// Check if the given element can be included in a batch.
+    static bool IsBatchable(ELEMENT* element) {
+        return element->m_method == ELEMENT::IntFrcMethod::ContInt && element->m_SD.cols() > 0;
+    }
+
+    /// Get the quadrature point groups of the given element.
+    static void GetGroups(ELEMENT* element, std::vector<_QuadratureGroup>& groups);
+
+    virtual unsigned int GetNumElements() const override { return (unsigned int)m_elements.size(); }
+    virtual void LoadResidual_F(ChVectorDynamic<>& R, const double c, int nthreads) override;
+    virtual void LoadKRMmatrices(double Kfactor, double Rfactor, double Mfactor, int nthreads) override;
+
+  private:
+    struct Block {
+        ELEMENT* elements[W];     // elements in this block (nullptr for unused lanes)
+        bool damping;             // true if damping is enabled for at least one element
+        double alpha[W];          // damping coefficients
+        std::vector<double> sd;   // shape function derivatives, [NIP][3][NSF][W]
+        std::vector<double> kGQ;  // quadrature weights, [NIP][W]
+        std::vector<double> D;    // stiffness matrices, [num_groups][36][W]
+    };
+
+    /// Gather the nodal coordinates (and their time derivatives) of the block elements, [3][NSF][W].
+    void GatherCoordinates(const Block& block, double* ebar, double* ebardot) const;
+
+    /// Calculate the deformation gradient (or its time derivative) at a quadrature point, [3][3][W].
+    void CalcDeformationGradient(const double* ebar, const double* sd, double* F) const;
+
+    /// Calculate the scaled 2nd Piola-Kirchhoff stresses at quadrature point q, in Voigt notation [6][W].
+    void CalcStress(const Block& block, int q, const double* F, const double* Fdot, double* S) const;
+
+    /// Calculate the generalized internal forces of the block elements, [NDOF][W].
+    void ComputeInternalForces(const Block& block, double* Qi) const;
+
+    /// Calculate the Jacobians of the generalized internal forces of the block elements, [NDOF][NDOF][W].
+    /// Only the upper triangular part is calculated if damping is not enabled for any of the block elements.
+    void ComputeInternalJacobians(const Block& block, double Kfactor, double Rfactor, double* H) const;
+
+    std::vector<ELEMENT*> m_elements;  // elements in this batch
+    int m_nip;                         // number of quadrature points per element
+    std::vector<int> m_group;          // group index of each quadrature point
+    std::vector<Block> m_blocks;       // element blocks
+};
+
+// -----------------------------------------------------------------------------
+// Quadrature point groups for the supported element types
+// -----------------------------------------------------------------------------
+
+template <>
+void ChElementBatchANCF<ChElementBeamANCF_3333>::GetGroups(ChElementBeamANCF_3333* element,
+                                                           std::vector<_QuadratureGroup>& groups) {
+    // Enhanced Continuum Mechanics: quadrature points excluding the Poisson effect (diagonal stiffness matrix D0)
+    // followed by the quadrature points including the Poisson effect (upper 3x3 block Dv)
+    const ChVectorN<double, 6>& D0 = element->GetMaterial()->Get_D0();
+    const ChMatrix33<double>& Dv = element->GetMaterial()->Get_Dv();
+
+    groups.resize(2);
+    groups[0].col = 0;
+    groups[0].nip = ChElementBeamANCF_3333::NIP_D0;
+    groups[0].kGQ = element->m_kGQ_D0.data();
+    std::fill(groups[0].D, groups[0].D + 36, 0.0);
+    for (int v = 0; v < 6; v++)
+        groups[0].D[7 * v] = D0(v);
+
+    groups[1].col = 3 * ChElementBeamANCF_3333::NIP_D0;
+    groups[1].nip = ChElementBeamANCF_3333::NIP_Dv;
+    groups[1].kGQ = element->m_kGQ_Dv.data();
+    std::fill(groups[1].D, groups[1].D + 36, 0.0);
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            groups[1].D[6 * i + j] = Dv(i, j);
+}
+
+template <>
+void ChElementBatchANCF<ChElementShellANCF_3833>::GetGroups(ChElementShellANCF_3833* element,
+                                                            std::vector<_QuadratureGroup>& groups) {
+    // One group per layer, with the layer stiffness matrix rotated by the layer fiber angle
+    groups.resize(element->m_numLayers);
+    for (int kl = 0; kl < element->m_numLayers; kl++) {
+        ChMatrixNM<double, 6, 6> D = element->m_layers[kl].GetMaterial()->Get_E_eps();
+        element->RotateReorderStiffnessMatrix(D, element->m_layers[kl].Get_theta());
+
+        groups[kl].col = 3 * kl * ChElementShellANCF_3833::NIP;
+        groups[kl].nip = ChElementShellANCF_3833::NIP;
+        groups[kl].kGQ = element->m_kGQ.data() + kl * ChElementShellANCF_3833::NIP;
+        for (int i = 0; i < 6; i++)
+            for (int j = 0; j < 6; j++)
+                groups[kl].D[6 * i + j] = D(i, j);
+    }
+}
+
+template <>
+void ChElementBatchANCF<ChElementHexaANCF_3843>::GetGroups(ChElementHexaANCF_3843* element,
+                                                           std::vector<_QuadratureGroup>& groups) {
+    const ChMatrixNM<double, 6, 6>& D = element->GetMaterial()->Get_D();
+
+    groups.resize(1);
+    groups[0].col = 0;
+    groups[0].nip = ChElementHexaANCF_3843::NIP;
+    groups[0].kGQ = element->m_kGQ.data();
+    for (int i = 0; i < 6; i++)
+        for (int j = 0; j < 6; j++)
+            groups[0].D[6 * i + j] = D(i, j);
+}
+
+// -----------------------------------------------------------------------------
+
+template <class ELEMENT>
+ChElementBatchANCF<ELEMENT>::ChElementBatchANCF(const std::vector<ELEMENT*>& elements) : m_elements(elements) {
+    // The quadrature point layout is the same for all elements in the batch
+    std::vector<_QuadratureGroup> groups;
+    GetGroups(m_elements[0], groups);
+    int num_groups = (int)groups.size();
+
+    m_nip = 0;
+    for (int g = 0; g < num_groups; g++) {
+        m_group.insert(m_group.end(), groups[g].nip, g);
+        m_nip += groups[g].nip;
+    }
+
+    // Load the element data in structure-of-arrays layout (unused lanes are padded with zeros)
+    int num_elements = (int)m_elements.size();
+    m_blocks.resize((num_elements + W - 1) / W);
+    for (int ib = 0; ib < (int)m_blocks.size(); ib++) {
+        Block& block = m_blocks[ib];
+        block.damping = false;
+        block.sd.assign(m_nip * 3 * NSF * W, 0.0);
+        block.kGQ.assign(m_nip * W, 0.0);
+        block.D.assign(num_groups * 36 * W, 0.0);
+
+        for (int l = 0; l < W; l++) {
+            int ie = ib * W + l;
+            if (ie >= num_elements) {
+                block.elements[l] = nullptr;
+                block.alpha[l] = 0;
+                continue;
+            }
+
+            ELEMENT* element = m_elements[ie];
+            block.elements[l] = element;
+            block.alpha[l] = element->m_damping_enabled ? element->m_Alpha : 0;
+            block.damping |= element->m_damping_enabled;
+
+            GetGroups(element, groups);
+            int q = 0;
+            for (int g = 0; g < num_groups; g++) {
+                const _QuadratureGroup& group = groups[g];
+                for (int u = 0; u < 36; u++)
+                    block.D[(g * 36 + u) * W + l] = group.D[u];
+                for (int k = 0; k < group.nip; k++, q++) {
+                    block.kGQ[q * W + l] = group.kGQ[k];
+                    for (int J = 0; J < 3; J++)
+                        for (int a = 0; a < NSF; a++)
+                            block.sd[((q * 3 + J) * NSF + a) * W + l] = element->m_SD(a, group.col + J * group.nip + k);
+                }
+            }
+        }
+    }
+}
+
+template <class ELEMENT>
+void ChElementBatchANCF<ELEMENT>::GatherCoordinates(const Block& block, double* ebar, double* ebardot) const {
+    typename ELEMENT::Matrix3xN e;
+    for (int l = 0; l < W; l++) {
+        ELEMENT* element = block.elements[l];
+        if (!element) {
+            for (int k = 0; k < 3 * NSF; k++)
+                ebar[k * W + l] = 0;
+            if (ebardot)
+                for (int k = 0; k < 3 * NSF; k++)
+                    ebardot[k * W + l] = 0;
+            continue;
+        }
+
+        element->CalcCoordMatrix(e);
+        for (int i = 0; i < 3; i++)
+            for (int a = 0; a < NSF; a++)
+                ebar[(i * NSF + a) * W + l] = e(i, a);
+
+        if (ebardot) {
+            element->CalcCoordDerivMatrix(e);
+            for (int i = 0; i < 3; i++)
+                for (int a = 0; a < NSF; a++)
+                    ebardot[(i * NSF + a) * W + l] = e(i, a);
+        }
+    }
+}
+
+template <class ELEMENT>
+void ChElementBatchANCF<ELEMENT>::CalcDeformationGradient(const double* ebar, const double* sd, double* F) const {
+    // F(i,J) = sum_a ebar(i,a) * sd(a,J)
+    for (int i = 0; i < 3; i++) {
+        for (int J = 0; J < 3; J++) {
+            double acc[W] = {0};
+            for (int a = 0; a < NSF; a++) {
+                const double* e = ebar + (i * NSF + a) * W;
+                const double* s = sd + (J * NSF + a) * W;
+#pragma omp simd
+                for (int l = 0; l < W; l++)
+                    acc[l] += e[l] * s[l];
+            }
+            for (int l = 0; l < W; l++)
+                F[(i * 3 + J) * W + l] = acc[l];
+        }
+    }
+}
+
+template <class ELEMENT>
+void ChElementBatchANCF<ELEMENT>::CalcStress(const Block& block,
+                                             int q,
+                                             const double* F,
+                                             const double* Fdot,
+                                             double* S) const {
+    static const int I1[6] = {0, 1, 2, 1, 0, 0};
+    static const int I2[6] = {0, 1, 2, 2, 2, 1};
+
+    const double* kGQ = &block.kGQ[q * W];
+    const double* D = &block.D[m_group[q] * 36 * W];
+
+    // Green-Lagrange strains in Voigt notation (plus the damping term for the linear Kelvin-Voigt model), scaled by
+    // minus the quadrature weight times the element Jacobian determinant
+    double E[6 * W];
+    for (int v = 0; v < 6; v++) {
+        int I = I1[v];
+        int J = I2[v];
+#pragma omp simd
+        for (int l = 0; l < W; l++) {
+            double FF = F[I * W + l] * F[J * W + l] + F[(3 + I) * W + l] * F[(3 + J) * W + l] +
+                        F[(6 + I) * W + l] * F[(6 + J) * W + l];
+            E[v * W + l] = (v < 3) ? 0.5 * (FF - 1) : FF;
+        }
+        if (Fdot) {
+#pragma omp simd
+            for (int l = 0; l < W; l++) {
+                double FFdot = F[I * W + l] * Fdot[J * W + l] + F[(3 + I) * W + l] * Fdot[(3 + J) * W + l] +
+                               F[(6 + I) * W + l] * Fdot[(6 + J) * W + l];
+                if (v >= 3)
+                    FFdot += Fdot[I * W + l] * F[J * W + l] + Fdot[(3 + I) * W + l] * F[(3 + J) * W + l] +
+                             Fdot[(6 + I) * W + l] * F[(6 + J) * W + l];
+                E[v * W + l] += block.alpha[l] * FFdot;
+            }
+        }
+#pragma omp simd
+        for (int l = 0; l < W; l++)
+            E[v * W + l] *= kGQ[l];
+    }
+
+    // Scaled 2nd Piola-Kirchhoff stresses in Voigt notation
+    for (int v = 0; v < 6; v++) {
+#pragma omp simd
+        for (int l = 0; l < W; l++) {
+            double s = 0;
+            for (int u = 0; u < 6; u++)
+                s += D[(v * 6 + u) * W + l] * E[u * W + l];
+            S[v * W + l] = s;
+        }
+    }
+}
+
+template <class ELEMENT>
+void ChElementBatchANCF<ELEMENT>::ComputeInternalForces(const Block& block, double* Qi) const {
+    double ebar[3 * NSF * W];
+    double ebardot[3 * NSF * W];
+    double F[9 * W];
+    double Fdot[9 * W];
+    double S[6 * W];
+    double P[9 * W];
+
+    GatherCoordinates(block, ebar, block.damping ? ebardot : nullptr);
+    std::fill(Qi, Qi + NDOF * W, 0.0);
+
+    for (int q = 0; q < m_nip; q++) {
+        const double* sd = &block.sd[q * 3 * NSF * W];
+
+        CalcDeformationGradient(ebar, sd, F);
+        if (block.damping)
+            CalcDeformationGradient(ebardot, sd, Fdot);
+        CalcStress(block, q, F, block.damping ? Fdot : nullptr, S);
+
+        // Scaled 1st Piola-Kirchhoff stresses, P = F * SPK2
+        for (int i = 0; i < 3; i++) {
+            for (int J = 0; J < 3; J++) {
+#pragma omp simd
+                for (int l = 0; l < W; l++) {
+                    P[(i * 3 + J) * W + l] = F[(i * 3 + 0) * W + l] * S[_voigt[0][J] * W + l] +
+                                             F[(i * 3 + 1) * W + l] * S[_voigt[1][J] * W + l] +
+                                             F[(i * 3 + 2) * W + l] * S[_voigt[2][J] * W + l];
+                }
+            }
+        }
+
+        // Generalized internal forces, Qi(a,i) += sum_J sd(a,J) * P(i,J)
+        for (int a = 0; a < NSF; a++) {
+            const double* s0 = sd + (0 * NSF + a) * W;
+            const double* s1 = sd + (1 * NSF + a) * W;
+            const double* s2 = sd + (2 * NSF + a) * W;
+            for (int i = 0; i < 3; i++) {
+                double* Q = Qi + (a * 3 + i) * W;
+#pragma omp simd
+                for (int l = 0; l < W; l++)
+                    Q[l] += s0[l] * P[(i * 3 + 0) * W + l] + s1[l] * P[(i * 3 + 1) * W + l] +
+                            s2[l] * P[(i * 3 + 2) * W + l];
+            }
+        }
+    }
+}
+
+template <class ELEMENT>
+void ChElementBatchANCF<ELEMENT>::ComputeInternalJacobians(const Block& block,
+                                                           double Kfactor,
+                                                           double Rfactor,
+                                                           double* H) const {
+    // Jacobian of Qi = sum_q B^T * SPK2 (with SPK2 = D * (E + alpha * Edot)):
+    //   Kfactor * dQi/de + Rfactor * dQi/dedot =
+    //   sum_q B^T * D * ((Kfactor + alpha * Rfactor) * B + Kfactor * alpha * Bdot) + Kfactor * G
+    // where B = dE/de, Bdot = dEdot/de, and G is the geometric stiffness contribution.
+    bool symmetric = !block.damping;
+
+    double ebar[3 * NSF * W];
+    double ebardot[3 * NSF * W];
+    double F[9 * W];
+    double Fdot[9 * W];
+    double S[6 * W];
+    double B[6 * NDOF * W];
+    double Bdot[6 * NDOF * W];
+    double C[6 * NDOF * W];
+    double T[3 * NSF * W];
+
+    double cB[W];
+    double cBdot[W];
+    for (int l = 0; l < W; l++) {
+        cB[l] = Kfactor + block.alpha[l] * Rfactor;
+        cBdot[l] = Kfactor * block.alpha[l];
+    }
+
+    GatherCoordinates(block, ebar, block.damping ? ebardot : nullptr);
+    std::fill(H, H + NDOF * NDOF * W, 0.0);
+
+    for (int q = 0; q < m_nip; q++) {
+        const double* sd = &block.sd[q * 3 * NSF * W];
+        const double* kGQ = &block.kGQ[q * W];
+        const double* D = &block.D[m_group[q] * 36 * W];
+
+        CalcDeformationGradient(ebar, sd, F);
+        if (block.damping)
+            CalcDeformationGradient(ebardot, sd, Fdot);
+        CalcStress(block, q, F, block.damping ? Fdot : nullptr, S);
+
+        // Partial derivatives of the Green-Lagrange strains (Voigt notation) with respect to the nodal coordinates
+        for (int a = 0; a < NSF; a++) {
+            const double* s0 = sd + (0 * NSF + a) * W;
+            const double* s1 = sd + (1 * NSF + a) * W;
+            const double* s2 = sd + (2 * NSF + a) * W;
+            for (int k = 0; k < 3; k++) {
+                int r = a * 3 + k;
+                const double* f = F + k * 3 * W;
+#pragma omp simd
+                for (int l = 0; l < W; l++) {
+                    B[(0 * NDOF + r) * W + l] = s0[l] * f[0 * W + l];
+                    B[(1 * NDOF + r) * W + l] = s1[l] * f[1 * W + l];
+                    B[(2 * NDOF + r) * W + l] = s2[l] * f[2 * W + l];
+                    B[(3 * NDOF + r) * W + l] = s1[l] * f[2 * W + l] + s2[l] * f[1 * W + l];
+                    B[(4 * NDOF + r) * W + l] = s0[l] * f[2 * W + l] + s2[l] * f[0 * W + l];
+                    B[(5 * NDOF + r) * W + l] = s0[l] * f[1 * W + l] + s1[l] * f[0 * W + l];
+                }
+                if (block.damping) {
+                    const double* fdot = Fdot + k * 3 * W;
+#pragma omp simd
+                    for (int l = 0; l < W; l++) {
+                        Bdot[(0 * NDOF + r) * W + l] = s0[l] * fdot[0 * W + l];
+                        Bdot[(1 * NDOF + r) * W + l] = s1[l] * fdot[1 * W + l];
+                        Bdot[(2 * NDOF + r) * W + l] = s2[l] * fdot[2 * W + l];
+                        Bdot[(3 * NDOF + r) * W + l] = s1[l] * fdot[2 * W + l] + s2[l] * fdot[1 * W + l];
+                        Bdot[(4 * NDOF + r) * W + l] = s0[l] * fdot[2 * W + l] + s2[l] * fdot[0 * W + l];
+                        Bdot[(5 * NDOF + r) * W + l] = s0[l] * fdot[1 * W + l] + s1[l] * fdot[0 * W + l];
+                    }
+                }
+            }
+        }
+
+        // Scaled strain derivatives, C = kGQ * (cB * B + cBdot * Bdot)
+        for (int u = 0; u < 6; u++) {
+            for (int r = 0; r < NDOF; r++) {
+                double* c = C + (u * NDOF + r) * W;
+                const double* b = B + (u * NDOF + r) * W;
+#pragma omp simd
+                for (int l = 0; l < W; l++)
+                    c[l] = kGQ[l] * cB[l] * b[l];
+                if (block.damping) {
+                    const double* bdot = Bdot + (u * NDOF + r) * W;
+#pragma omp simd
+                    for (int l = 0; l < W; l++)
+                        c[l] += kGQ[l] * cBdot[l] * bdot[l];
+                }
+            }
+        }
+
+        // Material contribution, H += B^T * D * C
+        // First overwrite the columns of Bdot (no longer needed) with DC = D * C.
+        double* DC = Bdot;
+        for (int v = 0; v < 6; v++) {
+            for (int r = 0; r < NDOF; r++) {
+#pragma omp simd
+                for (int l = 0; l < W; l++) {
+                    double s = 0;
+                    for (int u = 0; u < 6; u++)
+                        s += D[(v * 6 + u) * W + l] * C[(u * NDOF + r) * W + l];
+                    DC[(v * NDOF + r) * W + l] = s;
+                }
+            }
+        }
+        for (int r = 0; r < NDOF; r++) {
+            for (int c = symmetric ? r : 0; c < NDOF; c++) {
+                double* h = H + (r * NDOF + c) * W;
+#pragma omp simd
+                for (int l = 0; l < W; l++) {
+                    double s = 0;
+                    for (int v = 0; v < 6; v++)
+                        s += B[(v * NDOF + r) * W + l] * DC[(v * NDOF + c) * W + l];
+                    h[l] += s;
+                }
+            }
+        }
+
+        // Geometric contribution, H(3a+i, 3b+i) += Kfactor * sum_IJ sd(a,I) * SPK2(I,J) * sd(b,J)
+        for (int b = 0; b < NSF; b++) {
+            for (int I = 0; I < 3; I++) {
+#pragma omp simd
+                for (int l = 0; l < W; l++) {
+                    T[(I * NSF + b) * W + l] = S[_voigt[I][0] * W + l] * sd[(0 * NSF + b) * W + l] +
+                                               S[_voigt[I][1] * W + l] * sd[(1 * NSF + b) * W + l] +
+                                               S[_voigt[I][2] * W + l] * sd[(2 * NSF + b) * W + l];
+                }
+            }
+        }
+        for (int a = 0; a < NSF; a++) {
+            for (int b = symmetric ? a : 0; b < NSF; b++) {
+                double g[W];
+#pragma omp simd
+                for (int l = 0; l < W; l++) {
+                    g[l] = Kfactor * (sd[(0 * NSF + a) * W + l] * T[(0 * NSF + b) * W + l] +
+                                      sd[(1 * NSF + a) * W + l] * T[(1 * NSF + b) * W + l] +
+                                      sd[(2 * NSF + a) * W + l] * T[(2 * NSF + b) * W + l]);
+                }
+                for (int i = 0; i < 3; i++) {
+                    double* h = H + ((3 * a + i) * NDOF + 3 * b + i) * W;
+#pragma omp simd
+                    for (int l = 0; l < W; l++)
+                        h[l] += g[l];
+                }
+            }
+        }
+    }
+}
+
+template <class ELEMENT>
+void ChElementBatchANCF<ELEMENT>::LoadResidual_F(ChVectorDynamic<>& R, const double c, int nthreads) {
+#pragma omp parallel num_threads(nthreads)
+    {
+        std::vector<double> Qi(NDOF * W);
+
+#pragma omp for schedule(dynamic)
+        for (int ib = 0; ib < (int)m_blocks.size(); ib++) {
+            const Block& block = m_blocks[ib];
+            ComputeInternalForces(block, Qi.data());
+
+            // Scatter the internal forces of each element (atomic, as elements in different blocks share nodes)
+            for (int l = 0; l < W; l++) {
+                ELEMENT* element = block.elements[l];
+                if (!element)
+                    continue;
+                int stride = 0;
+                for (int in = 0; in < element->GetNnodes(); in++) {
+                    int nodedofs = element->GetNodeNdofs(in);
+                    if (!element->GetNodeN(in)->GetFixed()) {
+                        unsigned int offset = element->GetNodeN(in)->NodeGetOffset_w();
+                        for (int j = 0; j < nodedofs; j++)
+#pragma omp atomic
+                            R(offset + j) += c * Qi[(stride + j) * W + l];
+                    }
+                    stride += nodedofs;
+                }
+            }
+        }
+    }
+}
+
+template <class ELEMENT>
+void ChElementBatchANCF<ELEMENT>::LoadKRMmatrices(double Kfactor, double Rfactor, double Mfactor, int nthreads) {
+#pragma omp parallel num_threads(nthreads)
+    {
+        std::vector<double> H(NDOF * NDOF * W);
+
+#pragma omp for schedule(dynamic)
+        for (int ib = 0; ib < (int)m_blocks.size(); ib++) {
+            const Block& block = m_blocks[ib];
+            bool symmetric = !block.damping;
+
+            // Note: the internal forces are the negative of the elastic forces, hence the sign of the factors
+            ComputeInternalJacobians(block, -Kfactor, -Rfactor, H.data());
+
+            for (int l = 0; l < W; l++) {
+                ELEMENT* element = block.elements[l];
+                if (!element)
+                    continue;
+                ChMatrixRef K = element->Kstiffness().Get_K();
+                for (int r = 0; r < NDOF; r++) {
+                    for (int c = 0; c < NDOF; c++) {
+                        K(r, c) = (symmetric && c < r) ? H[(c * NDOF + r) * W + l] : H[(r * NDOF + c) * W + l];
+                    }
+                }
+
+                // Add in the mass matrix which is stored in compact upper triangular form
+                unsigned int idx = 0;
+                for (unsigned int i = 0; i < NSF; i++) {
+                    for (unsigned int j = i; j < NSF; j++) {
+                        double m = Mfactor * element->m_MassMatrix(idx);
+                        K(3 * i, 3 * j) += m;
+                        K(3 * i + 1, 3 * j + 1) += m;
+                        K(3 * i + 2, 3 * j + 2) += m;
+                        if (i != j) {
+                            K(3 * j, 3 * i) += m;
+                            K(3 * j + 1, 3 * i + 1) += m;
+                            K(3 * j + 2, 3 * i + 2) += m;
+                        }
+                        idx++;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Collect the batchable elements of the given type in batches (one batch per quadrature point layout).
+template <class ELEMENT>
+static void _CreateBatches(const std::vector<std::shared_ptr<ChElementBase>>& elements,
+                           std::vector<std::shared_ptr<ChElementBatch>>& batches,
+                           std::vector<bool>& batched) {
+    std::map<size_t, std::vector<ELEMENT*>> layouts;
+    std::vector<_QuadratureGroup> groups;
+    for (size_t ie = 0; ie < elements.size(); ie++) {
+        auto element = dynamic_cast<ELEMENT*>(elements[ie].get());
+        if (!element || !ChElementBatchANCF<ELEMENT>::IsBatchable(element))
+            continue;
+        ChElementBatchANCF<ELEMENT>::GetGroups(element, groups);
+        layouts[groups.size()].push_back(element);
+        batched[ie] = true;
+    }
+
+    for (const auto& layout : layouts)
+        batches.push_back(chrono_types::make_shared<ChElementBatchANCF<ELEMENT>>(layout.second));
+}
+
+void ChElementBatch::CreateBatchesANCF(const std::vector<std::shared_ptr<ChElementBase>>& elements,
+                                       std::vector<std::shared_ptr<ChElementBatch>>& batches,
+                                       std::vector<bool>& batched) {
+    batches.clear();
+    batched.assign(elements.size(), false);
+
+    _CreateBatches<ChElementBeamANCF_3333>(elements, batches, batched);
+    _CreateBatches<ChElementShellANCF_3833>(elements, batches, batched);
+    _CreateBatches<ChElementHexaANCF_3843>(elements, batches, batched);
+}
+
+}  // end namespace fea
+}  // end namespace chrono
@@ -0,0 +1,61 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHELEMENTBATCH_H
+#define CHELEMENTBATCH_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChMatrix.h"
+#include "chrono/fea/ChElementBase.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_elements
+/// @{
+
+/// Base class for a batch of finite elements of the same type whose internal forces and Jacobians are evaluated
+/// together rather than one element at a time.
+/// Batches are created and used by a ChMesh (see ChMesh::EnableBatchedANCF).
+class ChApi ChElementBatch {
+  public:
+    virtual ~ChElementBatch() {}
+
+    /// Get the number of elements in this batch.
+    virtual unsigned int GetNumElements() const = 0;
+
+    /// Add the internal forces of all elements in this batch, scaled by c, to the global residual R.
+    virtual void LoadResidual_F(ChVectorDynamic<>& R, const double c, int nthreads) = 0;
+
+    /// Load the K, R, M matrices (scaled by Kfactor, Rfactor, Mfactor) of all elements in this batch in the
+    /// stiffness blocks of the elements.
+    virtual void LoadKRMmatrices(double Kfactor, double Rfactor, double Mfactor, int nthreads) = 0;
+
+    /// Group the given elements in batches of same-type ANCF elements.
+    /// Currently supported are ChElementBeamANCF_3333, ChElementShellANCF_3833, and ChElementHexaANCF_3843 elements
+    /// which use the "Continuous Integration" method for the internal forces. On return, 'batched' flags the elements
+    /// included in one of the created batches.
+    static void CreateBatchesANCF(const std::vector<std::shared_ptr<ChElementBase>>& elements,
+                                  std::vector<std::shared_ptr<ChElementBatch>>& batches,
+                                  std::vector<bool>& batched);
+};
+
+/// @} fea_elements
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
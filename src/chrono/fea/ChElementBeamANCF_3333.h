@@ -310,6 +310,10 @@ class ChApi ChElementBeamANCF_3333 : public ChElementBeam, public ChLoadableU, p
     ChVector<> ComputeTangent(const double xi);
 
   private:
+    /// The batched evaluation of internal forces and Jacobians accesses the precomputed element data.
+    template <class ELEMENT>
+    friend class ChElementBatchANCF;
+
     /// Initial setup. This is used to precompute matrices that do not change during the simulation, such as the local
     /// stiffness of each element (if any), the mass, etc.
     virtual void SetupInitial(ChSystem* system) override;
@@ -0,0 +1,336 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <cmath>
+#include <unordered_map>
+
+#include "chrono/core/ChException.h"
+#include "chrono/fea/ChElementCraigBampton.h"
+
+#include <Eigen/Eigenvalues>
+#include <Eigen/SparseCholesky>
+
+namespace chrono {
+namespace fea {
+
+typedef Eigen::SparseMatrix<double> _SparseMatrix;
+typedef Eigen::Triplet<double> _Triplet;
+
+ChElementCraigBampton::ChElementCraigBampton() {}
+
+// -----------------------------------------------------------------------------
+
+// Split a full mesh matrix (symmetric) in its boundary-boundary, boundary-interior, and interior-interior blocks.
+ChElementCraigBampton::Partition ChElementCraigBampton::PartitionMatrix(const Eigen::SparseMatrix<double>& A,
+                                                                        const std::vector<int>& local,
+                                                                        const std::vector<bool>& is_boundary,
+                                                                        int nb,
+                                                                        int ni) {
+    std::vector<_Triplet> bb_triplets;
+    std::vector<_Triplet> bi_triplets;
+    std::vector<_Triplet> ii_triplets;
+    for (int c = 0; c < A.outerSize(); c++) {
+        for (_SparseMatrix::InnerIterator it(A, c); it; ++it) {
+            int r = (int)it.row();
+            if (is_boundary[r] && is_boundary[c])
+                bb_triplets.push_back(_Triplet(local[r], local[c], it.value()));
+            else if (is_boundary[r])
+                bi_triplets.push_back(_Triplet(local[r], local[c], it.value()));
+            else if (!is_boundary[c])
+                ii_triplets.push_back(_Triplet(local[r], local[c], it.value()));
+        }
+    }
+    Partition P;
+    P.bb.resize(nb, nb);
+    P.bi.resize(nb, ni);
+    P.ii.resize(ni, ni);
+    P.bb.setFromTriplets(bb_triplets.begin(), bb_triplets.end());
+    P.bi.setFromTriplets(bi_triplets.begin(), bi_triplets.end());
+    P.ii.setFromTriplets(ii_triplets.begin(), ii_triplets.end());
+    return P;
+}
+
+// Project a (symmetric) full mesh matrix A onto the reduction basis T = [I 0; Psi Phi], with the static constraint
+// modes Psi = -Kii^(-1) * Kib. Psi is never formed: its columns are evaluated in blocks of boundary DOFs, and its
+// products with other matrices are evaluated as Psi' * Y = -Kib' * Kii^(-1) * Y, so that the memory is bounded by a
+// few dense matrices with as many columns as the block size (or the number of modes).
+ChMatrixDynamic<> ChElementCraigBampton::ReduceMatrix(const Partition& A,
+                                                      const Eigen::SparseMatrix<double>& Kib,
+                                                      const Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>>& Kii_solver,
+                                                      const Eigen::MatrixXd& Phi) {
+    const int block_size = 32;
+    int nb = (int)A.bb.rows();
+    int nm = (int)Phi.cols();
+    _SparseMatrix Aib = A.bi.transpose();
+
+    ChMatrixDynamic<> Ar(nb + nm, nb + nm);
+
+    // Boundary-boundary block: Abb + Abi * Psi + Psi' * (Aib + Aii * Psi)
+    for (int j0 = 0; j0 < nb; j0 += block_size) {
+        int nj = std::min(block_size, nb - j0);
+        Eigen::MatrixXd Kib_J(Kib.middleCols(j0, nj));
+        Eigen::MatrixXd Psi_J = -Kii_solver.solve(Kib_J);
+        Eigen::MatrixXd W_J(Aib.middleCols(j0, nj));
+        W_J += A.ii * Psi_J;
+        Eigen::MatrixXd Abb_J(A.bb.middleCols(j0, nj));
+        Ar.block(0, j0, nb, nj) = Abb_J + A.bi * Psi_J - Kib.transpose() * Kii_solver.solve(W_J);
+    }
+
+    // Boundary-modal block: (Abi + Psi' * Aii) * Phi
+    Eigen::MatrixXd AiiPhi = A.ii * Phi;
+    Ar.block(0, nb, nb, nm) = A.bi * Phi - Kib.transpose() * Kii_solver.solve(AiiPhi);
+    Ar.block(nb, 0, nm, nb) = Ar.block(0, nb, nb, nm).transpose();
+
+    // Modal-modal block: Phi' * Aii * Phi
+    Ar.block(nb, nb, nm, nm) = Phi.transpose() * AiiPhi;
+
+    return 0.5 * (Ar + Ar.transpose());
+}
+
+// -----------------------------------------------------------------------------
+
+void ChElementCraigBampton::Initialize(std::shared_ptr<ChMesh> mesh,
+                                       const std::vector<std::shared_ptr<ChNodeFEAxyz>>& boundary_nodes,
+                                       int num_modes) {
+    // Index the nodes of the full mesh (3 DOFs per node)
+    int num_nodes = (int)mesh->GetNnodes();
+    std::unordered_map<ChNodeFEAbase*, int> node_index;
+    for (int i = 0; i < num_nodes; i++) {
+        if (!std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh->GetNodes()[i]))
+            throw ChException("ChElementCraigBampton: the mesh must contain only ChNodeFEAxyz nodes");
+        node_index[mesh->GetNodes()[i].get()] = i;
+    }
+    int n = 3 * num_nodes;
+
+    // Assemble the stiffness, damping, and mass matrices of the full mesh in the reference configuration
+    mesh->SetupInitial();
+    std::vector<_Triplet> K_triplets;
+    std::vector<_Triplet> R_triplets;
+    std::vector<_Triplet> M_triplets;
+    for (auto& element : mesh->GetElements()) {
+        element->Update();
+
+        int ndofs = element->GetNdofs();
+        std::vector<int> dofs(ndofs);
+        for (int in = 0; in < element->GetNnodes(); in++) {
+            auto it = node_index.find(element->GetNodeN(in).get());
+            if (it == node_index.end() || element->GetNodeNdofs(in) != 3)
+                throw ChException("ChElementCraigBampton: element nodes must be ChNodeFEAxyz nodes of the mesh");
+            for (int k = 0; k < 3; k++)
+                dofs[3 * in + k] = 3 * it->second + k;
+        }
+
+        ChMatrixDynamic<> Ke = ChMatrixDynamic<>::Zero(ndofs, ndofs);
+        ChMatrixDynamic<> Re = ChMatrixDynamic<>::Zero(ndofs, ndofs);
+        ChMatrixDynamic<> Me = ChMatrixDynamic<>::Zero(ndofs, ndofs);
+        element->ComputeKRMmatricesGlobal(Ke, 1, 0, 0);
+        element->ComputeKRMmatricesGlobal(Re, 0, 1, 0);
+        element->ComputeKRMmatricesGlobal(Me, 0, 0, 1);
+        for (int r = 0; r < ndofs; r++) {
+            for (int c = 0; c < ndofs; c++) {
+                if (Ke(r, c) != 0)
+                    K_triplets.push_back(_Triplet(dofs[r], dofs[c], Ke(r, c)));
+                if (Re(r, c) != 0)
+                    R_triplets.push_back(_Triplet(dofs[r], dofs[c], Re(r, c)));
+                if (Me(r, c) != 0)
+                    M_triplets.push_back(_Triplet(dofs[r], dofs[c], Me(r, c)));
+            }
+        }
+    }
+    _SparseMatrix K(n, n);
+    _SparseMatrix R(n, n);
+    _SparseMatrix M(n, n);
+    K.setFromTriplets(K_triplets.begin(), K_triplets.end());
+    R.setFromTriplets(R_triplets.begin(), R_triplets.end());
+    M.setFromTriplets(M_triplets.begin(), M_triplets.end());
+
+    // Partition the DOFs of the full mesh in boundary (b) and interior (i) DOFs.
+    // Boundary DOFs are numbered in the order of the specified boundary nodes.
+    std::vector<int> local(n, -1);  // index of a full mesh DOF in its partition
+    std::vector<bool> is_boundary(n, false);
+    int nb = 3 * (int)boundary_nodes.size();
+    for (int ib = 0; ib < (int)boundary_nodes.size(); ib++) {
+        auto it = node_index.find(boundary_nodes[ib].get());
+        if (it == node_index.end() || is_boundary[3 * it->second])
+            throw ChException("ChElementCraigBampton: invalid or duplicate boundary node");
+        for (int k = 0; k < 3; k++) {
+            local[3 * it->second + k] = 3 * ib + k;
+            is_boundary[3 * it->second + k] = true;
+        }
+    }
+    int ni = 0;
+    for (int j = 0; j < n; j++) {
+        if (!is_boundary[j])
+            local[j] = ni++;
+    }
+
+    if (num_modes < 1 || num_modes > ni)
+        throw ChException("ChElementCraigBampton: invalid number of modes");
+
+    // Partition the full mesh matrices in boundary-boundary, boundary-interior, and interior-interior blocks
+    Partition Kp = PartitionMatrix(K, local, is_boundary, nb, ni);
+    Partition Rp = PartitionMatrix(R, local, is_boundary, nb, ni);
+    Partition Mp = PartitionMatrix(M, local, is_boundary, nb, ni);
+
+    _SparseMatrix Kib = Kp.bi.transpose();
+    m_Kii_solver = chrono_types::make_shared<Eigen::SimplicialLDLT<_SparseMatrix>>(Kp.ii);
+    if (m_Kii_solver->info() != Eigen::Success)
+        throw ChException("ChElementCraigBampton: singular interior stiffness matrix (insufficient boundary nodes?)");
+    const auto& Kii_solver = *m_Kii_solver;
+    const _SparseMatrix& Mii = Mp.ii;
+
+    // Fixed-interface normal modes: lowest eigenpairs of Kii * phi = omega^2 * Mii * phi, obtained with subspace
+    // iteration. The subspace is larger than the number of requested modes to accelerate convergence.
+    int p = std::min(ni, std::max(2 * num_modes, num_modes + 8));
+    Eigen::MatrixXd X(ni, p);
+    for (int i = 0; i < ni; i++) {
+        for (int j = 0; j < p; j++)
+            X(i, j) = (j == 0) ? 1.0 : std::sin(1.0 + (i + 1) * (j + 1) * 0.7);
+    }
+    Eigen::VectorXd lambda = Eigen::VectorXd::Zero(num_modes);
+    for (int iter = 0; iter < 200; iter++) {
+        Eigen::MatrixXd MX = Mii * X;
+        Eigen::MatrixXd Y = Kii_solver.solve(MX);
+        Eigen::MatrixXd Kr = Y.transpose() * MX;
+        Eigen::MatrixXd Mr = Y.transpose() * (Mii * Y);
+        Kr = 0.5 * (Kr + Kr.transpose()).eval();
+        Mr = 0.5 * (Mr + Mr.transpose()).eval();
+
+        Eigen::GeneralizedSelfAdjointEigenSolver<Eigen::MatrixXd> eig(Kr, Mr);
+        if (eig.info() != Eigen::Success)
+            throw ChException("ChElementCraigBampton: eigenvalue computation failed");
+
+        X = Y * eig.eigenvectors();
+        Eigen::VectorXd lambda_new = eig.eigenvalues().head(num_modes);
+        bool converged = (lambda_new - lambda).cwiseAbs().maxCoeff() <= 1e-10 * lambda_new.cwiseAbs().maxCoeff();
+        lambda = lambda_new;
+        if (converged)
+            break;
+    }
+    Eigen::MatrixXd Phi = X.leftCols(num_modes);
+    X.resize(0, 0);
+
+    m_freq.resize(num_modes);
+    for (int k = 0; k < num_modes; k++)
+        m_freq(k) = std::sqrt(std::max(lambda(k), 0.0)) / CH_C_2PI;
+
+    // Reduced matrices (the static constraint modes are evaluated in blocks of boundary DOFs, see ReduceMatrix)
+    m_K = ReduceMatrix(Kp, Kib, Kii_solver, Phi);
+    m_R = ReduceMatrix(Rp, Kib, Kii_solver, Phi);
+    m_M = ReduceMatrix(Mp, Kib, Kii_solver, Phi);
+
+    // Reduced gravity loads: T' * M * g, for unit accelerations g along each axis
+    Eigen::MatrixXd G = Eigen::MatrixXd::Zero(n, 3);
+    for (int i = 0; i < num_nodes; i++) {
+        for (int k = 0; k < 3; k++)
+            G(3 * i + k, k) = 1;
+    }
+    Eigen::MatrixXd MG = M * G;
+    Eigen::MatrixXd MGb(nb, 3);
+    Eigen::MatrixXd MGi(ni, 3);
+    for (int j = 0; j < n; j++) {
+        if (is_boundary[j])
+            MGb.row(local[j]) = MG.row(j);
+        else
+            MGi.row(local[j]) = MG.row(j);
+    }
+    m_G.resize(nb + num_modes, 3);
+    m_G.topRows(nb) = MGb - Kib.transpose() * Kii_solver.solve(MGi);
+    m_G.bottomRows(num_modes) = Phi.transpose() * MGi;
+
+    // Data for the recovery of the full mesh displacements: interior-boundary stiffness block, modal basis (in single
+    // precision), and the partition of the full mesh DOFs
+    m_Kib = Kib;
+    m_Phi = Phi.cast<float>();
+    m_local = local;
+    m_is_boundary = is_boundary;
+
+    // Connect the element to the boundary nodes and to the modal node
+    m_boundary_nodes = boundary_nodes;
+    m_boundary_pos0.clear();
+    for (auto& node : m_boundary_nodes)
+        m_boundary_pos0.push_back(node->GetX0());
+    m_modal_node = chrono_types::make_shared<ChNodeFEAmodal>(num_modes);
+
+    std::vector<ChVariables*> mvars;
+    for (auto& node : m_boundary_nodes)
+        mvars.push_back(&node->Variables());
+    mvars.push_back(&m_modal_node->Variables());
+    Kmatr.SetVariables(mvars);
+}
+
+// -----------------------------------------------------------------------------
+
+std::shared_ptr<ChNodeFEAbase> ChElementCraigBampton::GetNodeN(int n) {
+    if (n < (int)m_boundary_nodes.size())
+        return m_boundary_nodes[n];
+    return m_modal_node;
+}
+
+void ChElementCraigBampton::GetStateBlock(ChVectorDynamic<>& mD) {
+    int nb = (int)m_boundary_nodes.size();
+    mD.resize(GetNdofs());
+    for (int i = 0; i < nb; i++)
+        mD.segment(3 * i, 3) = (m_boundary_nodes[i]->GetPos() - m_boundary_pos0[i]).eigen();
+    mD.tail(GetNumModes()) = m_modal_node->GetModalCoordinates();
+}
+
+void ChElementCraigBampton::GetStateBlock_dt(ChVectorDynamic<>& mD_dt) {
+    int nb = (int)m_boundary_nodes.size();
+    mD_dt.resize(GetNdofs());
+    for (int i = 0; i < nb; i++)
+        mD_dt.segment(3 * i, 3) = m_boundary_nodes[i]->GetPos_dt().eigen();
+    mD_dt.tail(GetNumModes()) = m_modal_node->GetModalCoordinates_dt();
+}
+
+void ChElementCraigBampton::GetFullDisplacements(ChVectorDynamic<>& u) const {
+    int nb = (int)m_boundary_nodes.size();
+    ChVectorDynamic<> q(3 * nb + GetNumModes());
+    for (int i = 0; i < nb; i++)
+        q.segment(3 * i, 3) = (m_boundary_nodes[i]->GetPos() - m_boundary_pos0[i]).eigen();
+    const auto& eta = m_modal_node->GetModalCoordinates();
+
+    // Interior displacements: Psi * ub + Phi * eta, with Psi * ub = -Kii^(-1) * Kib * ub
+    ChVectorDynamic<> ub = q.head(3 * nb);
+    ChVectorDynamic<> ui = -m_Kii_solver->solve(m_Kib * ub);
+    for (int k = 0; k < GetNumModes(); k++)
+        ui += eta(k) * m_Phi.col(k).cast<double>();
+
+    int n = (int)m_local.size();
+    u.resize(n);
+    for (int j = 0; j < n; j++)
+        u(j) = m_is_boundary[j] ? ub(m_local[j]) : ui(m_local[j]);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChElementCraigBampton::ComputeKRMmatricesGlobal(ChMatrixRef H, double Kfactor, double Rfactor, double Mfactor) {
+    assert((H.rows() == GetNdofs()) && (H.cols() == GetNdofs()));
+    H = Kfactor * m_K + Rfactor * m_R + Mfactor * m_M;
+}
+
+void ChElementCraigBampton::ComputeInternalForces(ChVectorDynamic<>& Fi) {
+    ChVectorDynamic<> q;
+    ChVectorDynamic<> q_dt;
+    GetStateBlock(q);
+    GetStateBlock_dt(q_dt);
+    Fi = -(m_K * q + m_R * q_dt);
+}
+
+void ChElementCraigBampton::ComputeGravityForces(ChVectorDynamic<>& Fg, const ChVector<>& G_acc) {
+    Fg = m_G * G_acc.eigen();
+}
+
+}  // end namespace fea
+}  // end namespace chrono
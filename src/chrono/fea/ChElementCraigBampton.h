@@ -0,0 +1,176 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHELEMENTCRAIGBAMPTON_H
+#define CHELEMENTCRAIGBAMPTON_H
+
+#include <vector>
+
+#include "chrono/fea/ChElementGeneric.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/fea/ChNodeFEAmodal.h"
+#include "chrono/fea/ChNodeFEAxyz.h"
+
+#include <Eigen/SparseCholesky>
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_elements
+/// @{
+
+/// Reduced-order substructure element obtained with the Craig-Bampton method.\n
+/// A mesh of linear elastic elements with xyz nodes (e.g., ChElementTetraCorot_4 or ChElementHexaCorot_8) is reduced
+/// to the DOFs of a set of boundary nodes plus the amplitudes of a few fixed-interface normal modes. The reduction
+/// basis consists of the static constraint modes (the response of the interior nodes to unit displacements of the
+/// boundary DOFs) and of the lowest normal modes of the component with all boundary nodes fixed. The reduced stiffness,
+/// damping, and mass matrices and the reduced gravity loads are precomputed in #Initialize.
+///
+/// The element connects the boundary nodes (which are shared with the rest of the model, e.g. through links to rigid
+/// bodies) and a ChNodeFEAmodal node carrying the modal coordinates. The interior nodes of the full mesh are discarded.
+/// Usage:
+/// <pre>
+///   auto element = chrono_types::make_shared<ChElementCraigBampton>();
+///   element->Initialize(full_mesh, boundary_nodes, num_modes);
+///   auto mesh = chrono_types::make_shared<ChMesh>();
+///   for (auto& node : boundary_nodes)
+///       mesh->AddNode(node);
+///   mesh->AddNode(element->GetModalNode());
+///   mesh->AddElement(element);
+///   system.Add(mesh);
+/// </pre>
+/// The reduced model is linear; it is valid for small displacements of the component with respect to its reference
+/// configuration.
+///
+/// Only the reduced matrices, the fixed-interface modes (in single precision), the interior-boundary stiffness block,
+/// and the sparse factorization of the interior stiffness matrix are retained, so that the memory used by the element
+/// does not grow with the product of the numbers of interior and boundary DOFs. The static constraint modes are never
+/// stored; the displacements of the interior nodes are recovered on demand (see GetFullDisplacements).
+class ChApi ChElementCraigBampton : public ChElementGeneric {
+  public:
+    ChElementCraigBampton();
+    ~ChElementCraigBampton() {}
+
+    /// Compute the reduced model of the given mesh.
+    /// The mesh (which should not be added to a system) must contain only elements with ChNodeFEAxyz nodes. The
+    /// boundary nodes must belong to the mesh and must be sufficient to eliminate the rigid body motion of the
+    /// component. On return, the element is connected to the boundary nodes and to a new modal node with 'num_modes'
+    /// modal coordinates. A ChException is thrown if the reduction fails.
+    void Initialize(std::shared_ptr<ChMesh> mesh,
+                    const std::vector<std::shared_ptr<ChNodeFEAxyz>>& boundary_nodes,
+                    int num_modes);
+
+    /// Get the node carrying the modal coordinates.
+    std::shared_ptr<ChNodeFEAmodal> GetModalNode() const { return m_modal_node; }
+
+    /// Get the number of boundary nodes.
+    int GetNumBoundaryNodes() const { return (int)m_boundary_nodes.size(); }
+
+    /// Get the number of fixed-interface modes retained in the reduced model.
+    int GetNumModes() const { return m_modal_node ? m_modal_node->GetNumModes() : 0; }
+
+    /// Get the natural frequencies (in Hz) of the fixed-interface modes retained in the reduced model.
+    const ChVectorDynamic<>& GetFrequencies() const { return m_freq; }
+
+    /// Get the reduced stiffness matrix (boundary DOFs first, then modal coordinates).
+    const ChMatrixDynamic<>& GetReducedStiffness() const { return m_K; }
+
+    /// Get the reduced mass matrix (boundary DOFs first, then modal coordinates).
+    const ChMatrixDynamic<>& GetReducedMass() const { return m_M; }
+
+    /// Get the reduced damping matrix (boundary DOFs first, then modal coordinates).
+    const ChMatrixDynamic<>& GetReducedDamping() const { return m_R; }
+
+    /// Recover the displacements of all nodes of the full mesh from the current state of the reduced model.
+    /// The displacements are returned as 3 values per node, in the order of the nodes in the full mesh. The interior
+    /// displacements are evaluated with one solve with the factorized interior stiffness matrix.
+    void GetFullDisplacements(ChVectorDynamic<>& u) const;
+
+    /// Get the number of nodes used by this element.
+    virtual int GetNnodes() override { return (int)m_boundary_nodes.size() + 1; }
+
+    /// Get the number of coordinates in the field used by the referenced nodes.
+    virtual int GetNdofs() override { return 3 * (int)m_boundary_nodes.size() + GetNumModes(); }
+
+    /// Get the number of coordinates from the n-th node used by this element.
+    virtual int GetNodeNdofs(int n) override { return (n < (int)m_boundary_nodes.size()) ? 3 : GetNumModes(); }
+
+    /// Access the nth node.
+    virtual std::shared_ptr<ChNodeFEAbase> GetNodeN(int n) override;
+
+    /// Fill the D vector with the current field values at the nodes of the element: the displacements of the boundary
+    /// nodes followed by the modal coordinates.
+    virtual void GetStateBlock(ChVectorDynamic<>& mD) override;
+
+    /// Set H as the global stiffness matrix K, scaled by Kfactor, plus the damping matrix R, scaled by Rfactor, plus
+    /// the mass matrix M, scaled by Mfactor.
+    virtual void ComputeKRMmatricesGlobal(ChMatrixRef H,
+                                          double Kfactor,
+                                          double Rfactor = 0,
+                                          double Mfactor = 0) override;
+
+    /// Compute the internal forces (the elastic and damping forces of the reduced model).
+    virtual void ComputeInternalForces(ChVectorDynamic<>& Fi) override;
+
+    /// Compute the generalized gravity forces of the reduced model.
+    virtual void ComputeGravityForces(ChVectorDynamic<>& Fg, const ChVector<>& G_acc) override;
+
+  private:
+    /// Blocks of a full mesh matrix (bb: boundary-boundary, bi: boundary-interior, ii: interior-interior).
+    struct Partition {
+        Eigen::SparseMatrix<double> bb;
+        Eigen::SparseMatrix<double> bi;
+        Eigen::SparseMatrix<double> ii;
+    };
+
+    /// Split a full mesh matrix in its blocks, given the index of each full mesh DOF in its partition.
+    static Partition PartitionMatrix(const Eigen::SparseMatrix<double>& A,
+                                     const std::vector<int>& local,
+                                     const std::vector<bool>& is_boundary,
+                                     int nb,
+                                     int ni);
+
+    /// Project a full mesh matrix onto the Craig-Bampton reduction basis.
+    static ChMatrixDynamic<> ReduceMatrix(const Partition& A,
+                                          const Eigen::SparseMatrix<double>& Kib,
+                                          const Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>>& Kii_solver,
+                                          const Eigen::MatrixXd& Phi);
+
+    /// Get the time derivatives of the D vector (see GetStateBlock).
+    void GetStateBlock_dt(ChVectorDynamic<>& mD_dt);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> m_boundary_nodes;  ///< boundary nodes
+    std::vector<ChVector<>> m_boundary_pos0;                     ///< reference positions of the boundary nodes
+    std::shared_ptr<ChNodeFEAmodal> m_modal_node;                 ///< node with modal coordinates
+
+    ChMatrixDynamic<> m_K;     ///< reduced stiffness matrix
+    ChMatrixDynamic<> m_R;     ///< reduced damping matrix
+    ChMatrixDynamic<> m_M;     ///< reduced mass matrix
+    ChMatrixDynamic<> m_G;     ///< reduced gravity loads (one column per gravity direction)
+    ChVectorDynamic<> m_freq;  ///< natural frequencies of the fixed-interface modes
+
+    // Data for the recovery of the full mesh displacements
+    std::shared_ptr<Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>>> m_Kii_solver;  ///< factorized Kii
+    Eigen::SparseMatrix<double> m_Kib;  ///< interior-boundary stiffness block
+    Eigen::MatrixXf m_Phi;              ///< fixed-interface modes (interior DOFs, single precision)
+    std::vector<int> m_local;           ///< index of each full mesh DOF in its partition
+    std::vector<bool> m_is_boundary;    ///< flags for boundary DOFs of the full mesh
+};
+
+/// @} fea_elements
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
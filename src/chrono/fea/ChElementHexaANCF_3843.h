@@ -315,6 +315,10 @@ class ChApi ChElementHexaANCF_3843 : public ChElementHexahedron, public ChElemen
     virtual double GetDensity() override;
 
   private:
+    /// The batched evaluation of internal forces and Jacobians accesses the precomputed element data.
+    template <class ELEMENT>
+    friend class ChElementBatchANCF;
+
     /// Initial setup. This is used to precompute matrices that do not change during the simulation, such as the local
     /// stiffness of each element (if any), the mass, etc.
     virtual void SetupInitial(ChSystem* system) override;
@@ -372,6 +372,10 @@ class ChApi ChElementShellANCF_3833 : public ChElementShell, public ChLoadableUV
     virtual ChVector<> ComputeNormal(const double xi, const double eta) override;
 
   private:
+    /// The batched evaluation of internal forces and Jacobians accesses the precomputed element data.
+    template <class ELEMENT>
+    friend class ChElementBatchANCF;
+
     /// Initial setup. This is used to precompute matrices that do not change during the simulation, such as the local
     /// stiffness of each element (if any), the mass, etc.
     virtual void SetupInitial(ChSystem* system) override;
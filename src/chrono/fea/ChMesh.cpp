@@ -28,6 +28,7 @@
 #include "chrono/fea/ChMesh.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
 #include "chrono/fea/ChNodeFEAxyzrot.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 namespace fea {
@@ -45,6 +46,9 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
     automatic_gravity_load = other.automatic_gravity_load;
     num_points_gravity = other.num_points_gravity;
 
+    batched_ancf = other.batched_ancf;
+    batches_valid = false;
+
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
 }
@@ -65,6 +69,36 @@ void ChMesh::SetupInitial() {
         //    - precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    batches_valid = false;
+}
+
+void ChMesh::EnableBatchedANCF(bool val) {
+    batched_ancf = val;
+    batches_valid = false;
+}
+
+unsigned int ChMesh::GetNumBatchedElements() const {
+    unsigned int num_elements = 0;
+    for (const auto& batch : vbatches)
+        num_elements += batch->GetNumElements();
+    return num_elements;
+}
+
+void ChMesh::UpdateBatches() {
+    if (batches_valid)
+        return;
+
+    std::vector<bool> batched;
+    ChElementBatch::CreateBatchesANCF(velements, vbatches, batched);
+
+    vunbatched.clear();
+    for (int ie = 0; ie < (int)velements.size(); ie++) {
+        if (!batched[ie])
+            vunbatched.push_back(ie);
+    }
+
+    batches_valid = true;
 }
 
 void ChMesh::Relax() {
@@ -94,6 +128,7 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> m_node) {
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
     velements.push_back(m_elem);
+    batches_valid = false;
 
     // If the mesh is already added to a system, mark the system uninitialized and out-of-date
     if (system) {
@@ -105,6 +140,7 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
 void ChMesh::ClearElements() {
     velements.clear();
     vcontactsurfaces.clear();
+    batches_valid = false;
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -157,6 +193,7 @@ void ChMesh::Setup() {
 // Updates all time-dependant variables, if any...
 // Ex: maybe the elasticity can increase in time, etc.
 void ChMesh::Update(double m_time, bool update_assets) {
+    CH_TRACE_SCOPE("Mesh::Update", "fea");
     // Parent class update
     ChIndexedNodes::Update(m_time, update_assets);
 
@@ -266,6 +303,7 @@ void ChMesh::IntStateIncrement(const unsigned int off_x,
 }
 
 void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    CH_TRACE_SCOPE("Mesh::IntLoadResidual_F", "fea");
     // nodes applied forces
     unsigned int local_off_v = 0;
     for (unsigned int j = 0; j < vnodes.size(); j++) {
@@ -279,10 +317,21 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
 
     // elements internal forces
     timer_internal_forces.start();
-    //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
+    if (batched_ancf) {
+        UpdateBatches();
+        for (auto& batch : vbatches)
+            batch->LoadResidual_F(R, c, nthreads);
+        //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+        for (int i = 0; i < vunbatched.size(); i++) {
+            velements[vunbatched[i]]->EleIntLoadResidual_F(R, c);
+        }
+    } else {
+        //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+        for (int ie = 0; ie < velements.size(); ie++) {
+            velements[ie]->EleIntLoadResidual_F(R, c);
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
@@ -344,6 +393,7 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
                                 const ChVectorDynamic<>& w,  ///< the w vector
                                 const double c               ///< a scaling factor
 ) {
+    CH_TRACE_SCOPE("Mesh::IntLoadResidual_Mv", "fea");
     // nodal masses
     unsigned int local_off_v = 0;
     for (unsigned int j = 0; j < vnodes.size(); j++) {
@@ -395,12 +445,22 @@ void ChMesh::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
 }
 
 void ChMesh::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
+    CH_TRACE_SCOPE("Mesh::KRMmatricesLoad", "fea");
     int nthreads = GetSystem()->nthreads_chrono;
 
     timer_KRMload.start();
+    if (batched_ancf) {
+        UpdateBatches();
+        for (auto& batch : vbatches)
+            batch->LoadKRMmatrices(Kfactor, Rfactor, Mfactor, nthreads);
 #pragma omp parallel for num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++)
-        velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+        for (int i = 0; i < vunbatched.size(); i++)
+            velements[vunbatched[i]]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+    } else {
+#pragma omp parallel for num_threads(nthreads)
+        for (int ie = 0; ie < velements.size(); ie++)
+            velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+    }
     timer_KRMload.stop();
     ncalls_KRMload++;
 }
@@ -23,6 +23,7 @@
 #include "chrono/fea/ChContinuumMaterial.h"
 #include "chrono/fea/ChContactSurface.h"
 #include "chrono/fea/ChElementBase.h"
+#include "chrono/fea/ChElementBatch.h"
 #include "chrono/fea/ChMeshSurface.h"
 #include "chrono/fea/ChNodeFEAbase.h"
 
@@ -52,6 +53,11 @@ class ChApi ChMesh : public ChIndexedNodes {
     bool automatic_gravity_load;
     int num_points_gravity;
 
+    bool batched_ancf;                                      ///< batched evaluation of ANCF elements enabled?
+    bool batches_valid;                                     ///< element batches up-to-date?
+    std::vector<std::shared_ptr<ChElementBatch>> vbatches;  ///< batches of same-type elements
+    std::vector<int> vunbatched;                            ///< indices of elements evaluated one at a time
+
     ChTimer<> timer_internal_forces;
     ChTimer<> timer_KRMload;
     int ncalls_internal_forces;
@@ -63,6 +69,8 @@ class ChApi ChMesh : public ChIndexedNodes {
           n_dofs_w(0),
           automatic_gravity_load(true),
           num_points_gravity(1),
+          batched_ancf(false),
+          batches_valid(false),
           ncalls_internal_forces(0),
           ncalls_KRMload(0) {}
     ChMesh(const ChMesh& other);
@@ -120,6 +128,21 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative time for Jacobian load calls.
     double GetTimeJacobianLoad() { return timer_KRMload(); }
 
+    /// Enable/disable the batched evaluation of ANCF elements (default: false).
+    /// If enabled, the internal forces and Jacobians of ChElementBeamANCF_3333, ChElementShellANCF_3833, and
+    /// ChElementHexaANCF_3843 elements using the "Continuous Integration" method are evaluated several elements at a
+    /// time, with same-type elements stored in structure-of-arrays layout (one element per SIMD lane). All other
+    /// elements are evaluated one at a time. The element batches are built at the next evaluation; since they store
+    /// copies of the precomputed element data, call this function again after changing the elements of the mesh, their
+    /// material, damping, or internal force calculation method.
+    void EnableBatchedANCF(bool val);
+
+    /// Return true if the batched evaluation of ANCF elements is enabled.
+    bool IsBatchedANCF() const { return batched_ancf; }
+
+    /// Get the number of elements evaluated in batches (valid after the first evaluation).
+    unsigned int GetNumBatchedElements() const;
+
     /// Add a contact surface.
     void AddContactSurface(std::shared_ptr<ChContactSurface> m_surf);
 
@@ -280,8 +303,12 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// (Re)build the element batches, if needed.
+    void UpdateBatches();
+
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
+    friend class ChElementCraigBampton;
 };
 
 /// @} chrono_fea
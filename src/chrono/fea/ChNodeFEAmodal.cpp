@@ -0,0 +1,132 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include "chrono/fea/ChNodeFEAmodal.h"
+
+namespace chrono {
+namespace fea {
+
+ChNodeFEAmodal::ChNodeFEAmodal(int num_modes) : variables(num_modes) {
+    eta.setZero(num_modes);
+    eta_dt.setZero(num_modes);
+    eta_dtdt.setZero(num_modes);
+    variables.GetMass().setZero();
+    variables.GetInvMass().setZero();
+}
+
+ChNodeFEAmodal::ChNodeFEAmodal(const ChNodeFEAmodal& other) : ChNodeFEAbase(other) {
+    eta = other.eta;
+    eta_dt = other.eta_dt;
+    eta_dtdt = other.eta_dtdt;
+    variables = other.variables;
+}
+
+// -----------------------------------------------------------------------------
+
+ChNodeFEAmodal& ChNodeFEAmodal::operator=(const ChNodeFEAmodal& other) {
+    if (&other == this)
+        return *this;
+
+    ChNodeFEAbase::operator=(other);
+
+    eta = other.eta;
+    eta_dt = other.eta_dt;
+    eta_dtdt = other.eta_dtdt;
+    variables = other.variables;
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChNodeFEAmodal::Relax() {
+    eta.setZero();
+    SetNoSpeedNoAcceleration();
+}
+
+void ChNodeFEAmodal::SetNoSpeedNoAcceleration() {
+    eta_dt.setZero();
+    eta_dtdt.setZero();
+}
+
+// -----------------------------------------------------------------------------
+
+void ChNodeFEAmodal::NodeIntStateGather(const unsigned int off_x,
+                                        ChState& x,
+                                        const unsigned int off_v,
+                                        ChStateDelta& v,
+                                        double& T) {
+    x.segment(off_x, eta.size()) = eta;
+    v.segment(off_v, eta.size()) = eta_dt;
+}
+
+void ChNodeFEAmodal::NodeIntStateScatter(const unsigned int off_x,
+                                         const ChState& x,
+                                         const unsigned int off_v,
+                                         const ChStateDelta& v,
+                                         const double T) {
+    eta = x.segment(off_x, eta.size());
+    eta_dt = v.segment(off_v, eta.size());
+}
+
+void ChNodeFEAmodal::NodeIntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
+    a.segment(off_a, eta.size()) = eta_dtdt;
+}
+
+void ChNodeFEAmodal::NodeIntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
+    eta_dtdt = a.segment(off_a, eta.size());
+}
+
+void ChNodeFEAmodal::NodeIntToDescriptor(const unsigned int off_v, const ChStateDelta& v, const ChVectorDynamic<>& R) {
+    variables.Get_qb() = v.segment(off_v, eta.size());
+    variables.Get_fb() = R.segment(off_v, eta.size());
+}
+
+void ChNodeFEAmodal::NodeIntFromDescriptor(const unsigned int off_v, ChStateDelta& v) {
+    v.segment(off_v, eta.size()) = variables.Get_qb();
+}
+
+// -----------------------------------------------------------------------------
+
+void ChNodeFEAmodal::InjectVariables(ChSystemDescriptor& mdescriptor) {
+    mdescriptor.InsertVariables(&variables);
+}
+
+void ChNodeFEAmodal::VariablesFbReset() {
+    variables.Get_fb().setZero();
+}
+
+void ChNodeFEAmodal::VariablesQbLoadSpeed() {
+    if (variables.IsDisabled())
+        return;
+    variables.Get_qb() = eta_dt;
+}
+
+void ChNodeFEAmodal::VariablesQbSetSpeed(double step) {
+    if (variables.IsDisabled())
+        return;
+    ChVectorDynamic<> old_dt = eta_dt;
+    eta_dt = variables.Get_qb();
+    if (step) {
+        eta_dtdt = (eta_dt - old_dt) / step;
+    }
+}
+
+void ChNodeFEAmodal::VariablesQbIncrementPosition(double step) {
+    if (variables.IsDisabled())
+        return;
+    eta += step * variables.Get_qb();
+}
+
+}  // end namespace fea
+}  // end namespace chrono
@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHNODEFEAMODAL_H
+#define CHNODEFEAMODAL_H
+
+#include "chrono/solver/ChVariablesGeneric.h"
+#include "chrono/fea/ChNodeFEAbase.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_nodes
+/// @{
+
+/// Class for a node carrying a set of modal coordinates.
+/// Such a node is not associated with a point in space; it holds the amplitudes of the normal modes of a reduced-order
+/// component (see ChElementCraigBampton). The node has no mass of its own: the (modal) mass is provided by the element.
+class ChApi ChNodeFEAmodal : public ChNodeFEAbase {
+  public:
+    ChNodeFEAmodal(int num_modes = 1);
+    ChNodeFEAmodal(const ChNodeFEAmodal& other);
+    ~ChNodeFEAmodal() {}
+
+    ChNodeFEAmodal& operator=(const ChNodeFEAmodal& other);
+
+    virtual ChVariables& Variables() { return variables; }
+
+    /// Reset modal coordinates and their time derivatives.
+    virtual void Relax() override;
+
+    /// Reset to no speed and acceleration.
+    virtual void SetNoSpeedNoAcceleration() override;
+
+    /// Set the 'fixed' state of the node.
+    /// If true, its modal coordinates are not changed by solver.
+    virtual void SetFixed(bool mev) override { variables.SetDisabled(mev); }
+    /// Get the 'fixed' state of the node.
+    /// If true, its modal coordinates are not changed by solver.
+    virtual bool GetFixed() override { return variables.IsDisabled(); }
+
+    /// Get the number of modal coordinates.
+    int GetNumModes() const { return (int)eta.size(); }
+
+    /// Get the modal coordinates.
+    const ChVectorDynamic<>& GetModalCoordinates() const { return eta; }
+    /// Set the modal coordinates.
+    void SetModalCoordinates(const ChVectorDynamic<>& val) { eta = val; }
+
+    /// Get the time derivatives of the modal coordinates.
+    const ChVectorDynamic<>& GetModalCoordinates_dt() const { return eta_dt; }
+    /// Set the time derivatives of the modal coordinates.
+    void SetModalCoordinates_dt(const ChVectorDynamic<>& val) { eta_dt = val; }
+
+    /// Get the second time derivatives of the modal coordinates.
+    const ChVectorDynamic<>& GetModalCoordinates_dtdt() const { return eta_dtdt; }
+
+    /// Get the number of degrees of freedom.
+    virtual int Get_ndof_x() const override { return (int)eta.size(); }
+
+    //
+    // Functions for interfacing to the state bookkeeping
+    //
+
+    virtual void NodeIntStateGather(const unsigned int off_x,
+                                    ChState& x,
+                                    const unsigned int off_v,
+                                    ChStateDelta& v,
+                                    double& T) override;
+    virtual void NodeIntStateScatter(const unsigned int off_x,
+                                     const ChState& x,
+                                     const unsigned int off_v,
+                                     const ChStateDelta& v,
+                                     const double T) override;
+    virtual void NodeIntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) override;
+    virtual void NodeIntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) override;
+    virtual void NodeIntToDescriptor(const unsigned int off_v,
+                                     const ChStateDelta& v,
+                                     const ChVectorDynamic<>& R) override;
+    virtual void NodeIntFromDescriptor(const unsigned int off_v, ChStateDelta& v) override;
+
+    //
+    // Functions for interfacing to the solver
+    //
+
+    virtual void InjectVariables(ChSystemDescriptor& mdescriptor) override;
+
+    virtual void VariablesFbReset() override;
+    virtual void VariablesQbLoadSpeed() override;
+    virtual void VariablesQbSetSpeed(double step = 0) override;
+    virtual void VariablesQbIncrementPosition(double step) override;
+
+  private:
+    ChVariablesGeneric variables;  ///< solver proxy: variables with modal coordinates
+    ChVectorDynamic<> eta;         ///< modal coordinates
+    ChVectorDynamic<> eta_dt;      ///< modal coordinate derivatives
+    ChVectorDynamic<> eta_dtdt;    ///< modal coordinate second derivatives
+};
+
+/// @} fea_nodes
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
@@ -17,6 +17,7 @@
 
 #include "chrono/core/ChGlobal.h"
 #include "chrono/core/ChTransform.h"
+#include "chrono/parallel/ChOpenMP.h"
 #include "chrono/physics/ChAssembly.h"
 #include "chrono/physics/ChSystem.h"
 
@@ -44,7 +45,9 @@ ChAssembly::ChAssembly()
       ndoc_w_C(0),
       ndoc_w_D(0),
       nbodies_sleep(0),
-      nbodies_fixed(0) {}
+      nbodies_fixed(0),
+      parallel_update(false),
+      use_body_block(false) {}
 
 ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     nbodies = other.nbodies;
@@ -62,6 +65,8 @@ ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     nsysvars_w = other.nsysvars_w;
     nbodies_sleep = other.nbodies_sleep;
     nbodies_fixed = other.nbodies_fixed;
+    parallel_update = other.parallel_update;
+    use_body_block = other.use_body_block;
 
     //// RADU
     //// TODO:  deep copy of the object lists (bodylist, linklist, meshlist,  otherphysicslist)
@@ -99,6 +104,9 @@ void swap(ChAssembly& first, ChAssembly& second) {
     swap(first.nsysvars_w, second.nsysvars_w);
     swap(first.nbodies_sleep, second.nbodies_sleep);
     swap(first.nbodies_fixed, second.nbodies_fixed);
+    swap(first.parallel_update, second.parallel_update);
+    swap(first.use_body_block, second.use_body_block);
+    swap(first.body_block, second.body_block);
 
     //// RADU
     //// TODO: deal with all other member variables...
@@ -462,6 +470,9 @@ void ChAssembly::Setup() {
         }
     }
 
+    if (use_body_block)
+        body_block.Build(bodylist);
+
     for (auto& link : linklist) {
         if (link->IsActive()) {
             nlinks++;
@@ -520,6 +531,99 @@ void ChAssembly::Setup() {
     ndof = ncoords_w - ndoc_w;
 }
 
+// -----------------------------------------------------------------------------
+// Parallel traversal of item lists
+
+// Minimum number of items per thread for parallel traversal of a list (below this, threading overhead dominates).
+static const size_t _min_items_per_thread = 128;
+
+int ChAssembly::GetNumUpdateThreads(size_t num_items) const {
+    if (!parallel_update || !system)
+        return 1;
+    int nthreads = system->GetNumThreadsChrono();
+    return (int)std::max<size_t>(1, std::min<size_t>(nthreads, num_items / _min_items_per_thread));
+}
+
+// Apply the given function to all items in the list.
+// With more than one thread, the thread-safe items are processed in parallel, followed by all other items in order.
+template <class T, typename Func>
+static void _ForEachItem(const std::vector<std::shared_ptr<T>>& list, int nthreads, Func func) {
+    if (nthreads <= 1) {
+        for (int ip = 0; ip < (int)list.size(); ++ip)
+            func(list[ip].get());
+        return;
+    }
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)list.size(); ++ip) {
+        if (list[ip]->IsUpdateThreadSafe())
+            func(list[ip].get());
+    }
+    for (int ip = 0; ip < (int)list.size(); ++ip) {
+        if (!list[ip]->IsUpdateThreadSafe())
+            func(list[ip].get());
+    }
+}
+
+// Apply the given function, which loads terms into a residual vector, to all items in the list.
+// The function may load terms in slots of other items (e.g. link forces applied to bodies). With more than one thread,
+// the thread-safe items load their terms in per-thread vectors, which are then summed into R.
+template <class T, typename Func>
+static void _ForEachItemReduce(const std::vector<std::shared_ptr<T>>& list,
+                               int nthreads,
+                               std::vector<ChVectorDynamic<>>& buffers,
+                               ChVectorDynamic<>& R,
+                               Func func) {
+    // The reduction costs O(size of R) per thread, so use it only if the list is not small relative to R.
+    if (nthreads <= 1 || 16 * list.size() < (size_t)R.size()) {
+        for (int ip = 0; ip < (int)list.size(); ++ip)
+            func(list[ip].get(), R);
+        return;
+    }
+
+    if ((int)buffers.size() < nthreads)
+        buffers.resize(nthreads);
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        int nt = ChOMP::GetNumThreads();
+        ChVectorDynamic<>& Rt = buffers[ChOMP::GetThreadNum()];
+        Rt.setZero(R.size());
+
+#pragma omp for schedule(static)
+        for (int ip = 0; ip < (int)list.size(); ++ip) {
+            if (list[ip]->IsUpdateThreadSafe())
+                func(list[ip].get(), Rt);
+        }
+
+        // Sum the per-thread contributions (implicit barrier above)
+#pragma omp for schedule(static)
+        for (int i = 0; i < (int)R.size(); ++i) {
+            double sum = 0;
+            for (int t = 0; t < nt; ++t)
+                sum += buffers[t](i);
+            R(i) += sum;
+        }
+    }
+
+    for (int ip = 0; ip < (int)list.size(); ++ip) {
+        if (!list[ip]->IsUpdateThreadSafe())
+            func(list[ip].get(), R);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChAssembly::EnableBodyStateBlock(bool val) {
+    use_body_block = val;
+    if (use_body_block)
+        body_block.Build(bodylist);
+    else
+        body_block = ChBodyStateBlock();
+}
+
+// -----------------------------------------------------------------------------
+
 // Update assembly's own properties first (ChTime and assets, if any).
 // Then update all contents of this assembly.
 void ChAssembly::Update(double mytime, bool update_assets) {
@@ -531,16 +635,15 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
-    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
-        bodylist[ip]->Update(ChTime, update_assets);
-    }
+    _ForEachItem(bodylist, GetNumUpdateThreads(bodylist.size()),
+                 [&](ChBody* body) { body->Update(ChTime, update_assets); });
+    if (use_body_block)
+        body_block.Sync(GetNumUpdateThreads(body_block.GetNumBodies()));
     for (int ip = 0; ip < (int)otherphysicslist.size(); ++ip) {
         otherphysicslist[ip]->Update(ChTime, update_assets);
     }
-    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
-        linklist[ip]->Update(ChTime, update_assets);
-    }
+    _ForEachItem(linklist, GetNumUpdateThreads(linklist.size()),
+                 [&](ChLinkBase* link) { link->Update(ChTime, update_assets); });
     for (int ip = 0; ip < (int)meshlist.size(); ++ip) {
         meshlist[ip]->Update(ChTime, update_assets);
     }
@@ -569,14 +672,21 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
-        if (body->IsActive())
-            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
-    }
-    for (auto& link : linklist) {
+    // Note: items set T to their own time; use a local copy to avoid concurrent writes (T is set below).
+    if (use_body_block) {
+        body_block.StateGather(displ_x, x, displ_v, v, GetNumUpdateThreads(body_block.GetNumBodies()));
+    } else {
+        _ForEachItem(bodylist, GetNumUpdateThreads(bodylist.size()), [&](ChBody* body) {
+            double Tb;
+            if (body->IsActive())
+                body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, Tb);
+        });
+    }
+    _ForEachItem(linklist, GetNumUpdateThreads(linklist.size()), [&](ChLinkBase* link) {
+        double Tl;
         if (link->IsActive())
-            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T);
-    }
+            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, Tl);
+    });
     for (auto& mesh : meshlist) {
         mesh->IntStateGather(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T);
     }
@@ -603,21 +713,31 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
-        if (body->IsActive())
-            body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
-        else
-            body->Update(T, full_update);
+    if (use_body_block) {
+        body_block.StateScatter(displ_x, x, displ_v, v, T, full_update,
+                                GetNumUpdateThreads(body_block.GetNumBodies()));
+        for (auto& body : bodylist) {
+            if (!body->IsActive())
+                body->Update(T, full_update);
+        }
+    } else {
+        _ForEachItem(bodylist, GetNumUpdateThreads(bodylist.size()), [&](ChBody* body) {
+            if (body->IsActive())
+                body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T,
+                                      full_update);
+            else
+                body->Update(T, full_update);
+        });
     }
     for (auto& mesh : meshlist) {
         mesh->IntStateScatter(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T, full_update);
     }
-    for (auto& link : linklist) {
+    _ForEachItem(linklist, GetNumUpdateThreads(linklist.size()), [&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, full_update);
         else
             link->Update(T, full_update);
-    }
+    });
     for (auto& item : otherphysicslist) {
         item->IntStateScatter(displ_x + item->GetOffset_x(), x, displ_v + item->GetOffset_w(), v, T, full_update);
     }
@@ -711,9 +831,13 @@ void ChAssembly::IntStateIncrement(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
-        if (body->IsActive())
-            body->IntStateIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
+    if (use_body_block) {
+        body_block.StateIncrement(displ_x, x_new, x, displ_v, Dv, GetNumUpdateThreads(body_block.GetNumBodies()));
+    } else {
+        for (auto& body : bodylist) {
+            if (body->IsActive())
+                body->IntStateIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
+        }
     }
 
     for (auto& link : linklist) {
@@ -736,14 +860,15 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
 {
     unsigned int displ_v = off - this->offset_w;
 
-    for (auto& body : bodylist) {
+    _ForEachItem(bodylist, GetNumUpdateThreads(bodylist.size()), [&](ChBody* body) {
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
-    }
-    for (auto& link : linklist) {
-        if (link->IsActive())
-            link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R, c);
-    }
+    });
+    _ForEachItemReduce(linklist, GetNumUpdateThreads(linklist.size()), thread_residuals, R,
+                       [&](ChLinkBase* link, ChVectorDynamic<>& Rt) {
+                           if (link->IsActive())
+                               link->IntLoadResidual_F(displ_v + link->GetOffset_w(), Rt, c);
+                       });
     for (auto& mesh : meshlist) {
         mesh->IntLoadResidual_F(displ_v + mesh->GetOffset_w(), R, c);
     }
@@ -759,14 +884,18 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
 ) {
     unsigned int displ_v = off - this->offset_w;
 
-    for (auto& body : bodylist) {
-        if (body->IsActive())
-            body->IntLoadResidual_Mv(displ_v + body->GetOffset_w(), R, w, c);
+    if (use_body_block) {
+        body_block.LoadResidual_Mv(displ_v, R, w, c, GetNumUpdateThreads(body_block.GetNumBodies()));
+    } else {
+        _ForEachItem(bodylist, GetNumUpdateThreads(bodylist.size()), [&](ChBody* body) {
+            if (body->IsActive())
+                body->IntLoadResidual_Mv(displ_v + body->GetOffset_w(), R, w, c);
+        });
     }
-    for (auto& link : linklist) {
+    _ForEachItem(linklist, GetNumUpdateThreads(linklist.size()), [&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntLoadResidual_Mv(displ_v + link->GetOffset_w(), R, w, c);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntLoadResidual_Mv(displ_v + mesh->GetOffset_w(), R, w, c);
     }
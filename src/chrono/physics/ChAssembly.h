@@ -17,6 +17,7 @@
 
 #include <cmath>
 #include "chrono/fea/ChMesh.h"
+#include "chrono/physics/ChBodyStateBlock.h"
 #include "chrono/physics/ChLinksAll.h"
 #include "chrono/physics/ChPhysicsItem.h"
 
@@ -124,6 +125,30 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Search a marker by its unique ID.
     std::shared_ptr<ChMarker> SearchMarker(int markID);
 
+    /// Enable/disable concurrent processing of bodies and links (default: false).
+    /// If enabled, Update(), IntStateGather(), IntStateScatter(), IntLoadResidual_F() and IntLoadResidual_Mv() process
+    /// the items that support it (see ChPhysicsItem::IsUpdateThreadSafe) in parallel, using the number of Chrono
+    /// threads of the owning system (see ChSystem::SetNumThreads). Link loads in IntLoadResidual_F() are accumulated
+    /// in per-thread residual vectors which are then summed. Meshes and other physics items are always processed
+    /// sequentially. Note that user callbacks (e.g. spring force functors) shared by several items must then be
+    /// thread safe.
+    void EnableParallelUpdate(bool val) { parallel_update = val; }
+
+    /// Return true if concurrent processing of bodies and links is enabled.
+    bool IsParallelUpdateEnabled() const { return parallel_update; }
+
+    /// Enable/disable the body state block (default: false).
+    /// If enabled, the states, masses, inertias and rotation matrices of the active bodies are kept in contiguous
+    /// arrays (see ChBodyStateBlock), refreshed at each Setup() and after each update of the bodies, and the state
+    /// gather, scatter and increment and the mass-matrix residual loads of the bodies are performed on these arrays.
+    /// This is beneficial for systems with large numbers of bodies (e.g. granular material). Derived body classes that
+    /// override IntStateGather(), IntStateScatter(), IntStateIncrement() or IntLoadResidual_Mv() must not be used in
+    /// this mode.
+    void EnableBodyStateBlock(bool val);
+
+    /// Return true if the body state block is enabled.
+    bool IsBodyStateBlockEnabled() const { return use_body_block; }
+
     //
     // STATISTICS
     //
@@ -296,6 +321,9 @@ class ChApi ChAssembly : public ChPhysicsItem {
   private:
     virtual void SetupInitial() override;
 
+    /// Return the number of threads for parallel traversal of a list with given number of items.
+    int GetNumUpdateThreads(size_t num_items) const;
+
     std::vector<std::shared_ptr<ChBody>> bodylist;                 ///< list of rigid bodies
     std::vector<std::shared_ptr<ChLinkBase>> linklist;             ///< list of joints (links)
     std::vector<std::shared_ptr<fea::ChMesh>> meshlist;            ///< list of meshes
@@ -319,6 +347,12 @@ class ChApi ChAssembly : public ChPhysicsItem {
     int nbodies_sleep;  ///< number of bodies that are sleeping
     int nbodies_fixed;  ///< number of bodies that are fixed
 
+    bool parallel_update;                            ///< process bodies and links concurrently
+    std::vector<ChVectorDynamic<>> thread_residuals;  ///< per-thread accumulators for link loads
+
+    bool use_body_block;          ///< use the body state block
+    ChBodyStateBlock body_block;  ///< contiguous data of the active bodies
+
     friend class ChSystem;
     friend class ChSystemMulticore;
     friend class ChSystemDistributed;
@@ -405,10 +405,14 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     /// Update all auxiliary data of the rigid body and of
     /// its children (markers, forces..), at given time
     virtual void Update(double mytime, bool update_assets = true) override;
+
     /// Update all auxiliary data of the rigid body and of
     /// its children (markers, forces..)
     virtual void Update(bool update_assets = true) override;
 
+    /// Return true: updating a body only modifies its own data and that of its children (markers, forces).
+    virtual bool IsUpdateThreadSafe() const override { return true; }
+
     /// Return the resultant applied force on the body.
     /// This resultant force includes all external applied loads acting on this body (from gravity, loads, springs,
     /// etc). However, this does *not* include any constraint forces. In particular, contact forces are not included if
@@ -0,0 +1,234 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <cmath>
+#include <limits>
+
+#include "chrono/physics/ChBodyStateBlock.h"
+
+namespace chrono {
+
+void ChBodyStateBlock::Build(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    m_bodies.clear();
+    m_off_x.clear();
+    m_off_w.clear();
+    m_safe.clear();
+    for (const auto& body : bodies) {
+        if (!body->IsActive())
+            continue;
+        m_bodies.push_back(body.get());
+        m_off_x.push_back(body->GetOffset_x());
+        m_off_w.push_back(body->GetOffset_w());
+        m_safe.push_back(body->IsUpdateThreadSafe());
+    }
+
+    size_t n = m_bodies.size();
+    for (int k = 0; k < 3; k++) {
+        m_pos[k].resize(n);
+        m_pos_dt[k].resize(n);
+        m_wvel[k].resize(n);
+    }
+    for (int k = 0; k < 4; k++)
+        m_rot[k].resize(n);
+    m_mass.resize(n);
+    for (int k = 0; k < 9; k++) {
+        m_J[k].resize(n);
+        m_A[k].resize(n);
+    }
+
+    Sync();
+}
+
+void ChBodyStateBlock::Sync(int nthreads) {
+    int n = (int)m_bodies.size();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < n; i++) {
+        ChBody* body = m_bodies[i];
+        const ChCoordsys<>& coord = body->GetCoord();
+        const ChVector<>& pos_dt = body->GetPos_dt();
+        ChVector<> wvel = body->GetWvel_loc();
+        const ChMatrix33<>& J = body->GetInertia();
+        const ChMatrix33<>& A = body->GetA();
+        for (int k = 0; k < 3; k++) {
+            m_pos[k][i] = coord.pos[k];
+            m_pos_dt[k][i] = pos_dt[k];
+            m_wvel[k][i] = wvel[k];
+        }
+        for (int k = 0; k < 4; k++)
+            m_rot[k][i] = coord.rot[k];
+        m_mass[i] = body->GetMass();
+        for (int k = 0; k < 9; k++) {
+            m_J[k][i] = J(k / 3, k % 3);
+            m_A[k][i] = A(k / 3, k % 3);
+        }
+    }
+}
+
+void ChBodyStateBlock::StateGather(const unsigned int displ_x,
+                                   ChState& x,
+                                   const unsigned int displ_v,
+                                   ChStateDelta& v,
+                                   int nthreads) const {
+    int n = (int)m_bodies.size();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < n; i++) {
+        unsigned int ox = displ_x + m_off_x[i];
+        unsigned int ov = displ_v + m_off_w[i];
+        for (int k = 0; k < 3; k++) {
+            x(ox + k) = m_pos[k][i];
+            v(ov + k) = m_pos_dt[k][i];
+            v(ov + 3 + k) = m_wvel[k][i];
+        }
+        for (int k = 0; k < 4; k++)
+            x(ox + 3 + k) = m_rot[k][i];
+    }
+}
+
+void ChBodyStateBlock::StateScatter(const unsigned int displ_x,
+                                    const ChState& x,
+                                    const unsigned int displ_v,
+                                    const ChStateDelta& v,
+                                    const double T,
+                                    bool full_update,
+                                    int nthreads) {
+    int n = (int)m_bodies.size();
+
+    // Store the new states in the block, then push them to the bodies (thread-safe bodies first, concurrently)
+#pragma omp parallel num_threads(nthreads)
+    {
+#pragma omp for schedule(static)
+        for (int i = 0; i < n; i++) {
+            unsigned int ox = displ_x + m_off_x[i];
+            unsigned int ov = displ_v + m_off_w[i];
+            for (int k = 0; k < 3; k++) {
+                m_pos[k][i] = x(ox + k);
+                m_pos_dt[k][i] = v(ov + k);
+                m_wvel[k][i] = v(ov + 3 + k);
+            }
+            for (int k = 0; k < 4; k++)
+                m_rot[k][i] = x(ox + 3 + k);
+        }
+
+#pragma omp for schedule(static)
+        for (int i = 0; i < n; i++) {
+            if (m_safe[i] || nthreads <= 1)
+                ScatterBody(i, T, full_update);
+        }
+    }
+
+    if (nthreads > 1) {
+        for (int i = 0; i < n; i++) {
+            if (!m_safe[i])
+                ScatterBody(i, T, full_update);
+        }
+    }
+}
+
+void ChBodyStateBlock::ScatterBody(int i, const double T, bool full_update) {
+    ChBody* body = m_bodies[i];
+    body->SetCoord(ChCoordsys<>(ChVector<>(m_pos[0][i], m_pos[1][i], m_pos[2][i]),
+                                ChQuaternion<>(m_rot[0][i], m_rot[1][i], m_rot[2][i], m_rot[3][i])));
+    body->SetPos_dt(ChVector<>(m_pos_dt[0][i], m_pos_dt[1][i], m_pos_dt[2][i]));
+    body->SetWvel_loc(ChVector<>(m_wvel[0][i], m_wvel[1][i], m_wvel[2][i]));
+    body->SetChTime(T);
+    body->Update(T, full_update);
+
+    const ChMatrix33<>& A = body->GetA();
+    for (int k = 0; k < 9; k++)
+        m_A[k][i] = A(k / 3, k % 3);
+}
+
+void ChBodyStateBlock::StateIncrement(const unsigned int displ_x,
+                                      ChState& x_new,
+                                      const ChState& x,
+                                      const unsigned int displ_v,
+                                      const ChStateDelta& Dv,
+                                      int nthreads) const {
+    int n = (int)m_bodies.size();
+    const double* A[9];
+    for (int k = 0; k < 9; k++)
+        A[k] = m_A[k].data();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < n; i++) {
+        unsigned int ox = displ_x + m_off_x[i];
+        unsigned int ov = displ_v + m_off_w[i];
+
+        // Advance position
+        x_new(ox + 0) = x(ox + 0) + Dv(ov + 0);
+        x_new(ox + 1) = x(ox + 1) + Dv(ov + 1);
+        x_new(ox + 2) = x(ox + 2) + Dv(ov + 2);
+
+        // Advance rotation: rot' = delta * rot, with delta the rotation by the absolute rotation increment
+        double w0 = Dv(ov + 3);
+        double w1 = Dv(ov + 4);
+        double w2 = Dv(ov + 5);
+        double wx = A[0][i] * w0 + A[1][i] * w1 + A[2][i] * w2;
+        double wy = A[3][i] * w0 + A[4][i] * w1 + A[5][i] * w2;
+        double wz = A[6][i] * w0 + A[7][i] * w1 + A[8][i] * w2;
+        double angle = std::sqrt(wx * wx + wy * wy + wz * wz);
+        bool nonzero = angle >= std::numeric_limits<double>::min();
+        double inv = nonzero ? 1 / angle : 0;
+        double ax = nonzero ? wx * inv : 1;
+        double ay = wy * inv;
+        double az = wz * inv;
+        double sinhalf = std::sin(angle / 2);
+        double d0 = std::cos(angle / 2);
+        double d1 = ax * sinhalf;
+        double d2 = ay * sinhalf;
+        double d3 = az * sinhalf;
+
+        double q0 = x(ox + 3);
+        double q1 = x(ox + 4);
+        double q2 = x(ox + 5);
+        double q3 = x(ox + 6);
+        x_new(ox + 3) = d0 * q0 - d1 * q1 - d2 * q2 - d3 * q3;
+        x_new(ox + 4) = d0 * q1 + d1 * q0 - d3 * q2 + d2 * q3;
+        x_new(ox + 5) = d0 * q2 + d2 * q0 + d3 * q1 - d1 * q3;
+        x_new(ox + 6) = d0 * q3 + d3 * q0 - d2 * q1 + d1 * q2;
+    }
+}
+
+void ChBodyStateBlock::LoadResidual_Mv(const unsigned int displ_v,
+                                       ChVectorDynamic<>& R,
+                                       const ChVectorDynamic<>& w,
+                                       const double c,
+                                       int nthreads) const {
+    int n = (int)m_bodies.size();
+    const double* J[9];
+    for (int k = 0; k < 9; k++)
+        J[k] = m_J[k].data();
+    const double* mass = m_mass.data();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < n; i++) {
+        unsigned int off = displ_v + m_off_w[i];
+
+        double cm = c * mass[i];
+        R(off + 0) += cm * w(off + 0);
+        R(off + 1) += cm * w(off + 1);
+        R(off + 2) += cm * w(off + 2);
+
+        double w0 = w(off + 3);
+        double w1 = w(off + 4);
+        double w2 = w(off + 5);
+        R(off + 3) += c * (J[0][i] * w0 + J[1][i] * w1 + J[2][i] * w2);
+        R(off + 4) += c * (J[3][i] * w0 + J[4][i] * w1 + J[5][i] * w2);
+        R(off + 5) += c * (J[6][i] * w0 + J[7][i] * w1 + J[8][i] * w2);
+    }
+}
+
+}  // end namespace chrono
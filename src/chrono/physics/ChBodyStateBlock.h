@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_BODY_STATE_BLOCK_H
+#define CH_BODY_STATE_BLOCK_H
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/timestepper/ChState.h"
+
+namespace chrono {
+
+/// Contiguous (structure-of-arrays) block with the data of the active bodies in an assembly that is needed by the
+/// integrator kernels: state offsets, positions, rotations, linear and angular velocities, masses, inertia tensors, and
+/// rotation matrices.
+/// The bodies remain the owners of their data; the block is a copy, rebuilt at each assembly Setup() and refreshed
+/// after each update of the bodies (see Sync), so that it always reflects the body states as of the last Setup, Update,
+/// or state scatter. The kernels below reproduce the ChBody implementations of IntStateGather(), IntStateScatter(),
+/// IntStateIncrement() and IntLoadResidual_Mv(), but operate on the contiguous arrays instead of traversing the bodies
+/// (one virtual call and several scattered cache lines per body). Except for the push of the new states to the bodies
+/// in StateScatter, the loops are written over plain arrays, without branches, so that they can be vectorized by the
+/// compiler.
+/// Note that derived body classes which override any of the above ChBody functions must not be used with a body
+/// state block.
+class ChApi ChBodyStateBlock {
+  public:
+    ChBodyStateBlock() {}
+
+    /// Rebuild the block from the active bodies in the given list (in order), then load their current data.
+    void Build(const std::vector<std::shared_ptr<ChBody>>& bodies);
+
+    /// Refresh the states, masses, inertias and rotation matrices from the bodies in the block.
+    void Sync(int nthreads = 1);
+
+    /// Return the number of bodies in the block.
+    size_t GetNumBodies() const { return m_bodies.size(); }
+
+    /// Load the positions and velocities of all bodies in the block into x and v (see ChBody::IntStateGather).
+    void StateGather(const unsigned int displ_x,
+                     ChState& x,
+                     const unsigned int displ_v,
+                     ChStateDelta& v,
+                     int nthreads = 1) const;
+
+    /// Store the positions and velocities of all bodies in the block from x and v, then set them in the bodies and
+    /// update the bodies (see ChBody::IntStateScatter). Bodies which are not thread safe (see
+    /// ChPhysicsItem::IsUpdateThreadSafe) are updated sequentially, after all others.
+    void StateScatter(const unsigned int displ_x,
+                      const ChState& x,
+                      const unsigned int displ_v,
+                      const ChStateDelta& v,
+                      const double T,
+                      bool full_update,
+                      int nthreads = 1);
+
+    /// Perform x_new = x + Dv for all bodies in the block (see ChBody::IntStateIncrement).
+    void StateIncrement(const unsigned int displ_x,
+                        ChState& x_new,
+                        const ChState& x,
+                        const unsigned int displ_v,
+                        const ChStateDelta& Dv,
+                        int nthreads = 1) const;
+
+    /// Perform R += c*M*w for all bodies in the block (see ChBody::IntLoadResidual_Mv).
+    void LoadResidual_Mv(const unsigned int displ_v,
+                         ChVectorDynamic<>& R,
+                         const ChVectorDynamic<>& w,
+                         const double c,
+                         int nthreads = 1) const;
+
+  private:
+    /// Push the stored state of the body with given index to the body, update it, and refresh its rotation matrix.
+    void ScatterBody(int i, const double T, bool full_update);
+
+    std::vector<ChBody*> m_bodies;                ///< bodies in the block
+    std::vector<unsigned int> m_off_x;            ///< body offsets in the position state vector
+    std::vector<unsigned int> m_off_w;            ///< body offsets in the velocity state vector
+    std::vector<char> m_safe;                     ///< body can be updated concurrently with others
+    std::array<std::vector<double>, 3> m_pos;     ///< positions
+    std::array<std::vector<double>, 4> m_rot;     ///< rotation quaternions
+    std::array<std::vector<double>, 3> m_pos_dt;  ///< linear velocities
+    std::array<std::vector<double>, 3> m_wvel;    ///< angular velocities (local frame)
+    std::vector<double> m_mass;                   ///< body masses
+    std::array<std::vector<double>, 9> m_J;       ///< inertia tensors (row-major components, local frame)
+    std::array<std::vector<double>, 9> m_A;       ///< rotation matrices (row-major components)
+};
+
+}  // end namespace chrono
+
+#endif
@@ -12,7 +12,10 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/physics/ChContactContainer.h"
+#include "chrono/parallel/ChOpenMP.h"
 
 namespace chrono {
 
@@ -24,6 +27,32 @@ ChContactContainer::ChContactContainer(const ChContactContainer& other) : ChPhys
     report_contact_callback = other.report_contact_callback;
 }
 
+void ChContactContainer::LoadResidualParallel(ChVectorDynamic<>& R,
+                                              int nthreads,
+                                              const std::function<void(ChVectorDynamic<>&)>& load) {
+    const int block_size = 1024;
+    int n = (int)R.size();
+    int nblocks = (n + block_size - 1) / block_size;
+
+    thread_residuals.resize(nthreads);
+#pragma omp parallel num_threads(nthreads)
+    {
+        auto& Rt = thread_residuals[ChOMP::GetThreadNum()];
+        Rt.setZero(n);
+        load(Rt);
+
+#pragma omp barrier
+        int nteam = ChOMP::GetNumThreads();
+#pragma omp for schedule(static)
+        for (int b = 0; b < nblocks; b++) {
+            int start = b * block_size;
+            int len = std::min(block_size, n - start);
+            for (int t = 0; t < nteam; t++)
+                R.segment(start, len) += thread_residuals[t].segment(start, len);
+        }
+    }
+}
+
 void ChContactContainer::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChContactContainer>();
@@ -20,8 +20,10 @@
 #ifndef CH_CONTACT_CONTAINER_H
 #define CH_CONTACT_CONTAINER_H
 
+#include <functional>
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 #include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/physics/ChBody.h"
@@ -130,6 +132,9 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     /// Method for de-serialization of transient data from archives.
     virtual void ArchiveIN(ChArchiveIn& marchive);
 
+    /// Minimum number of contacts (of a given type) for which loops over contacts are executed in parallel.
+    static const int min_parallel_contacts = 256;
+
   protected:
     struct ForceTorque {
         ChVector<> force;
@@ -139,14 +144,26 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     std::shared_ptr<AddContactCallback> add_contact_callback;
     ReportContactCallback* report_contact_callback;
 
+    std::vector<ChVectorDynamic<>> thread_residuals;  ///< per-thread accumulators for parallel residual loading
+
+    /// Utility function to load the residual contributions of all contacts with a team of threads.
+    /// The given function is invoked by each thread of the team with its own (zeroed) residual vector and must
+    /// distribute the contacts among the team with orphaned work-sharing loops. The per-thread residuals are then
+    /// summed into R, in parallel over blocks of entries. The thread contributions to each entry are added in thread
+    /// order, so the result does not depend on the partition of the entries.
+    void LoadResidualParallel(ChVectorDynamic<>& R,
+                              int nthreads,
+                              const std::function<void(ChVectorDynamic<>&)>& load);
+
     /// Utility function to accumulate contact forces from a specified list of contacts.
-    /// This function is templated by the contact type (assumed to be derived from ChContactTuple).
+    /// This function is templated by the contact list type (a sequence of pointers to objects derived from
+    /// ChContactTuple, such as std::list or ChContactPool).
     /// Contact forces are accumulated in a map keyed by the contactable objects.
     /// Derived ChContactContainer classes can use this utility (processing their various lists
     /// of contacts) to cache information used for reporting through GetContactableForce and
     /// GetContactableTorque.
-    template <class Tcont>
-    void SumAllContactForces(std::list<Tcont*>& contactlist,
+    template <class Tlist>
+    void SumAllContactForces(Tlist& contactlist,
                              std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
         for (auto contact = contactlist.begin(); contact != contactlist.end(); ++contact) {
             // Extract information for current contact (expressed in global frame)
@@ -14,7 +14,9 @@
 
 #include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/parallel/ChOpenMP.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -24,32 +26,13 @@ using namespace geometry;
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChContactContainerNSC)
 
-ChContactContainerNSC::ChContactContainerNSC()
-    : n_added_6_6(0),
-      n_added_6_3(0),
-      n_added_3_3(0),
-      n_added_333_3(0),
-      n_added_333_6(0),
-      n_added_333_333(0),
-      n_added_666_3(0),
-      n_added_666_6(0),
-      n_added_666_333(0),
-      n_added_666_666(0),
-      n_added_6_6_rolling(0) {}
-
-ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other) : ChContactContainer(other) {
-    n_added_6_6 = 0;
-    n_added_6_3 = 0;
-    n_added_3_3 = 0;
-    n_added_333_3 = 0;
-    n_added_333_6 = 0;
-    n_added_333_333 = 0;
-    n_added_666_3 = 0;
-    n_added_666_6 = 0;
-    n_added_666_333 = 0;
-    n_added_666_666 = 0;
-    n_added_6_6_rolling = 0;
-}
+ChContactContainerNSC::ChContactContainerNSC() : cache_enabled(false), cache_tolerance(0.01), cache_hits(0) {}
+
+ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other)
+    : ChContactContainer(other),
+      cache_enabled(other.cache_enabled),
+      cache_tolerance(other.cache_tolerance),
+      cache_hits(0) {}
 
 ChContactContainerNSC::~ChContactContainerNSC() {
     RemoveAllContacts();
@@ -60,138 +43,179 @@ void ChContactContainerNSC::Update(double mytime, bool update_assets) {
     ChContactContainer::Update(mytime, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
-    }
-    contactlist.clear();
-    lastcontact = contactlist.begin();
-    n_added = 0;
-}
-
 void ChContactContainerNSC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
-    _RemoveAllContacts(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling);
+    contactlist_6_6.clear();
+    contactlist_6_3.clear();
+    contactlist_3_3.clear();
+    contactlist_333_3.clear();
+    contactlist_333_6.clear();
+    contactlist_333_333.clear();
+    contactlist_666_3.clear();
+    contactlist_666_6.clear();
+    contactlist_666_333.clear();
+    contactlist_666_666.clear();
+    contactlist_6_6_rolling.clear();
+}
+
+// -----------------------------------------------------------------------------
+// Persistent contact cache
+// -----------------------------------------------------------------------------
+
+size_t ChContactContainerNSC::ContactKeyHash::operator()(const ContactKey& key) const {
+    std::hash<const void*> hp;
+    std::hash<int> hi;
+    size_t h = hp(key.objA);
+    h ^= hp(key.objB) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    h ^= hp(key.shapeA) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    h ^= hp(key.shapeB) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    h ^= hi(key.featureA) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    h ^= hi(key.featureB) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    return h;
+}
+
+void ChContactContainerNSC::EnableContactCache(bool val) {
+    cache_enabled = val;
+    cache_index.clear();
+    cache_entries.clear();
+    cache_hits = 0;
+}
+
+// Contact torque (only rolling contacts carry a reaction torque)
+template <class Tcont>
+static ChVector<> _GetCachedTorque(Tcont* contact) {
+    return VNULL;
 }
 
-void ChContactContainerNSC::BeginAddContact() {
-    lastcontact_6_6 = contactlist_6_6.begin();
-    n_added_6_6 = 0;
-
-    lastcontact_6_3 = contactlist_6_3.begin();
-    n_added_6_3 = 0;
-
-    lastcontact_3_3 = contactlist_3_3.begin();
-    n_added_3_3 = 0;
-
-    lastcontact_333_3 = contactlist_333_3.begin();
-    n_added_333_3 = 0;
-
-    lastcontact_333_6 = contactlist_333_6.begin();
-    n_added_333_6 = 0;
-
-    lastcontact_333_333 = contactlist_333_333.begin();
-    n_added_333_333 = 0;
-
-    lastcontact_666_3 = contactlist_666_3.begin();
-    n_added_666_3 = 0;
-
-    lastcontact_666_6 = contactlist_666_6.begin();
-    n_added_666_6 = 0;
-
-    lastcontact_666_333 = contactlist_666_333.begin();
-    n_added_666_333 = 0;
+static ChVector<> _GetCachedTorque(ChContactContainerNSC::ChContactNSCrolling_6_6* contact) {
+    return contact->GetContactTorque();
+}
 
-    lastcontact_666_666 = contactlist_666_666.begin();
-    n_added_666_666 = 0;
+template <class Tcont>
+static void _SetCachedTorque(Tcont* contact, const ChVector<>& torque) {}
 
-    lastcontact_6_6_rolling = contactlist_6_6_rolling.begin();
-    n_added_6_6_rolling = 0;
+static void _SetCachedTorque(ChContactContainerNSC::ChContactNSCrolling_6_6* contact, const ChVector<>& torque) {
+    contact->SetContactTorque(torque);
 }
 
-void ChContactContainerNSC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
+template <class Tcont>
+void ChContactContainerNSC::StoreCachedReactions(const ChContactPool<Tcont>& pool) {
+    for (auto contact : pool) {
+        ContactKey key = {contact->GetObjA(),   contact->GetObjB(),     contact->GetShapeA(),
+                          contact->GetShapeB(), contact->GetFeatureA(), contact->GetFeatureB()};
+        const ChMatrix33<>& plane = contact->GetContactPlane();
+
+        CachedReactions entry;
+        entry.point = (contact->GetContactP1() + contact->GetContactP2()) * 0.5;
+        entry.force = plane * contact->GetContactForce();
+        entry.torque = plane * _GetCachedTorque(contact);
+        entry.used = false;
+
+        // Prepend to the list of entries with the same key
+        auto ins = cache_index.insert(std::make_pair(key, (int)cache_entries.size()));
+        entry.next = ins.second ? -1 : ins.first->second;
+        ins.first->second = (int)cache_entries.size();
+        cache_entries.push_back(entry);
     }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
+}
+
+template <class Tcont>
+void ChContactContainerNSC::LoadCachedReactions(const ChContactPool<Tcont>& pool) {
+    double tol2 = cache_tolerance * cache_tolerance;
+    for (auto contact : pool) {
+        ContactKey key = {contact->GetObjA(),   contact->GetObjB(),     contact->GetShapeA(),
+                          contact->GetShapeB(), contact->GetFeatureA(), contact->GetFeatureB()};
+        auto found = cache_index.find(key);
+        if (found == cache_index.end())
+            continue;
+
+        // Find the closest unused cached contact point with the same key
+        ChVector<> point = (contact->GetContactP1() + contact->GetContactP2()) * 0.5;
+        int best = -1;
+        double best_dist2 = tol2;
+        for (int i = found->second; i != -1; i = cache_entries[i].next) {
+            if (cache_entries[i].used)
+                continue;
+            double dist2 = (cache_entries[i].point - point).Length2();
+            if (dist2 <= best_dist2) {
+                best = i;
+                best_dist2 = dist2;
+            }
+        }
+        if (best == -1)
+            continue;
+
+        // Express the cached reactions in the new contact plane
+        const ChMatrix33<>& plane = contact->GetContactPlane();
+        contact->SetContactForce(plane.transpose() * cache_entries[best].force);
+        _SetCachedTorque(contact, plane.transpose() * cache_entries[best].torque);
+        cache_entries[best].used = true;
+        cache_hits++;
     }
+}
 
-    while (lastcontact_6_6_rolling != contactlist_6_6_rolling.end()) {
-        delete (*lastcontact_6_6_rolling);
-        lastcontact_6_6_rolling = contactlist_6_6_rolling.erase(lastcontact_6_6_rolling);
+// -----------------------------------------------------------------------------
+
+void ChContactContainerNSC::BeginAddContact() {
+    if (cache_enabled) {
+        // Harvest the reactions of the contacts from the previous step, before the contacts are reused
+        cache_index.clear();
+        cache_entries.clear();
+        StoreCachedReactions(contactlist_6_6);
+        StoreCachedReactions(contactlist_6_3);
+        StoreCachedReactions(contactlist_3_3);
+        StoreCachedReactions(contactlist_333_3);
+        StoreCachedReactions(contactlist_333_6);
+        StoreCachedReactions(contactlist_333_333);
+        StoreCachedReactions(contactlist_666_3);
+        StoreCachedReactions(contactlist_666_6);
+        StoreCachedReactions(contactlist_666_333);
+        StoreCachedReactions(contactlist_666_666);
+        StoreCachedReactions(contactlist_6_6_rolling);
     }
+
+    contactlist_6_6.Rewind();
+    contactlist_6_3.Rewind();
+    contactlist_3_3.Rewind();
+    contactlist_333_3.Rewind();
+    contactlist_333_6.Rewind();
+    contactlist_333_333.Rewind();
+    contactlist_666_3.Rewind();
+    contactlist_666_6.Rewind();
+    contactlist_666_333.Rewind();
+    contactlist_666_666.Rewind();
+    contactlist_6_6_rolling.Rewind();
 }
 
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,           // contact list
-                           Titer& lastcontact,                       // last contact acquired
-                           int& n_added,                             // number of contacts inserted
-                           ChContactContainer* container,            // contact container
-                           Ta* objA,                                 // collidable object A
-                           Tb* objB,                                 // collidable object B
-                           const collision::ChCollisionInfo& cinfo,  // collision information
-                           const ChMaterialCompositeNSC& cmat        // composite material
-) {
-    if (lastcontact != contactlist.end()) {
-        // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat);
-        lastcontact++;
-    } else {
-        // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
+void ChContactContainerNSC::EndAddContact() {
+    CH_TRACE_SCOPE("ContactContainerNSC::EndAddContact", "contact");
+    // remove contacts that were not reused
+    contactlist_6_6.Trim();
+    contactlist_6_3.Trim();
+    contactlist_3_3.Trim();
+    contactlist_333_3.Trim();
+    contactlist_333_6.Trim();
+    contactlist_333_333.Trim();
+    contactlist_666_3.Trim();
+    contactlist_666_6.Trim();
+    contactlist_666_333.Trim();
+    contactlist_666_666.Trim();
+    contactlist_6_6_rolling.Trim();
+
+    cache_hits = 0;
+    if (cache_enabled) {
+        // Initialize the reactions of the new contacts from the persistent cache
+        LoadCachedReactions(contactlist_6_6);
+        LoadCachedReactions(contactlist_6_3);
+        LoadCachedReactions(contactlist_3_3);
+        LoadCachedReactions(contactlist_333_3);
+        LoadCachedReactions(contactlist_333_6);
+        LoadCachedReactions(contactlist_333_333);
+        LoadCachedReactions(contactlist_666_3);
+        LoadCachedReactions(contactlist_666_6);
+        LoadCachedReactions(contactlist_666_333);
+        LoadCachedReactions(contactlist_666_666);
+        LoadCachedReactions(contactlist_6_6_rolling);
     }
-    n_added++;
 }
 
 void ChContactContainerNSC::AddContact(const collision::ChCollisionInfo& cinfo,
@@ -271,22 +295,22 @@ void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                contactlist_3_3.Add(this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo, cmat);
+                contactlist_6_3.Add(this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA, swapped_cinfo, cmat);
+                contactlist_333_3.Add(this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA, swapped_cinfo, cmat);
+                contactlist_666_3.Add(this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -295,25 +319,25 @@ void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                contactlist_6_3.Add(this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6    ***NOTE: for body-body one could have rolling friction: ***
                 if (cmat.rolling_friction || cmat.spinning_friction) {
-                    _OptimalContactInsert(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, this, objA, objB, cinfo, cmat);
+                    contactlist_6_6_rolling.Add(this, objA, objB, cinfo, cmat);
                 } else {
-                    _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                    contactlist_6_6.Add(this, objA, objB, cinfo, cmat);
                 }
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA, swapped_cinfo, cmat);
+                contactlist_333_6.Add(this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA, swapped_cinfo, cmat);
+                contactlist_666_6.Add(this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -322,20 +346,20 @@ void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo, cmat);
+                contactlist_333_3.Add(this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo, cmat);
+                contactlist_333_6.Add(this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB, cinfo, cmat);
+                contactlist_333_333.Add(this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA, swapped_cinfo, cmat);
+                contactlist_666_333.Add(this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -344,25 +368,25 @@ void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo, cmat);
+                contactlist_666_3.Add(this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo, cmat);
+                contactlist_666_6.Add(this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB, cinfo, cmat);
+                contactlist_666_333.Add(this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB, cinfo, cmat);
+                contactlist_666_666.Add(this, objA, objB, cinfo, cmat);
             }
         } break;
 
         default: {
             //// TODO Fallback to some dynamic-size allocated constraint for cases that were not trapped by the switch
-        } break; 
+        } break;
 
     }  // switch (contactableA->GetContactableType())
 }
@@ -399,31 +423,29 @@ ChVector<> ChContactContainerNSC::GetContactableTorque(ChContactable* contactabl
 }
 
 template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
+void _ReportAllContacts(ChContactPool<Tcont>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    for (size_t i = 0; i < contactlist.size(); i++) {
+        auto contact = contactlist[i];
         bool proceed = mcallback->OnReportContact(
-            (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
-            (*itercontact)->GetContactDistance(), (*itercontact)->GetEffectiveCurvatureRadius(),
-            (*itercontact)->GetContactForce(), VNULL, (*itercontact)->GetObjA(), (*itercontact)->GetObjB());
+            contact->GetContactP1(), contact->GetContactP2(), contact->GetContactPlane(),
+            contact->GetContactDistance(), contact->GetEffectiveCurvatureRadius(),
+            contact->GetContactForce(), VNULL, contact->GetObjA(), contact->GetObjB());
         if (!proceed)
             break;
-        ++itercontact;
     }
 }
 
 template <class Tcont>
-void _ReportAllContactsRolling(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
+void _ReportAllContactsRolling(ChContactPool<Tcont>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    for (size_t i = 0; i < contactlist.size(); i++) {
+        auto contact = contactlist[i];
         bool proceed = mcallback->OnReportContact(
-            (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
-            (*itercontact)->GetContactDistance(), (*itercontact)->GetEffectiveCurvatureRadius(),
-            (*itercontact)->GetContactForce(), (*itercontact)->GetContactTorque(), (*itercontact)->GetObjA(),
-            (*itercontact)->GetObjB());
+            contact->GetContactP1(), contact->GetContactP2(), contact->GetContactPlane(),
+            contact->GetContactDistance(), contact->GetEffectiveCurvatureRadius(),
+            contact->GetContactForce(), contact->GetContactTorque(), contact->GetObjA(),
+            contact->GetObjB());
         if (!proceed)
             break;
-        ++itercontact;
     }
 }
 
@@ -443,115 +465,140 @@ void ChContactContainerNSC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 
 ////////// STATE INTERFACE ////
 
+// Note: the state functions below operate on contacts that write only to their own slots in the L, Qc vectors (or to
+// their own constraints), so the loops over contacts of a given type are executed in parallel (using the number of
+// threads set through ChSystem::SetNumThreads). The only exception is IntLoadResidual_CqL, which scatters into the
+// residual entries of the contactables; see below.
+
 template <class Tcont>
 void _IntStateGatherReactions(unsigned int& coffset,
-                              std::list<Tcont*>& contactlist,
+                              ChContactPool<Tcont>& contactlist,
                               const unsigned int off_L,
                               ChVectorDynamic<>& L,
-                              const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContIntStateGatherReactions(off_L + coffset, L);
-        coffset += stride;
-        ++itercontact;
+                              const int stride,
+                              const int nthreads) {
+    int ncontacts = (int)contactlist.size();
+#pragma omp parallel for num_threads(nthreads) if (ncontacts > ChContactContainer::min_parallel_contacts)
+    for (int i = 0; i < ncontacts; i++) {
+        contactlist[i]->ContIntStateGatherReactions(off_L + coffset + i * stride, L);
     }
+    coffset += ncontacts * stride;
 }
 
 void ChContactContainerNSC::IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) {
+    int nthreads = GetSystem()->GetNumThreadsChrono();
     unsigned int coffset = 0;
-    _IntStateGatherReactions(coffset, contactlist_6_6, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_6_3, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_3_3, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_333_3, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_333_6, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_333_333, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_666_3, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_666_6, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_666_333, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_666_666, off_L, L, 3);
-    _IntStateGatherReactions(coffset, contactlist_6_6_rolling, off_L, L, 6);
+    _IntStateGatherReactions(coffset, contactlist_6_6, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_6_3, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_3_3, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_333_3, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_333_6, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_333_333, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_666_3, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_666_6, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_666_333, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_666_666, off_L, L, 3, nthreads);
+    _IntStateGatherReactions(coffset, contactlist_6_6_rolling, off_L, L, 6, nthreads);
 }
 
 template <class Tcont>
 void _IntStateScatterReactions(unsigned int& coffset,
-                               std::list<Tcont*>& contactlist,
+                               ChContactPool<Tcont>& contactlist,
                                const unsigned int off_L,
                                const ChVectorDynamic<>& L,
-                               const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContIntStateScatterReactions(off_L + coffset, L);
-        coffset += stride;
-        ++itercontact;
+                               const int stride,
+                               const int nthreads) {
+    int ncontacts = (int)contactlist.size();
+#pragma omp parallel for num_threads(nthreads) if (ncontacts > ChContactContainer::min_parallel_contacts)
+    for (int i = 0; i < ncontacts; i++) {
+        contactlist[i]->ContIntStateScatterReactions(off_L + coffset + i * stride, L);
     }
+    coffset += ncontacts * stride;
 }
 
 void ChContactContainerNSC::IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) {
+    int nthreads = GetSystem()->GetNumThreadsChrono();
     unsigned int coffset = 0;
-    _IntStateScatterReactions(coffset, contactlist_6_6, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_6_3, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_3_3, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_333_3, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_333_6, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_333_333, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_666_3, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_666_6, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_666_333, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_666_666, off_L, L, 3);
-    _IntStateScatterReactions(coffset, contactlist_6_6_rolling, off_L, L, 6);
-}
-
+    _IntStateScatterReactions(coffset, contactlist_6_6, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_6_3, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_3_3, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_333_3, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_333_6, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_333_333, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_666_3, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_666_6, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_666_333, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_666_666, off_L, L, 3, nthreads);
+    _IntStateScatterReactions(coffset, contactlist_6_6_rolling, off_L, L, 6, nthreads);
+}
+
+// Note: this function contains an orphaned work-sharing loop. If called from within a parallel region, the contacts
+// are distributed among the threads of the team (each thread providing its own R); otherwise they are processed
+// serially, in order.
 template <class Tcont>
-void _IntLoadResidual_CqL(unsigned int& coffset,           // offset of the contacts
-                          std::list<Tcont*>& contactlist,  // list of contacts
-                          const unsigned int off_L,        // offset in L multipliers
-                          ChVectorDynamic<>& R,            // result: the R residual, R += c*Cq'*L
-                          const ChVectorDynamic<>& L,      // the L vector
-                          const double c,                  // a scaling factor
-                          const int stride                 // stride
+void _IntLoadResidual_CqL(unsigned int& coffset,              // offset of the contacts
+                          ChContactPool<Tcont>& contactlist,  // list of contacts
+                          const unsigned int off_L,           // offset in L multipliers
+                          ChVectorDynamic<>& R,               // result: the R residual, R += c*Cq'*L
+                          const ChVectorDynamic<>& L,         // the L vector
+                          const double c,                     // a scaling factor
+                          const int stride                    // stride
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContIntLoadResidual_CqL(off_L + coffset, R, L, c);
-        coffset += stride;
-        ++itercontact;
+    int ncontacts = (int)contactlist.size();
+#pragma omp for schedule(static)
+    for (int i = 0; i < ncontacts; i++) {
+        contactlist[i]->ContIntLoadResidual_CqL(off_L + coffset + i * stride, R, L, c);
     }
+    coffset += ncontacts * stride;
 }
 
 void ChContactContainerNSC::IntLoadResidual_CqL(const unsigned int off_L,
                                                 ChVectorDynamic<>& R,
                                                 const ChVectorDynamic<>& L,
                                                 const double c) {
-    unsigned int coffset = 0;
-    _IntLoadResidual_CqL(coffset, contactlist_6_6, off_L, R, L, c, 3);
-    _IntLoadResidual_CqL(coffset, contactlist_6_3, off_L, R, L, c, 3);
-    _IntLoadResidual_CqL(coffset, contactlist_3_3, off_L, R, L, c, 3);
-    _IntLoadResidual_CqL(coffset, contactlist_333_3, off_L, R, L, c, 3);
-    _IntLoadResidual_CqL(coffset, contactlist_333_6, off_L, R, L, c, 3);
-    _IntLoadResidual_CqL(coffset, contactlist_333_333, off_L, R, L, c, 3);
-    _IntLoadResidual_CqL(coffset, contactlist_666_3, off_L, R, L, c, 3);
-    _IntLoadResidual_CqL(coffset, contactlist_666_6, off_L, R, L, c, 3);
-    _IntLoadResidual_CqL(coffset, contactlist_666_333, off_L, R, L, c, 3);
-    _IntLoadResidual_CqL(coffset, contactlist_666_666, off_L, R, L, c, 3);
-    _IntLoadResidual_CqL(coffset, contactlist_6_6_rolling, off_L, R, L, c, 6);
+    CH_TRACE_SCOPE("ContactContainerNSC::IntLoadResidual_CqL", "contact");
+    auto load = [&](ChVectorDynamic<>& Rt) {
+        unsigned int coffset = 0;
+        _IntLoadResidual_CqL(coffset, contactlist_6_6, off_L, Rt, L, c, 3);
+        _IntLoadResidual_CqL(coffset, contactlist_6_3, off_L, Rt, L, c, 3);
+        _IntLoadResidual_CqL(coffset, contactlist_3_3, off_L, Rt, L, c, 3);
+        _IntLoadResidual_CqL(coffset, contactlist_333_3, off_L, Rt, L, c, 3);
+        _IntLoadResidual_CqL(coffset, contactlist_333_6, off_L, Rt, L, c, 3);
+        _IntLoadResidual_CqL(coffset, contactlist_333_333, off_L, Rt, L, c, 3);
+        _IntLoadResidual_CqL(coffset, contactlist_666_3, off_L, Rt, L, c, 3);
+        _IntLoadResidual_CqL(coffset, contactlist_666_6, off_L, Rt, L, c, 3);
+        _IntLoadResidual_CqL(coffset, contactlist_666_333, off_L, Rt, L, c, 3);
+        _IntLoadResidual_CqL(coffset, contactlist_666_666, off_L, Rt, L, c, 3);
+        _IntLoadResidual_CqL(coffset, contactlist_6_6_rolling, off_L, Rt, L, c, 6);
+    };
+
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+    if (nthreads == 1 || GetNcontacts() <= min_parallel_contacts) {
+        load(R);
+        return;
+    }
+
+    // Contacts scatter into the residual entries of the contactables, which are shared among contacts.
+    LoadResidualParallel(R, nthreads, load);
 }
 
 template <class Tcont>
-void _IntLoadConstraint_C(unsigned int& coffset,           // contact offset
-                          std::list<Tcont*>& contactlist,  // contact list
-                          const unsigned int off,          // offset in Qc residual
-                          ChVectorDynamic<>& Qc,           // result: the Qc residual, Qc += c*C
-                          const double c,                  // a scaling factor
-                          bool do_clamp,                   // apply clamping to c*C?
-                          double recovery_clamp,           // value for min/max clamping of c*C
-                          const int stride                 // stride
+void _IntLoadConstraint_C(unsigned int& coffset,              // contact offset
+                          ChContactPool<Tcont>& contactlist,  // contact list
+                          const unsigned int off,             // offset in Qc residual
+                          ChVectorDynamic<>& Qc,              // result: the Qc residual, Qc += c*C
+                          const double c,                     // a scaling factor
+                          bool do_clamp,                      // apply clamping to c*C?
+                          double recovery_clamp,              // value for min/max clamping of c*C
+                          const int stride,                   // stride
+                          const int nthreads                  // number of threads
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContIntLoadConstraint_C(off + coffset, Qc, c, do_clamp, recovery_clamp);
-        coffset += stride;
-        ++itercontact;
+    int ncontacts = (int)contactlist.size();
+#pragma omp parallel for num_threads(nthreads) if (ncontacts > ChContactContainer::min_parallel_contacts)
+    for (int i = 0; i < ncontacts; i++) {
+        contactlist[i]->ContIntLoadConstraint_C(off + coffset + i * stride, Qc, c, do_clamp, recovery_clamp);
     }
+    coffset += ncontacts * stride;
 }
 
 void ChContactContainerNSC::IntLoadConstraint_C(const unsigned int off,
@@ -559,36 +606,39 @@ void ChContactContainerNSC::IntLoadConstraint_C(const unsigned int off,
                                                 const double c,
                                                 bool do_clamp,
                                                 double recovery_clamp) {
+    CH_TRACE_SCOPE("ContactContainerNSC::IntLoadConstraint_C", "contact");
+    int nthreads = GetSystem()->GetNumThreadsChrono();
     unsigned int coffset = 0;
-    _IntLoadConstraint_C(coffset, contactlist_6_6, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_6_3, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_3_3, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_333_3, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_333_6, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_333_333, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_666_3, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_666_6, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_666_333, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_666_666, off, Qc, c, do_clamp, recovery_clamp, 3);
-    _IntLoadConstraint_C(coffset, contactlist_6_6_rolling, off, Qc, c, do_clamp, recovery_clamp, 6);
+    _IntLoadConstraint_C(coffset, contactlist_6_6, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_6_3, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_3_3, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_333_3, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_333_6, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_333_333, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_666_3, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_666_6, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_666_333, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_666_666, off, Qc, c, do_clamp, recovery_clamp, 3, nthreads);
+    _IntLoadConstraint_C(coffset, contactlist_6_6_rolling, off, Qc, c, do_clamp, recovery_clamp, 6, nthreads);
 }
 
 template <class Tcont>
 void _IntToDescriptor(unsigned int& coffset,
-                      std::list<Tcont*>& contactlist,
+                      ChContactPool<Tcont>& contactlist,
                       const unsigned int off_v,
                       const ChStateDelta& v,
                       const ChVectorDynamic<>& R,
                       const unsigned int off_L,
                       const ChVectorDynamic<>& L,
                       const ChVectorDynamic<>& Qc,
-                      const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContIntToDescriptor(off_L + coffset, L, Qc);
-        coffset += stride;
-        ++itercontact;
+                      const int stride,
+                      const int nthreads) {
+    int ncontacts = (int)contactlist.size();
+#pragma omp parallel for num_threads(nthreads) if (ncontacts > ChContactContainer::min_parallel_contacts)
+    for (int i = 0; i < ncontacts; i++) {
+        contactlist[i]->ContIntToDescriptor(off_L + coffset + i * stride, L, Qc);
     }
+    coffset += ncontacts * stride;
 }
 
 void ChContactContainerNSC::IntToDescriptor(const unsigned int off_v,
@@ -597,66 +647,71 @@ void ChContactContainerNSC::IntToDescriptor(const unsigned int off_v,
                                             const unsigned int off_L,
                                             const ChVectorDynamic<>& L,
                                             const ChVectorDynamic<>& Qc) {
+    CH_TRACE_SCOPE("ContactContainerNSC::IntToDescriptor", "contact");
+    int nthreads = GetSystem()->GetNumThreadsChrono();
     unsigned int coffset = 0;
-    _IntToDescriptor(coffset, contactlist_6_6, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_6_3, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_3_3, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_333_3, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_333_6, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_333_333, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_666_3, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_666_6, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_666_333, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_666_666, off_v, v, R, off_L, L, Qc, 3);
-    _IntToDescriptor(coffset, contactlist_6_6_rolling, off_v, v, R, off_L, L, Qc, 6);
+    _IntToDescriptor(coffset, contactlist_6_6, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_6_3, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_3_3, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_333_3, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_333_6, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_333_333, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_666_3, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_666_6, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_666_333, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_666_666, off_v, v, R, off_L, L, Qc, 3, nthreads);
+    _IntToDescriptor(coffset, contactlist_6_6_rolling, off_v, v, R, off_L, L, Qc, 6, nthreads);
 }
 
 template <class Tcont>
 void _IntFromDescriptor(unsigned int& coffset,
-                        std::list<Tcont*>& contactlist,
+                        ChContactPool<Tcont>& contactlist,
                         const unsigned int off_v,
                         ChStateDelta& v,
                         const unsigned int off_L,
                         ChVectorDynamic<>& L,
-                        const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContIntFromDescriptor(off_L + coffset, L);
-        coffset += stride;
-        ++itercontact;
+                        const int stride,
+                        const int nthreads) {
+    int ncontacts = (int)contactlist.size();
+#pragma omp parallel for num_threads(nthreads) if (ncontacts > ChContactContainer::min_parallel_contacts)
+    for (int i = 0; i < ncontacts; i++) {
+        contactlist[i]->ContIntFromDescriptor(off_L + coffset + i * stride, L);
     }
+    coffset += ncontacts * stride;
 }
 
 void ChContactContainerNSC::IntFromDescriptor(const unsigned int off_v,
                                               ChStateDelta& v,
                                               const unsigned int off_L,
                                               ChVectorDynamic<>& L) {
+    CH_TRACE_SCOPE("ContactContainerNSC::IntFromDescriptor", "contact");
+    int nthreads = GetSystem()->GetNumThreadsChrono();
     unsigned int coffset = 0;
-    _IntFromDescriptor(coffset, contactlist_6_6, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_6_3, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_3_3, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_333_3, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_333_6, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_333_333, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_666_3, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_666_6, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_666_333, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_666_666, off_v, v, off_L, L, 3);
-    _IntFromDescriptor(coffset, contactlist_6_6_rolling, off_v, v, off_L, L, 6);
+    _IntFromDescriptor(coffset, contactlist_6_6, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_6_3, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_3_3, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_333_3, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_333_6, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_333_333, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_666_3, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_666_6, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_666_333, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_666_666, off_v, v, off_L, L, 3, nthreads);
+    _IntFromDescriptor(coffset, contactlist_6_6_rolling, off_v, v, off_L, L, 6, nthreads);
 }
 
 // SOLVER INTERFACES
 
 template <class Tcont>
-void _InjectConstraints(std::list<Tcont*>& contactlist, ChSystemDescriptor& mdescriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->InjectConstraints(mdescriptor);
-        ++itercontact;
+void _InjectConstraints(ChContactPool<Tcont>& contactlist, ChSystemDescriptor& mdescriptor) {
+    for (size_t i = 0; i < contactlist.size(); i++) {
+        auto contact = contactlist[i];
+        contact->InjectConstraints(mdescriptor);
     }
 }
 
 void ChContactContainerNSC::InjectConstraints(ChSystemDescriptor& mdescriptor) {
+    CH_TRACE_SCOPE("ContactContainerNSC::InjectConstraints", "contact");
     _InjectConstraints(contactlist_6_6, mdescriptor);
     _InjectConstraints(contactlist_6_3, mdescriptor);
     _InjectConstraints(contactlist_3_3, mdescriptor);
@@ -671,11 +726,10 @@ void ChContactContainerNSC::InjectConstraints(ChSystemDescriptor& mdescriptor) {
 }
 
 template <class Tcont>
-void _ConstraintsBiReset(std::list<Tcont*>& contactlist) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ConstraintsBiReset();
-        ++itercontact;
+void _ConstraintsBiReset(ChContactPool<Tcont>& contactlist) {
+    for (size_t i = 0; i < contactlist.size(); i++) {
+        auto contact = contactlist[i];
+        contact->ConstraintsBiReset();
     }
 }
 
@@ -694,11 +748,10 @@ void ChContactContainerNSC::ConstraintsBiReset() {
 }
 
 template <class Tcont>
-void _ConstraintsBiLoad_C(std::list<Tcont*>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
-        ++itercontact;
+void _ConstraintsBiLoad_C(ChContactPool<Tcont>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
+    for (size_t i = 0; i < contactlist.size(); i++) {
+        auto contact = contactlist[i];
+        contact->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
     }
 }
 
@@ -721,12 +774,11 @@ void ChContactContainerNSC::ConstraintsLoadJacobians() {
 }
 
 template <class Tcont>
-void _ConstraintsFetch_react(std::list<Tcont*>& contactlist, double factor) {
+void _ConstraintsFetch_react(ChContactPool<Tcont>& contactlist, double factor) {
     // From constraints to react vector:
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ConstraintsFetch_react(factor);
-        ++itercontact;
+    for (size_t i = 0; i < contactlist.size(); i++) {
+        auto contact = contactlist[i];
+        contact->ConstraintsFetch_react(factor);
     }
 }
 
@@ -15,19 +15,19 @@
 #ifndef CH_CONTACTCONTAINER_NSC_H
 #define CH_CONTACTCONTAINER_NSC_H
 
-#include <list>
-
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactNSC.h"
 #include "chrono/physics/ChContactNSCrolling.h"
+#include "chrono/physics/ChContactPool.h"
 #include "chrono/physics/ChContactable.h"
 
 namespace chrono {
 
 /// Class representing a container of many non-smooth contacts.
-/// Implemented using linked lists of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
-/// reactions). It might also contain ChContactNSCrolling objects (extended versions of ChContactNSC, with 6 reactions,
-/// that account also for rolling and spinning resistance), but also for '6dof vs 6dof' contactables.
+/// Implemented using contiguous pools of ChContactNSC objects (that is, contacts between two ChContactable objects, with
+/// 3 reactions), one pool per pair of contactable types. It might also contain ChContactNSCrolling objects (extended
+/// versions of ChContactNSC, with 6 reactions, that account also for rolling and spinning resistance), but also for
+/// '6dof vs 6dof' contactables.
 class ChApi ChContactContainerNSC : public ChContactContainer {
   public:
     typedef ChContactNSC<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactNSC_6_6;
@@ -44,46 +44,55 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     typedef ChContactNSCrolling<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactNSCrolling_6_6;
 
   protected:
-    std::list<ChContactNSC_6_6*> contactlist_6_6;
-    std::list<ChContactNSC_6_3*> contactlist_6_3;
-    std::list<ChContactNSC_3_3*> contactlist_3_3;
-    std::list<ChContactNSC_333_3*> contactlist_333_3;
-    std::list<ChContactNSC_333_6*> contactlist_333_6;
-    std::list<ChContactNSC_333_333*> contactlist_333_333;
-    std::list<ChContactNSC_666_3*> contactlist_666_3;
-    std::list<ChContactNSC_666_6*> contactlist_666_6;
-    std::list<ChContactNSC_666_333*> contactlist_666_333;
-    std::list<ChContactNSC_666_666*> contactlist_666_666;
-
-    std::list<ChContactNSCrolling_6_6*> contactlist_6_6_rolling;
-
-    int n_added_6_6;
-    int n_added_6_3;
-    int n_added_3_3;
-    int n_added_333_3;
-    int n_added_333_6;
-    int n_added_333_333;
-    int n_added_666_3;
-    int n_added_666_6;
-    int n_added_666_333;
-    int n_added_666_666;
-    int n_added_6_6_rolling;
-
-    std::list<ChContactNSC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactNSC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactNSC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactNSC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactNSC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactNSC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactNSC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactNSC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactNSC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactNSC_666_666*>::iterator lastcontact_666_666;
-
-    std::list<ChContactNSCrolling_6_6*>::iterator lastcontact_6_6_rolling;
+    ChContactPool<ChContactNSC_6_6> contactlist_6_6;
+    ChContactPool<ChContactNSC_6_3> contactlist_6_3;
+    ChContactPool<ChContactNSC_3_3> contactlist_3_3;
+    ChContactPool<ChContactNSC_333_3> contactlist_333_3;
+    ChContactPool<ChContactNSC_333_6> contactlist_333_6;
+    ChContactPool<ChContactNSC_333_333> contactlist_333_333;
+    ChContactPool<ChContactNSC_666_3> contactlist_666_3;
+    ChContactPool<ChContactNSC_666_6> contactlist_666_6;
+    ChContactPool<ChContactNSC_666_333> contactlist_666_333;
+    ChContactPool<ChContactNSC_666_666> contactlist_666_666;
+
+    ChContactPool<ChContactNSCrolling_6_6> contactlist_6_6_rolling;
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
+    /// Identifier of a contact which persists over steps: pair of contactables, pair of collision shapes, and pair
+    /// of narrowphase features.
+    struct ContactKey {
+        const void* objA;
+        const void* objB;
+        const void* shapeA;
+        const void* shapeB;
+        int featureA;
+        int featureB;
+        bool operator==(const ContactKey& other) const {
+            return objA == other.objA && objB == other.objB && shapeA == other.shapeA && shapeB == other.shapeB &&
+                   featureA == other.featureA && featureB == other.featureB;
+        }
+    };
+
+    struct ContactKeyHash {
+        size_t operator()(const ContactKey& key) const;
+    };
+
+    /// Reactions of a contact at the end of the previous step (in absolute frame).
+    struct CachedReactions {
+        ChVector<> point;   ///< contact point (midpoint between the two contact points)
+        ChVector<> force;   ///< contact force
+        ChVector<> torque;  ///< contact torque (rolling and spinning resistance)
+        int next;           ///< next entry with the same key (-1 if none)
+        bool used;          ///< true if already matched to a new contact
+    };
+
+    bool cache_enabled;                                               ///< use the persistent contact cache
+    double cache_tolerance;                                           ///< max. contact point motion for matching
+    int cache_hits;                                                   ///< number of contacts warm started from cache
+    std::unordered_map<ContactKey, int, ContactKeyHash> cache_index;  ///< first cache entry for each contact key
+    std::vector<CachedReactions> cache_entries;                       ///< cached contact reactions
+
   public:
     ChContactContainerNSC();
     ChContactContainerNSC(const ChContactContainerNSC& other);
@@ -92,10 +101,33 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChContactContainerNSC* Clone() const override { return new ChContactContainerNSC(*this); }
 
+    /// Enable/disable the persistent contact cache (default: false).
+    /// If enabled, the reactions of all contacts at the end of a step are stored, keyed by the pair of contactables,
+    /// the pair of collision shapes, and the pair of narrowphase features (e.g. child shape or triangle index with the
+    /// Bullet collision system, index of the contact point within the shape pair with the Chrono collision system). The
+    /// contacts created at the next collision detection pass are matched against this cache (the closest cached
+    /// contact point with the same key, within the cache tolerance) and their reactions are initialized with the
+    /// cached values, rotated in the new contact plane. Together with a solver warm start (see
+    /// ChIterativeSolver::EnableWarmStart), this reduces the number of solver iterations in persistent contact
+    /// configurations (e.g. stacking), independently of the order in which contacts are reported.
+    void EnableContactCache(bool val);
+
+    /// Return true if the persistent contact cache is enabled.
+    bool IsContactCacheEnabled() const { return cache_enabled; }
+
+    /// Set the maximum distance between the locations of a contact point in consecutive steps for it to be
+    /// identified as the same contact (default: 0.01).
+    void SetContactCacheTolerance(double tol) { cache_tolerance = tol; }
+
+    /// Return the number of contacts that were initialized from the persistent cache in the last collision pass.
+    int GetNumCachedContacts() const { return cache_hits; }
+
     /// Report the number of added contacts.
     virtual int GetNcontacts() const override {
-        return n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-               n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666 + n_added_6_6_rolling;
+        return (int)(contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() +
+                     contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +
+                     contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +
+                     contactlist_666_666.size() + contactlist_6_6_rolling.size());
     }
 
     /// Remove (delete) all contained contact data.
@@ -103,7 +135,7 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
     /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
+    /// the contact pools and tries to reuse previous contact objects until possible, to avoid too much
     /// allocation/deallocation.
     virtual void BeginAddContact() override;
 
@@ -120,7 +152,7 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void AddContact(const collision::ChCollisionInfo& cinfo) override;
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). This optimized version destroys the contacts that were not reused (if any), but keeps the pool memory.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -129,11 +161,7 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     /// Report the number of scalar unilateral constraints.
     /// Note: friction constraints aren't exactly unilaterals, but they are still counted.
-    virtual int GetDOC_d() override {
-        return 3 * (n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-                    n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666) +
-               6 * (n_added_6_6_rolling);
-    }
+    virtual int GetDOC_d() override { return 3 * GetNcontacts() + 3 * (int)contactlist_6_6_rolling.size(); }
 
     /// Update state of this contact container: compute jacobians, violations, etc.
     /// and store results in inner structures of contacts.
@@ -197,6 +225,14 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
   private:
     void InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeNSC& cmat);
+
+    /// Store the reactions of all contacts in the given pool in the persistent cache.
+    template <class Tcont>
+    void StoreCachedReactions(const ChContactPool<Tcont>& pool);
+
+    /// Initialize the reactions of all contacts in the given pool from the persistent cache.
+    template <class Tcont>
+    void LoadCachedReactions(const ChContactPool<Tcont>& pool);
 };
 
 CH_CLASS_VERSION(ChContactContainerNSC, 0)
@@ -107,6 +107,9 @@ class ChContactNSCrolling : public ChContactNSC<Ta, Tb> {
     /// Get the contact force, if computed, in contact coordinate system
     virtual ChVector<> GetContactTorque() { return react_torque; }
 
+    /// Set the contact torque, in contact coordinate system (e.g. to warm start the solver).
+    void SetContactTorque(const ChVector<>& torque) { react_torque = torque; }
+
     /// Get the contact rolling friction coefficient
     virtual float GetRollingFriction() { return Rx.GetRollingFrictionCoefficient(); }
     /// Set the contact rolling friction coefficient
@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_CONTACT_POOL_H
+#define CH_CONTACT_POOL_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+/// Contiguous, chunked storage for contacts of one type (e.g. ChContactNSC<Ta,Tb>).
+/// Contacts are constructed in place in fixed-size chunks of aligned memory. Chunks are never reallocated, so the
+/// address of a contact is stable for as long as it is in the pool (contacts store pointers to their own constraints,
+/// which are also referenced by the system descriptor). Between two collision detection passes the pool is rewound
+/// with Rewind() and existing contact objects are reinitialized in place, so that in steady state no heap allocation
+/// takes place and all traversals walk contiguous memory.
+/// The interface mimics the subset of std::list<Tcont*> used by contact containers: iterating the pool yields pointers
+/// to the active contacts, in insertion order.
+template <class Tcont, int ChunkBits = 8>
+class ChContactPool {
+  public:
+    static const size_t chunk_size = size_t(1) << ChunkBits;
+
+    ChContactPool() : n_active(0), n_constructed(0) {}
+    ~ChContactPool() { clear(); }
+
+    /// Copying a pool is not allowed (contacts are referenced by address).
+    ChContactPool(const ChContactPool&) = delete;
+    ChContactPool& operator=(const ChContactPool&) = delete;
+
+    /// Forward iterator over the active contacts. Dereferencing yields a Tcont*.
+    class iterator {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Tcont* value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Tcont* const* pointer;
+        typedef Tcont* reference;
+
+        iterator() : pool(nullptr), index(0) {}
+        iterator(const ChContactPool* p, size_t i) : pool(p), index(i) {}
+
+        Tcont* operator*() const { return pool->at(index); }
+        iterator& operator++() {
+            ++index;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator tmp(*this);
+            ++index;
+            return tmp;
+        }
+        bool operator==(const iterator& other) const { return index == other.index; }
+        bool operator!=(const iterator& other) const { return index != other.index; }
+
+      private:
+        const ChContactPool* pool;
+        size_t index;
+    };
+
+    typedef iterator const_iterator;
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, n_active); }
+
+    /// Number of active contacts (i.e. added since the last call to Rewind).
+    size_t size() const { return n_active; }
+    bool empty() const { return n_active == 0; }
+
+    /// Number of contact objects currently constructed in the pool (active or available for reuse).
+    size_t constructed() const { return n_constructed; }
+
+    /// Number of contacts that can be stored without allocating a new chunk.
+    size_t capacity() const { return chunks.size() * chunk_size; }
+
+    /// Direct access to the i-th active contact.
+    Tcont* at(size_t i) const { return chunks[i >> ChunkBits] + (i & (chunk_size - 1)); }
+    Tcont* operator[](size_t i) const { return at(i); }
+
+    /// Start a new insertion pass. Previously constructed contacts are kept and reused by Add().
+    void Rewind() { n_active = 0; }
+
+    /// Add a contact, reusing a previously constructed object (through its Reset() function) if available, or
+    /// constructing a new one in place otherwise.
+    template <class Tcontainer, class Ta, class Tb, class Tcinfo, class Tmat>
+    Tcont* Add(Tcontainer* container, Ta* objA, Tb* objB, const Tcinfo& cinfo, const Tmat& cmat) {
+        Tcont* mc;
+        if (n_active < n_constructed) {
+            mc = at(n_active);
+            mc->Reset(objA, objB, cinfo, cmat);
+        } else {
+            if (n_constructed == capacity())
+                chunks.push_back(allocator.allocate(chunk_size));
+            mc = at(n_constructed);
+            ::new (static_cast<void*>(mc)) Tcont(container, objA, objB, cinfo, cmat);
+            n_constructed++;
+        }
+        n_active++;
+        return mc;
+    }
+
+    /// Destroy all contacts that were not reused during the last insertion pass.
+    /// The chunk memory is retained for subsequent passes.
+    void Trim() {
+        while (n_constructed > n_active) {
+            n_constructed--;
+            at(n_constructed)->~Tcont();
+        }
+    }
+
+    /// Destroy all contacts and release all memory.
+    void clear() {
+        n_active = 0;
+        Trim();
+        for (auto chunk : chunks)
+            allocator.deallocate(chunk, chunk_size);
+        chunks.clear();
+    }
+
+  private:
+    std::vector<Tcont*> chunks;                  ///< chunks of contiguous (aligned) storage
+    Eigen::aligned_allocator<Tcont> allocator;  ///< allocator honoring the alignment of fixed-size Eigen members
+    size_t n_active;                             ///< number of contacts added in the current pass
+    size_t n_constructed;                        ///< number of contact objects alive in the pool
+};
+
+}  // end namespace chrono
+
+#endif
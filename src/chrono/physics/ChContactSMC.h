@@ -51,8 +51,9 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         ChMatrixDynamic<double> m_R;  ///< R = dQ/dv
     };
 
-    ChVector<> m_force;        ///< contact force on objB
-    ChContactJacobian* m_Jac;  ///< contact Jacobian data
+    ChVector<> m_force;            ///< contact force on objB
+    ChContactJacobian* m_Jac;      ///< contact Jacobian data
+    ChMaterialCompositeSMC m_mat;  ///< composite material for the contact pair
 
   public:
     ChContactSMC() : m_Jac(NULL) {}
@@ -84,6 +85,8 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     const ChMatrixDynamic<double>* GetJacobianR() const { return m_Jac ? &(m_Jac->m_R) : NULL; }
 
     /// Reinitialize this contact for reuse.
+    /// Only the collision data and the composite material are stored here; the contact force (and Jacobians) are
+    /// calculated by Evaluate().
     void Reset(Ta* mobjA,                                ///< collidable object A
                Tb* mobjB,                                ///< collidable object B
                const collision::ChCollisionInfo& cinfo,  ///< data for the collision pair
@@ -95,18 +98,26 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Note: cinfo.distance is the same as this->norm_dist.
         assert(cinfo.distance < 0);
 
+        m_mat = mat;
+    }
+
+    /// Calculate the contact force and, for stiff contact, the Jacobians of the generalized contact forces, at the
+    /// current states of the two objects.
+    /// The contact container calls this function once per collision detection pass. It only writes to this contact,
+    /// so different contacts can be evaluated concurrently.
+    void Evaluate() {
         // Calculate contact force.
         m_force = CalculateForce(-this->norm_dist,                            // overlap (here, always positive)
                                  this->normal,                                // normal contact direction
                                  this->objA->GetContactPointSpeed(this->p1),  // velocity of contact point on objA
                                  this->objB->GetContactPointSpeed(this->p2),  // velocity of contact point on objB
-                                 mat                                          // composite material for contact pair
+                                 m_mat                                        // composite material for contact pair
         );
 
         // Set up and compute Jacobian matrices.
         if (static_cast<ChSystemSMC*>(this->container->GetSystem())->GetStiffContact()) {
             CreateJacobians();
-            CalculateJacobians(mat);
+            CalculateJacobians(m_mat);
         }
     }
 
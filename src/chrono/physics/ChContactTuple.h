@@ -47,6 +47,11 @@ class ChContactTuple {
     double norm_dist;   ///< penetration distance (negative if going inside) after refining
     double eff_radius;  ///< effective radius of curvature at contact
 
+    collision::ChCollisionShape* shapeA;  ///< collision shape on A (may be null)
+    collision::ChCollisionShape* shapeB;  ///< collision shape on B (may be null)
+    int featureA;                         ///< narrowphase feature identifier on A (-1 if unknown)
+    int featureB;                         ///< narrowphase feature identifier on B (-1 if unknown)
+
   public:
     //
     // CONSTRUCTORS
@@ -88,6 +93,10 @@ class ChContactTuple {
         this->normal = cinfo.vN;
         this->norm_dist = cinfo.distance;
         this->eff_radius = cinfo.eff_radius;
+        this->shapeA = cinfo.shapeA;
+        this->shapeB = cinfo.shapeB;
+        this->featureA = cinfo.featureA;
+        this->featureB = cinfo.featureB;
 
         // Contact plane
         ChVector<> Vx, Vy, Vz;
@@ -133,6 +142,18 @@ class ChContactTuple {
     /// Get the effective radius of curvature.
     double GetEffectiveCurvatureRadius() const { return eff_radius; }
 
+    /// Get the collision shape on object A (may be null, if not provided by the collision system).
+    collision::ChCollisionShape* GetShapeA() const { return shapeA; }
+
+    /// Get the collision shape on object B (may be null, if not provided by the collision system).
+    collision::ChCollisionShape* GetShapeB() const { return shapeB; }
+
+    /// Get the narrowphase feature identifier on object A (e.g. child shape or triangle index), or -1 if unknown.
+    int GetFeatureA() const { return featureA; }
+
+    /// Get the narrowphase feature identifier on object B (e.g. child shape or triangle index), or -1 if unknown.
+    int GetFeatureB() const { return featureB; }
+
     /// Get the contact force, if computed, in contact coordinate system
     virtual ChVector<> GetContactForce() const { return ChVector<>(0); }
 
@@ -47,6 +47,9 @@ class ChApi ChLinkClearance : public ChLinkLockLock {
 
     // Updates marker positions, etc.
     virtual void UpdateTime(double mytime) override;
+
+    /// Return false: this link moves its markers (owned by the connected bodies) during updates.
+    virtual bool IsUpdateThreadSafe() const override { return false; }
     // Updates forces
     virtual void UpdateForces(double mytime) override;
 
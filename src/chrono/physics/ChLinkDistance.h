@@ -95,6 +95,9 @@ class ChApi ChLinkDistance : public ChLink {
     /// results in inner structures.
     virtual void Update(double mtime, bool update_assets = true) override;
 
+    /// Return true: updating this item only modifies its own data.
+    virtual bool IsUpdateThreadSafe() const override { return true; }
+
     //
     // STATE FUNCTIONS
     //
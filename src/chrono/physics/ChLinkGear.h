@@ -55,6 +55,9 @@ class ChApi ChLinkGear : public ChLinkLock {
     // Updates motion laws, marker positions, etc.
     virtual void UpdateTime(double mytime) override;
 
+    /// Return false: this link moves its markers (owned by the connected bodies) during updates.
+    virtual bool IsUpdateThreadSafe() const override { return false; }
+
     /// Get the transmission ratio. Its value is assumed always positive,
     /// both for inner and outer gears (so use Get_epicyclic() to distinguish)
     double Get_tau() const { return tau; }
@@ -55,6 +55,9 @@ class ChApi ChLinkLinActuator : public ChLinkLockLock {
     // Updates motion laws, marker positions, etc.
     virtual void UpdateTime(double mytime) override;
 
+    /// Return false: this link moves its markers (owned by the connected bodies) during updates.
+    virtual bool IsUpdateThreadSafe() const override { return false; }
+
     // data get/set
     std::shared_ptr<ChFunction> Get_dist_funct() const { return dist_funct; }
     std::shared_ptr<ChFunction> Get_motrot_funct() const { return mot_rot; }
@@ -159,6 +159,9 @@ class ChApi ChLinkLock : public ChLinkMarkers {
     /// </pre>
     virtual void Update(double mytime, bool update_assets = true) override;
 
+    /// Return true: updating this item only modifies its own data.
+    virtual bool IsUpdateThreadSafe() const override { return true; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
@@ -132,6 +132,9 @@ class ChApi ChLinkMateGeneric : public ChLinkMate {
     /// Override _all_ time, jacobian etc. updating.
     virtual void Update(double mtime, bool update_assets = true) override;
 
+    /// Return true: updating this item only modifies its own data.
+    virtual bool IsUpdateThreadSafe() const override { return true; }
+
     /// If some constraint is redundant, return to normal state
     virtual int RestoreRedundant() override;
 
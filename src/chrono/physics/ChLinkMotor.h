@@ -50,6 +50,9 @@ class ChApi ChLinkMotor : public ChLinkMateGeneric {
     /// Update state of the LinkMotor.
     virtual void Update(double mytime, bool update_assets) override;
 
+    /// Return false: the motor function, which may be shared with other items, is updated and evaluated here.
+    virtual bool IsUpdateThreadSafe() const override { return false; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
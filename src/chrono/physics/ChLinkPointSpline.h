@@ -45,6 +45,9 @@ class ChApi ChLinkPointSpline : public ChLinkLockLock {
     /// Update link at current configuration (moves the constraint main marker tangent to the line).
     virtual void UpdateTime(double mytime) override;
 
+    /// Return false: this link moves its markers (owned by the connected bodies) during updates.
+    virtual bool IsUpdateThreadSafe() const override { return false; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
@@ -57,6 +57,9 @@ class ChApi ChLinkPulley : public ChLinkLockLock {
     /// Updates motion laws, marker positions, etc.
     virtual void UpdateTime(double mytime) override;
 
+    /// Return false: this link moves its markers (owned by the connected bodies) during updates.
+    virtual bool IsUpdateThreadSafe() const override { return false; }
+
     /// Set radius of 1st pulley.
     void Set_r1(double mr);
 
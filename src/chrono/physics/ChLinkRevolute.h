@@ -84,6 +84,9 @@ class ChApi ChLinkRevolute : public ChLink {
     /// and constraint violations, cache in internal structures
     virtual void Update(double time, bool update_assets = true) override;
 
+    /// Return true: updating this item only modifies its own data.
+    virtual bool IsUpdateThreadSafe() const override { return true; }
+
     //
     // STATE FUNCTIONS
     //
@@ -118,6 +118,9 @@ class ChApi ChLinkRevoluteTranslational : public ChLink {
     /// constraint violations, etc. and cache in internal structures
     virtual void Update(double time, bool update_assets = true) override;
 
+    /// Return true: updating this item only modifies its own data.
+    virtual bool IsUpdateThreadSafe() const override { return true; }
+
     //
     // STATE FUNCTIONS
     //
@@ -183,6 +183,9 @@ class ChApi ChLinkTSDA : public ChLink {
   private:
     virtual void Update(double mytime, bool update_assets = true) override;
 
+    /// Return true: updating this item only modifies its own data.
+    virtual bool IsUpdateThreadSafe() const override { return true; }
+
     virtual int GetDOF() override { return m_nstates; }
 
     // Interface to solver
@@ -137,6 +137,14 @@ class ChApi ChPhysicsItem : public ChObj {
     /// data. By default, calls Update(mytime) using item's current time.
     virtual void Update(bool update_assets = true) { Update(ChTime, update_assets); }
 
+    /// Return true if this item can be processed concurrently with other items of the same kind by the owning
+    /// assembly (see ChAssembly::EnableParallelUpdate). This requires that Update(), IntStateGather(),
+    /// IntStateScatter() and IntLoadResidual_Mv() only modify data owned by this item and its own slots in the state
+    /// vectors. IntLoadResidual_F() may also load terms in the slots of other items (e.g. forces applied by a link
+    /// to its two bodies), in which case the assembly accumulates these loads per thread.
+    /// By default, returns false (the item is always processed sequentially).
+    virtual bool IsUpdateThreadSafe() const { return false; }
+
     /// Set zero speed (and zero accelerations) in state, without changing the position.
     /// Child classes should implement this function if GetDOF() > 0.
     /// It is used by owner ChSystem for some static analysis.
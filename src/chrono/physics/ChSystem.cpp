@@ -29,6 +29,7 @@
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/core/ChMatrix.h"
 #include "chrono/utils/ChProfiler.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 using namespace chrono::collision;
 
@@ -624,6 +625,9 @@ void ChSystem::DescriptorPrepareInject(ChSystemDescriptor& mdescriptor) {
     InjectKRMmatrices(mdescriptor);
 
     mdescriptor.EndInsertion();
+
+    // Let solvers use the threads allocated for Chrono itself
+    mdescriptor.SetNumThreads(nthreads_chrono);
 }
 
 // -----------------------------------------------------------------------------
@@ -636,6 +640,7 @@ void ChSystem::DescriptorPrepareInject(ChSystemDescriptor& mdescriptor) {
 
 void ChSystem::Setup() {
     CH_PROFILE("Setup");
+    CH_TRACE_SCOPE("Setup", "system");
 
     timer_setup.start();
 
@@ -723,6 +728,7 @@ void ChSystem::Update(double mytime, bool update_assets) {
 
 void ChSystem::Update(bool update_assets) {
     CH_PROFILE("Update");
+    CH_TRACE_SCOPE("Update", "system");
 
     if (!is_initialized)
         SetupInitial();
@@ -1040,6 +1046,7 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
                                     bool force_setup              // if true, call the solver's Setup() function
 ) {
     CH_PROFILE("StateSolveCorrection");
+    CH_TRACE_SCOPE("StateSolveCorrection", "system");
 
     if (force_state_scatter)
         StateScatter(x, v, T, full_update);
@@ -1233,6 +1240,7 @@ int ChSystem::GetNcontacts() {
 
 double ChSystem::ComputeCollisions() {
     CH_PROFILE("ComputeCollisions");
+    CH_TRACE_SCOPE("ComputeCollisions", "system");
 
     double mretC = 0.0;
 
@@ -1251,6 +1259,7 @@ double ChSystem::ComputeCollisions() {
     // for ChBody and ChParticles is used always.
     {
         CH_PROFILE("ReportContacts");
+        CH_TRACE_SCOPE("ReportContacts", "system");
 
         collision_system->ReportContacts(contact_container.get());
 
@@ -1379,6 +1388,7 @@ void ChSystem::DumpSystemMatrices(bool save_M, bool save_K, bool save_R, bool sa
 // -----------------------------------------------------------------------------
 
 int ChSystem::DoStepDynamics(double step_size) {
+    CH_TRACE_SCOPE("DoStepDynamics", "system");
     if (!is_initialized)
         SetupInitial();
 
@@ -1393,6 +1403,7 @@ int ChSystem::DoStepDynamics(double step_size) {
 
 bool ChSystem::Integrate_Y() {
     CH_PROFILE("Integrate_Y");
+    CH_TRACE_SCOPE("Integrate_Y", "system");
 
     ResetTimers();
 
@@ -1440,6 +1451,7 @@ bool ChSystem::Integrate_Y() {
     // PERFORM TIME STEP HERE!
     {
         CH_PROFILE("Advance");
+        CH_TRACE_SCOPE("Advance", "system");
         timer_advance.start();
         timestepper->Advance(step);
         timer_advance.stop();
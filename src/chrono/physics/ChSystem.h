@@ -234,8 +234,9 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
-    ///                           in SCM deformable terrain calculations.
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians),
+    ///                           in SCM deformable terrain calculations, and in the parallel update of bodies
+    ///                           and links (if enabled, see EnableParallelUpdate).
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
     ///   num_threads_eigen     - used in the Eigen sparse direct solvers and a few linear algebra operations.
@@ -254,6 +255,14 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     int GetNumthreadsCollision() const { return nthreads_collision; }
     int GetNumthreadsEigen() const { return nthreads_eigen; }
 
+    /// Enable/disable parallel processing of bodies and links in the state update and residual load functions of the
+    /// underlying assembly (default: false). Uses num_threads_chrono threads. See ChAssembly::EnableParallelUpdate.
+    void EnableParallelUpdate(bool val) { assembly.EnableParallelUpdate(val); }
+
+    /// Enable/disable the contiguous body state block of the underlying assembly (default: false).
+    /// See ChAssembly::EnableBodyStateBlock.
+    void EnableBodyStateBlock(bool val) { assembly.EnableBodyStateBlock(val); }
+
     //
     // DATABASE HANDLING
     //
@@ -14,6 +14,7 @@
 
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #define SPM_DEF_SPARSITY 0.9  ///< default predicted sparsity (in [0,1])
 
@@ -24,6 +25,10 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_use_learner(true),
       m_force_update(true),
       m_null_pivot_detection(false),
+      m_reuse_symbolic(false),
+      m_symbolic_valid(false),
+      m_pattern_hash(0),
+      m_analyze_call(0),
       m_use_rhs_sparsity(false),
       m_use_perm(false),
       m_symmetry(MatrixSymmetryType::GENERAL),
@@ -32,14 +37,33 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_solve_call(0),
       m_setup_call(0) {}
 
+// Structural hash of a compressed sparse matrix (dimensions, outer starts, and inner indices).
+static size_t _PatternHash(const ChSparseMatrix& mat) {
+    size_t hash = 14695981039346656037ULL;
+    auto combine = [&hash](size_t v) { hash ^= v + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2); };
+    combine((size_t)mat.rows());
+    combine((size_t)mat.cols());
+    combine((size_t)mat.nonZeros());
+    const int* outer = mat.outerIndexPtr();
+    for (int i = 0; i <= mat.outerSize(); i++)
+        combine((size_t)outer[i]);
+    const int* inner = mat.innerIndexPtr();
+    for (int i = 0; i < mat.nonZeros(); i++)
+        combine((size_t)inner[i]);
+    return hash;
+}
+
 void ChDirectSolverLS::ResetTimers() {
     m_timer_setup_assembly.reset();
     m_timer_setup_solvercall.reset();
+    m_timer_setup_analyze.reset();
+    m_timer_setup_factorize.reset();
     m_timer_solve_assembly.reset();
     m_timer_solve_solvercall.reset();
 }
 
 bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
+    CH_TRACE_SCOPE("DirectSolverLS::Setup", "solver");
     m_timer_setup_assembly.start();
 
     // Calculate problem size.
@@ -86,8 +110,10 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     m_timer_setup_assembly.stop();
 
     // Let the concrete solver perform the facorization
+    double time_analyze = m_timer_setup_analyze();
+    double time_factorize = m_timer_setup_factorize();
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = Factorize();
     m_timer_setup_solvercall.stop();
 
     if (verbose) {
@@ -95,6 +121,10 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
                  << "\n";
         GetLog() << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSecondsIntermediate() << "s\n"
                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSecondsIntermediate() << "s\n";
+        if (m_reuse_symbolic && SupportsSymbolicReuse()) {
+            GetLog() << "    analyze:         " << m_timer_setup_analyze() - time_analyze << "s\n"
+                     << "    factorize:       " << m_timer_setup_factorize() - time_factorize << "s\n";
+        }
     }
 
     m_setup_call++;
@@ -108,7 +138,33 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     return result;
 }
 
+bool ChDirectSolverLS::Factorize() {
+    if (!m_reuse_symbolic || !SupportsSymbolicReuse()) {
+        m_symbolic_valid = false;
+        return FactorizeMatrix();
+    }
+
+    // Redo the symbolic analysis only if there is no valid one or if the matrix structure changed
+    size_t hash = _PatternHash(m_mat);
+    if (!m_symbolic_valid || hash != m_pattern_hash) {
+        m_timer_setup_analyze.start();
+        m_symbolic_valid = AnalyzeMatrix();
+        m_timer_setup_analyze.stop();
+        m_pattern_hash = hash;
+        m_analyze_call++;
+        if (!m_symbolic_valid)
+            return false;
+    }
+
+    m_timer_setup_factorize.start();
+    bool result = FactorizeMatrixNumeric();
+    m_timer_setup_factorize.stop();
+
+    return result;
+}
+
 double ChDirectSolverLS::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_SCOPE("DirectSolverLS::Solve", "solver");
     // Assemble the problem right-hand side vector
     m_timer_solve_assembly.start();
     sysd.ConvertToMatrixForm(nullptr, &m_rhs);
@@ -152,7 +208,7 @@ bool ChDirectSolverLS::SetupCurrent() {
 
     // Let the concrete solver perform the factorization
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = Factorize();
     m_timer_setup_solvercall.stop();
 
     if (verbose) {
@@ -236,6 +292,16 @@ bool ChSolverSparseLU::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseLU::AnalyzeMatrix() {
+    m_engine.analyzePattern(m_mat);
+    return true;
+}
+
+bool ChSolverSparseLU::FactorizeMatrixNumeric() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseLU::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
@@ -265,6 +331,16 @@ bool ChSolverSparseQR::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseQR::AnalyzeMatrix() {
+    m_engine.analyzePattern(m_mat);
+    return true;
+}
+
+bool ChSolverSparseQR::FactorizeMatrixNumeric() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseQR::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
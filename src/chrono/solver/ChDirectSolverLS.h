@@ -46,6 +46,12 @@ Setup. This feature is intended for problems where the system matrix sparsity pa
 call to call.\n
 See #LockSparsityPattern();
 
+The symbolic factorization \e reuse feature caches the symbolic analysis of the matrix (fill-reducing ordering and
+elimination tree) and, on subsequent calls to Setup, only performs a numeric refactorization as long as the matrix
+structure is unchanged. Structural changes are detected through a hash of the compressed sparsity pattern.
+This feature must be supported by the concrete solver.\n
+See #ReuseSymbolicFactorization();
+
 The sparsity pattern \e learning feature acquires the sparsity pattern in advance, in order to speed up matrix assembly.
 Enabled by default, the sparsity matrix learner identifies the exact matrix sparsity pattern (without actually setting
 any nonzeros).\n
@@ -92,6 +98,13 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
     void ForceSparsityPatternUpdate() { m_force_update = true; }
 
+    /// Enable/disable reuse of the symbolic factorization (default: false).\n
+    /// If enabled, and if supported by the concrete solver, the symbolic analysis of the matrix is performed only when
+    /// the matrix sparsity pattern changes (detected through a structural hash of the assembled matrix). Otherwise,
+    /// only a numeric factorization is performed. This is most effective when the sparsity pattern learner is enabled
+    /// or the sparsity pattern is locked, so that the matrix structure does not depend on the values of its entries.
+    void ReuseSymbolicFactorization(bool val) { m_reuse_symbolic = val; }
+
     /// Set estimate for matrix sparsity, a value in [0,1], with 0 indicating a fully dense matrix (default: 0.9).\n
     /// Only used if the sparsity pattern learner is disabled.
     void SetSparsityEstimate(double sparsity) { m_sparsity = sparsity; }
@@ -122,11 +135,17 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     double GetTimeSetup_Assembly() const { return m_timer_setup_assembly(); }
     /// Get cumulative time for Pardiso calls in Setup phase.
     double GetTimeSetup_SolverCall() const { return m_timer_setup_solvercall(); }
+    /// Get cumulative time for symbolic analysis in Setup phase (only if symbolic factorization reuse is enabled).
+    double GetTimeSetup_Analyze() const { return m_timer_setup_analyze(); }
+    /// Get cumulative time for numeric factorization in Setup phase (only if symbolic factorization reuse is enabled).
+    double GetTimeSetup_Factorize() const { return m_timer_setup_factorize(); }
 
     /// Return the number of calls to the solver's Setup function.
     int GetNumSetupCalls() const { return m_setup_call; }
     /// Return the number of calls to the solver's Setup function.
     int GetNumSolveCalls() const { return m_solve_call; }
+    /// Return the number of symbolic analyses performed (only if symbolic factorization reuse is enabled).
+    int GetNumAnalyzeCalls() const { return m_analyze_call; }
 
     /// Get a handle to the underlying matrix.
     ChSparseMatrix& GetMatrix() { return m_mat; }
@@ -180,6 +199,18 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() = 0;
 
+    /// Indicate whether or not the concrete solver can perform the symbolic and numeric factorization separately
+    /// (see AnalyzeMatrix and FactorizeMatrixNumeric).
+    virtual bool SupportsSymbolicReuse() const { return false; }
+
+    /// Perform the symbolic analysis of the current sparse matrix and return true if successful.
+    /// Only called if SupportsSymbolicReuse returns true.
+    virtual bool AnalyzeMatrix() { return true; }
+
+    /// Perform the numeric factorization of the current sparse matrix, reusing the last symbolic analysis, and return
+    /// true if successful. Only called if SupportsSymbolicReuse returns true.
+    virtual bool FactorizeMatrixNumeric() { return FactorizeMatrix(); }
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() = 0;
@@ -192,6 +223,9 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Typically, direct solvers only require the matrix for their #Setup() phase.
     virtual bool SolveRequiresMatrix() const override { return false; }
 
+    /// Factorize the current matrix, reusing the symbolic factorization if enabled and possible.
+    bool Factorize();
+
     ChSparseMatrix m_mat;           ///< problem matrix
     int m_dim;                      ///< problem size
     MatrixSymmetryType m_symmetry;  ///< symmetry of problem matrix
@@ -210,8 +244,15 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
 
+    bool m_reuse_symbolic;   ///< reuse the symbolic factorization if the matrix structure is unchanged?
+    bool m_symbolic_valid;   ///< is there a valid symbolic factorization?
+    size_t m_pattern_hash;   ///< structural hash of the matrix used in the last symbolic factorization
+    int m_analyze_call;      ///< counter for symbolic analyses
+
     ChTimer<> m_timer_setup_assembly;    ///< timer for matrix assembly
     ChTimer<> m_timer_setup_solvercall;  ///< timer for factorization
+    ChTimer<> m_timer_setup_analyze;     ///< timer for symbolic analysis (if reusing symbolic factorization)
+    ChTimer<> m_timer_setup_factorize;   ///< timer for numeric factorization (if reusing symbolic factorization)
     ChTimer<> m_timer_solve_assembly;    ///< timer for RHS assembly
     ChTimer<> m_timer_solve_solvercall;  ///< timer for solution
 };
@@ -232,6 +273,11 @@ class ChApi ChSolverSparseLU : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// The Eigen SparseLU solver supports separate symbolic and numeric factorization.
+    virtual bool SupportsSymbolicReuse() const override { return true; }
+    virtual bool AnalyzeMatrix() override;
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
@@ -257,6 +303,11 @@ class ChApi ChSolverSparseQR : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// The Eigen SparseQR solver supports separate symbolic and numeric factorization.
+    virtual bool SupportsSymbolicReuse() const override { return true; }
+    virtual bool AnalyzeMatrix() override;
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
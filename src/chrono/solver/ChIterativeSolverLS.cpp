@@ -15,7 +15,7 @@
 // Chrono solvers based on Eigen iterative linear solvers.
 // All iterative linear solvers are implemented in a matrix-free context and
 // rely on the system descriptor for the required SPMV operations.
-// They can optionally use a diagonal preconditioner.
+// They can optionally use a preconditioner (see ChPreconditioner).
 //
 // Available solvers:
 //   GMRES
@@ -24,7 +24,9 @@
 //
 // =============================================================================
 
+#include "chrono/core/ChSparsityPatternLearner.h"
 #include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 // =============================================================================
 
@@ -77,58 +79,66 @@ class ChMatrixSPMV : public Eigen::EigenBase<ChMatrixSPMV> {
     chrono::ChVectorDynamic<> m_vect;    // workspace for the result of the SPMV operation
 };
 
-/// Simple diagonal preconditioner
-class ChDiagonalPreconditioner {
+/// Wrapper for using a Chrono preconditioner with the Eigen iterative solvers.
+/// If no preconditioner is specified, the identity is used.
+class ChEigenPreconditioner {
     typedef double Scalar;
 
   public:
     typedef int StorageIndex;
     enum { ColsAtCompileTime = Eigen::Dynamic, MaxColsAtCompileTime = Eigen::Dynamic };
 
-    ChDiagonalPreconditioner() : m_N(0), m_diag_precond(false), m_invdiag(nullptr) {}
+    ChEigenPreconditioner() : m_N(0), m_precond(nullptr), m_timer(nullptr) {}
 
-    void Setup(Eigen::Index N, const ChVectorDynamic<>& invdiag) {
+    void Setup(Eigen::Index N, ChPreconditioner* precond, ChTimer<>* timer) {
         m_N = N;
-        m_invdiag = &invdiag;
-        m_diag_precond = (invdiag.size() > 0);
+        m_precond = precond;
+        m_timer = timer;
     }
 
     Eigen::Index rows() const { return m_N; }
     Eigen::Index cols() const { return m_N; }
 
     template <typename MatType>
-    ChDiagonalPreconditioner& analyzePattern(const MatType&) {
+    ChEigenPreconditioner& analyzePattern(const MatType&) {
         return *this;
     }
     template <typename MatType>
-    ChDiagonalPreconditioner& factorize(const MatType& mat) {
+    ChEigenPreconditioner& factorize(const MatType& mat) {
         return *this;
     }
     template <typename MatType>
-    ChDiagonalPreconditioner& compute(const MatType& mat) {
+    ChEigenPreconditioner& compute(const MatType& mat) {
         return *this;
     }
 
     template <typename Rhs, typename Dest>
     void _solve_impl(const Rhs& b, Dest& x) const {
-        if (m_diag_precond) {
-            x = m_invdiag->array() * b.array();
+        if (m_precond) {
+            m_timer->start();
+            m_b = b;
+            m_x.resize(m_b.size());
+            m_precond->Apply(m_b, m_x);
+            x = m_x;
+            m_timer->stop();
         } else {
             x = b;
         }
     }
 
     template <typename Rhs>
-    inline const Eigen::Solve<ChDiagonalPreconditioner, Rhs> solve(const Eigen::MatrixBase<Rhs>& b) const {
-        return Eigen::Solve<ChDiagonalPreconditioner, Rhs>(*this, b.derived());
+    inline const Eigen::Solve<ChEigenPreconditioner, Rhs> solve(const Eigen::MatrixBase<Rhs>& b) const {
+        return Eigen::Solve<ChEigenPreconditioner, Rhs>(*this, b.derived());
     }
 
     Eigen::ComputationInfo info() { return Eigen::Success; }
 
   protected:
-    Eigen::Index m_N;                    // problem dimension
-    const ChVectorDynamic<>* m_invdiag;  // pointer to (invcerse) diagonal entries
-    bool m_diag_precond;                 // if false, no preconditioning
+    Eigen::Index m_N;                 // problem dimension
+    ChPreconditioner* m_precond;      // pointer to preconditioner (if null, no preconditioning)
+    ChTimer<>* m_timer;               // timer for preconditioner applications
+    mutable ChVectorDynamic<> m_b;    // workspace for the preconditioner input
+    mutable ChVectorDynamic<> m_x;    // workspace for the preconditioner output
 };
 
 }  // namespace chrono
@@ -169,8 +179,10 @@ CH_FACTORY_REGISTER(ChSolverGMRES)
 CH_FACTORY_REGISTER(ChSolverBiCGSTAB)
 CH_FACTORY_REGISTER(ChSolverMINRES)
 
-ChIterativeSolverLS::ChIterativeSolverLS() : ChIterativeSolver(-1, -1.0, true, false) {
+ChIterativeSolverLS::ChIterativeSolverLS()
+    : ChIterativeSolver(-1, -1.0, true, false), m_precond_active(nullptr), m_force_update(true) {
     m_spmv = new ChMatrixSPMV();
+    m_diag = chrono_types::make_shared<ChPreconditionerDiagonal>();
 }
 
 ChIterativeSolverLS::~ChIterativeSolverLS() {
@@ -178,21 +190,55 @@ ChIterativeSolverLS::~ChIterativeSolverLS() {
 }
 
 bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
+    CH_TRACE_SCOPE("IterativeSolverLS::Setup", "solver");
     // Calculate problem size
     int dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
 
     // Set up the SPMV wrapper
     m_spmv->Setup(dim, sysd);
 
-    // If needed, evaluate the inverse diagonal entries
-    if (m_use_precond) {
-        m_invdiag.resize(dim);
-        sysd.BuildDiagonalVector(m_invdiag);
-        for (int i = 0; i < dim; i++) {
-            if (std::abs(m_invdiag(i)) > 1e-9)
-                m_invdiag(i) = 1.0 / m_invdiag(i);
-            else
-                m_invdiag(i) = 1.0;
+    // Select the preconditioner: a user-specified one or else the default diagonal preconditioner (if enabled)
+    m_precond_active = m_precond ? m_precond.get() : (m_use_precond ? m_diag.get() : nullptr);
+
+    // If needed, assemble the system matrix and evaluate the preconditioner
+    if (m_precond_active) {
+        double time_assembly = m_timer_setup_assembly();
+        double time_precond = m_timer_setup_precond();
+
+        if (m_precond_active->SetupRequiresMatrix()) {
+            m_timer_setup_assembly.start();
+            // Learn the sparsity pattern only if forced or if the problem size changed; otherwise reuse the pattern
+            // of the current matrix (ConvertToMatrixForm keeps the pattern and only resets the values).
+            if (m_force_update || m_mat.rows() != dim) {
+                ChSparsityPatternLearner sparsity_pattern(dim, dim);
+                sysd.ConvertToMatrixForm(&sparsity_pattern, nullptr);
+                sparsity_pattern.Apply(m_mat);
+                m_force_update = false;
+            }
+            auto nnz = m_mat.nonZeros();
+            sysd.ConvertToMatrixForm(&m_mat, nullptr);
+            m_mat.makeCompressed();
+            // If entries outside the current pattern were inserted, learn the pattern again at the next call
+            if (m_mat.nonZeros() != nnz)
+                m_force_update = true;
+            m_timer_setup_assembly.stop();
+        } else {
+            m_mat.resize(0, 0);
+        }
+
+        m_timer_setup_precond.start();
+        bool precond_ok = m_precond_active->Setup(sysd, m_mat);
+        m_timer_setup_precond.stop();
+
+        if (!precond_ok) {
+            if (verbose)
+                std::cout << "  Preconditioner setup failed" << std::endl;
+            return false;
+        }
+
+        if (verbose) {
+            std::cout << "  Preconditioner setup: assembly " << m_timer_setup_assembly() - time_assembly
+                      << "s  evaluation " << m_timer_setup_precond() - time_precond << "s" << std::endl;
         }
     }
 
@@ -213,11 +259,21 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
 }
 
 double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_SCOPE("IterativeSolverLS::Solve", "solver");
     // Assemble the problem right-hand side vector
     sysd.ConvertToMatrixForm(nullptr, &m_rhs);
 
     // Let the concrete solver compute the solution (in m_sol)
+    double time_solvercall = m_timer_solve_solvercall();
+    double time_precond = m_timer_solve_precond();
+    m_timer_solve_solvercall.start();
     bool result = SolveProblem();
+    m_timer_solve_solvercall.stop();
+
+    if (verbose) {
+        std::cout << "  Solve: solver call " << m_timer_solve_solvercall() - time_solvercall << "s  preconditioner "
+                  << m_timer_solve_precond() - time_precond << "s" << std::endl;
+    }
 
     if (verbose) {
         // Calculate exact residual and report its norm
@@ -237,10 +293,21 @@ double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
     return result;
 }
 
+void ChIterativeSolverLS::SetupPreconditioner(ChEigenPreconditioner& precond) {
+    precond.Setup(m_spmv->rows(), m_precond_active, &m_timer_solve_precond);
+}
+
+void ChIterativeSolverLS::ResetTimers() {
+    m_timer_setup_assembly.reset();
+    m_timer_setup_precond.reset();
+    m_timer_solve_solvercall.reset();
+    m_timer_solve_precond.reset();
+}
+
 // ---------------------------------------------------------------------------
 
 ChSolverGMRES::ChSolverGMRES() {
-    m_engine = new Eigen::GMRES<ChMatrixSPMV, ChDiagonalPreconditioner>();
+    m_engine = new Eigen::GMRES<ChMatrixSPMV, ChEigenPreconditioner>();
 }
 
 ChSolverGMRES::~ChSolverGMRES() {
@@ -248,7 +315,7 @@ ChSolverGMRES::~ChSolverGMRES() {
 }
 
 bool ChSolverGMRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    SetupPreconditioner(m_engine->preconditioner());
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -285,7 +352,7 @@ double ChSolverGMRES::GetError() const {
 // ---------------------------------------------------------------------------
 
 ChSolverBiCGSTAB::ChSolverBiCGSTAB() {
-    m_engine = new Eigen::BiCGSTAB<ChMatrixSPMV, ChDiagonalPreconditioner>();
+    m_engine = new Eigen::BiCGSTAB<ChMatrixSPMV, ChEigenPreconditioner>();
 }
 
 ChSolverBiCGSTAB::~ChSolverBiCGSTAB() {
@@ -293,7 +360,7 @@ ChSolverBiCGSTAB::~ChSolverBiCGSTAB() {
 }
 
 bool ChSolverBiCGSTAB::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    SetupPreconditioner(m_engine->preconditioner());
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -330,8 +397,8 @@ double ChSolverBiCGSTAB::GetError() const {
 
 // ---------------------------------------------------------------------------
 
-ChSolverMINRES::ChSolverMINRES() {
-    m_engine = new Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChDiagonalPreconditioner>();
+ChSolverMINRES::ChSolverMINRES() : m_warned(false) {
+    m_engine = new Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChEigenPreconditioner>();
 }
 
 ChSolverMINRES::~ChSolverMINRES() {
@@ -339,7 +406,19 @@ ChSolverMINRES::~ChSolverMINRES() {
 }
 
 bool ChSolverMINRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    // MINRES requires a symmetric positive definite preconditioner; fall back to the diagonal preconditioner otherwise
+    if (m_precond_active && !m_precond_active->IsSymmetricPositiveDefinite()) {
+        if (!m_warned) {
+            std::cerr << "WARNING: MINRES requires a symmetric positive definite preconditioner; "
+                         "using the diagonal preconditioner instead"
+                      << std::endl;
+            m_warned = true;
+        }
+        m_diag->Setup(*m_spmv->sysd(), m_mat);
+        m_precond_active = m_diag.get();
+    }
+
+    SetupPreconditioner(m_engine->preconditioner());
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
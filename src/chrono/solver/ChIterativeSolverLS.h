@@ -15,7 +15,7 @@
 // Chrono solvers based on Eigen iterative linear solvers.
 // All iterative linear solvers are implemented in a matrix-free context and
 // rely on the system descriptor for the required SPMV operations.
-// They can optionally use a diagonal preconditioner.
+// They can optionally use a preconditioner (see ChPreconditioner).
 //
 // Available solvers:
 //   GMRES
@@ -27,8 +27,10 @@
 #ifndef CH_ITERATIVESOLVER_LS_H
 #define CH_ITERATIVESOLVER_LS_H
 
+#include "chrono/core/ChTimer.h"
 #include "chrono/solver/ChSolverLS.h"
 #include "chrono/solver/ChIterativeSolver.h"
+#include "chrono/solver/ChPreconditioner.h"
 
 #include <Eigen/IterativeLinearSolvers>
 #include <unsupported/Eigen/IterativeSolvers>
@@ -42,7 +44,7 @@ namespace chrono {
 
 // Forward declarations of wrapper class for SPMV operations and custom preconditioner
 class ChMatrixSPMV;
-class ChDiagonalPreconditioner;
+class ChEigenPreconditioner;
 
 // ---------------------------------------------------------------------------
 
@@ -63,6 +65,11 @@ residual error: |Ax - b|/|b|. Default: machine precision.
 
 By default, these solvers use a diagonal preconditioner and no warm start. Recall that the warm start option should
 be used **only** in conjunction with the Euler implicit linearized integrator.
+
+A different preconditioner can be specified through #SetPreconditioner (see ChPreconditioner). Preconditioners other
+than the diagonal one require the assembled system matrix which is then evaluated in the setup phase. The time spent
+in the evaluation and application of the preconditioner is reported through #GetTimeSetup_Preconditioner and
+#GetTimeSolve_Preconditioner.
 */
 class ChApi ChIterativeSolverLS : public ChIterativeSolver, public ChSolverLS {
   public:
@@ -77,9 +84,40 @@ class ChApi ChIterativeSolverLS : public ChIterativeSolver, public ChSolverLS {
     /// Return the maximum constraint violation after termination.
     virtual double Solve(ChSystemDescriptor& sysd) override;
 
+    /// Set the preconditioner (default: none).
+    /// If specified, this preconditioner is used regardless of the setting for the diagonal preconditioner (see
+    /// EnableDiagonalPreconditioner). Note that MINRES requires a symmetric positive definite preconditioner (see
+    /// ChSolverMINRES).
+    void SetPreconditioner(std::shared_ptr<ChPreconditioner> precond) { m_precond = precond; }
+
+    /// Force a call to the sparsity pattern learner at the next assembly of the system matrix.\n
+    /// The sparsity pattern of the system matrix (only assembled if required by the preconditioner) is learned at the
+    /// first call to Setup and reused as long as the problem size does not change. New nonzeros are still inserted
+    /// during assembly (and trigger a new learning at the next call), but entries which are no longer present remain
+    /// in the pattern as explicit zeros. Call this function after significant changes of the problem structure.
+    void ForceSparsityPatternUpdate() { m_force_update = true; }
+
+    /// Get the user-specified preconditioner (if any).
+    std::shared_ptr<ChPreconditioner> GetPreconditioner() const { return m_precond; }
+
+    /// Reset timers for internal phases in Solve and Setup.
+    void ResetTimers();
+
+    /// Get cumulative time for assembly of the system matrix in Setup phase (only if required by the preconditioner).
+    double GetTimeSetup_Assembly() const { return m_timer_setup_assembly(); }
+    /// Get cumulative time for evaluation of the preconditioner in Setup phase.
+    double GetTimeSetup_Preconditioner() const { return m_timer_setup_precond(); }
+    /// Get cumulative time for the iterative solver calls in Solve phase (including preconditioner applications).
+    double GetTimeSolve_SolverCall() const { return m_timer_solve_solvercall(); }
+    /// Get cumulative time for application of the preconditioner in Solve phase.
+    double GetTimeSolve_Preconditioner() const { return m_timer_solve_precond(); }
+
   protected:
     ChIterativeSolverLS();
 
+    /// Initialize the Eigen wrapper for the preconditioner currently in use.
+    void SetupPreconditioner(ChEigenPreconditioner& precond);
+
     /// Indicate whether or not the #Solve() phase requires an up-to-date problem matrix.
     virtual bool SolveRequiresMatrix() const override final { return true; }
 
@@ -93,8 +131,19 @@ class ChApi ChIterativeSolverLS : public ChIterativeSolver, public ChSolverLS {
     ChMatrixSPMV* m_spmv;                 ///< matrix-like wrapper for SPMV operations
     ChVectorDynamic<double> m_sol;        ///< solution vector
     ChVectorDynamic<double> m_rhs;        ///< right-hand side vector
-    ChVectorDynamic<double> m_invdiag;    ///< inverse diagonal entries (for preconditioning)
     ChVectorDynamic<double> m_initguess;  ///< initial guess (for warm start)
+    ChSparseMatrix m_mat;                 ///< assembled system matrix (only if required by the preconditioner)
+
+    std::shared_ptr<ChPreconditioner> m_precond;  ///< user-specified preconditioner
+    std::shared_ptr<ChPreconditioner> m_diag;     ///< default diagonal preconditioner
+    ChPreconditioner* m_precond_active;           ///< preconditioner used in the current solve (may be null)
+
+    bool m_force_update;  ///< force a call to the sparsity pattern learner?
+
+    ChTimer<> m_timer_setup_assembly;    ///< timer for matrix assembly
+    ChTimer<> m_timer_setup_precond;     ///< timer for preconditioner evaluation
+    ChTimer<> m_timer_solve_solvercall;  ///< timer for iterative solver call
+    ChTimer<> m_timer_solve_precond;     ///< timer for preconditioner applications
 };
 
 // ---------------------------------------------------------------------------
@@ -115,7 +164,7 @@ class ChApi ChSolverGMRES : public ChIterativeSolverLS {
     virtual bool SetupProblem() override;
     virtual bool SolveProblem() override;
 
-    Eigen::GMRES<ChMatrixSPMV, ChDiagonalPreconditioner>* m_engine;
+    Eigen::GMRES<ChMatrixSPMV, ChEigenPreconditioner>* m_engine;
 };
 
 // ---------------------------------------------------------------------------
@@ -135,7 +184,7 @@ class ChApi ChSolverBiCGSTAB : public ChIterativeSolverLS {
     virtual bool SetupProblem() override;
     virtual bool SolveProblem() override;
 
-    Eigen::BiCGSTAB<ChMatrixSPMV, ChDiagonalPreconditioner>* m_engine;
+    Eigen::BiCGSTAB<ChMatrixSPMV, ChEigenPreconditioner>* m_engine;
 };
 
 // ---------------------------------------------------------------------------
@@ -143,6 +192,9 @@ class ChApi ChSolverBiCGSTAB : public ChIterativeSolverLS {
 /// MINRES iterative solver.
 /// Solves Ax=b for symmetric sparse matrix A, using a conjugate-gradient type method based on Lanczos
 /// tridiagonalization.\n
+/// MINRES requires a symmetric positive definite preconditioner. If the preconditioner in use is not (see
+/// ChPreconditioner::IsSymmetricPositiveDefinite), e.g. ILU(0), or IC(0) with replaced pivots, a warning is issued and
+/// the diagonal preconditioner is used instead.\n
 /// See ChIterativeSolverLS for supported solver settings and paramters.
 class ChApi ChSolverMINRES : public ChIterativeSolverLS {
   public:
@@ -156,7 +208,8 @@ class ChApi ChSolverMINRES : public ChIterativeSolverLS {
     virtual bool SetupProblem() override;
     virtual bool SolveProblem() override;
 
-    Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChDiagonalPreconditioner>* m_engine;
+    Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChEigenPreconditioner>* m_engine;
+    bool m_warned;  ///< was a warning about an unsupported preconditioner issued?
 };
 
 /// @} chrono_solver
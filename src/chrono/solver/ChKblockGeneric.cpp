@@ -126,5 +126,37 @@ void ChKblockGeneric::Build_K(ChSparseMatrix& storage, bool add) {
     }
 }
 
+void ChKblockGeneric::Build_K_InPlace(ChSparseMatrix& storage, std::vector<Eigen::Triplet<double>>& overflow) {
+    if (K.rows() == 0)
+        return;
+
+    int kio = 0;
+    for (unsigned int iv = 0; iv < this->GetNvars(); iv++) {
+        int io = this->GetVariableN(iv)->GetOffset();
+        int in = this->GetVariableN(iv)->Get_ndof();
+
+        if (this->GetVariableN(iv)->IsActive()) {
+            int kjo = 0;
+            for (unsigned int jv = 0; jv < this->GetNvars(); jv++) {
+                int jo = this->GetVariableN(jv)->GetOffset();
+                int jn = this->GetVariableN(jv)->Get_ndof();
+
+                if (this->GetVariableN(jv)->IsActive()) {
+                    for (int r = 0; r < in; r++) {
+                        for (int c = 0; c < jn; c++) {
+                            double val = K(kio + r, kjo + c);
+                            if (!storage.AddElementInPlace(io + r, jo + c, val))
+                                overflow.push_back(Eigen::Triplet<double>(io + r, jo + c, val));
+                        }
+                    }
+                }
+
+                kjo += jn;
+            }
+        }
+
+        kio += in;
+    }
+}
 
 }  // end namespace chrono
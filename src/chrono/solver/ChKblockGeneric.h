@@ -75,6 +75,12 @@ class ChApi ChKblockGeneric : public ChKblock {
     /// Most solvers do not need this: the sparse 'storage' matrix is used for testing, for
     /// direct solvers, for dumping full matrix to Matlab for checks, etc.
     virtual void Build_K(ChSparseMatrix& storage, bool add) override;
+
+    /// Add the K matrix associated to these variables into a global 'storage' matrix, at the offsets of variables,
+    /// without reallocating the storage (see ChSparseMatrix::AddElementInPlace). Only the rows of the referenced
+    /// variables are modified, so that blocks with no variables in common can be loaded concurrently. Elements that
+    /// cannot be stored in place are appended to 'overflow' (to be added later, with SetElement).
+    void Build_K_InPlace(ChSparseMatrix& storage, std::vector<Eigen::Triplet<double>>& overflow);
 };
 
 }  // end namespace chrono
@@ -0,0 +1,321 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Preconditioners for the Chrono iterative linear solvers (ChIterativeSolverLS).
+//
+// =============================================================================
+
+#include <cmath>
+
+#include <Eigen/Cholesky>
+
+#include "chrono/solver/ChPreconditioner.h"
+
+namespace chrono {
+
+// Inverse of the absolute value of a diagonal entry (1 if zero).
+static inline double _InvAbs(double d) {
+    return (std::abs(d) > 1e-9) ? 1.0 / std::abs(d) : 1.0;
+}
+
+// Return a copy of the given matrix, in compressed form, with all diagonal entries included in the sparsity pattern.
+static ChSparseMatrix _WithDiagonal(const ChSparseMatrix& Z) {
+    ChSparseMatrix I(Z.rows(), Z.cols());
+    I.setIdentity();
+    ChSparseMatrix A = Z + 0.0 * I;
+    A.makeCompressed();
+    return A;
+}
+
+// ---------------------------------------------------------------------------
+
+bool ChPreconditionerDiagonal::Setup(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) {
+    int dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
+    m_invdiag.resize(dim);
+    sysd.BuildDiagonalVector(m_invdiag);
+    for (int i = 0; i < dim; i++) {
+        if (std::abs(m_invdiag(i)) > 1e-9)
+            m_invdiag(i) = 1.0 / m_invdiag(i);
+        else
+            m_invdiag(i) = 1.0;
+    }
+    return true;
+}
+
+void ChPreconditionerDiagonal::Apply(ChVectorConstRef b, ChVectorRef x) const {
+    x = m_invdiag.cwiseProduct(b);
+}
+
+// ---------------------------------------------------------------------------
+
+bool ChPreconditionerBlockJacobi::Setup(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) {
+    m_nq = sysd.CountActiveVariables();
+    int nc = (int)Z.rows() - m_nq;
+
+    m_offsets.clear();
+    m_invblks.clear();
+
+    // Extract and invert the diagonal block of each active variable object
+    for (auto var : sysd.GetVariablesList()) {
+        if (!var->IsActive() || var->Get_ndof() == 0)
+            continue;
+        int offset = var->GetOffset();
+        int ndof = var->Get_ndof();
+
+        ChMatrixDynamic<> blk = ChMatrixDynamic<>::Zero(ndof, ndof);
+        for (int r = 0; r < ndof; r++) {
+            for (ChSparseMatrix::InnerIterator it(Z, offset + r); it; ++it) {
+                if (it.col() >= offset && it.col() < offset + ndof)
+                    blk(r, it.col() - offset) = it.value();
+            }
+        }
+
+        ChMatrixDynamic<> inv;
+        Eigen::LLT<ChMatrixDynamic<>> llt(blk);
+        if (llt.info() == Eigen::Success) {
+            inv = llt.solve(ChMatrixDynamic<>::Identity(ndof, ndof));
+        } else {
+            inv = ChMatrixDynamic<>::Zero(ndof, ndof);
+            for (int i = 0; i < ndof; i++)
+                inv(i, i) = _InvAbs(blk(i, i));
+        }
+
+        m_offsets.push_back(offset);
+        m_invblks.push_back(inv);
+    }
+
+    // Constraint rows
+    m_invdiag.resize(nc);
+    for (int i = 0; i < nc; i++)
+        m_invdiag(i) = _InvAbs(Z.coeff(m_nq + i, m_nq + i));
+
+    return true;
+}
+
+void ChPreconditionerBlockJacobi::ApplyBlocks(ChVectorConstRef b, ChVectorRef x) const {
+    for (size_t i = 0; i < m_offsets.size(); i++) {
+        auto ndof = m_invblks[i].rows();
+        x.segment(m_offsets[i], ndof) = m_invblks[i] * b.segment(m_offsets[i], ndof);
+    }
+}
+
+void ChPreconditionerBlockJacobi::Apply(ChVectorConstRef b, ChVectorRef x) const {
+    ApplyBlocks(b, x);
+    x.tail(m_invdiag.size()) = m_invdiag.cwiseProduct(b.tail(m_invdiag.size()));
+}
+
+// ---------------------------------------------------------------------------
+
+bool ChPreconditionerILU0::Setup(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) {
+    m_LU = _WithDiagonal(Z);
+
+    int n = (int)m_LU.rows();
+    const int* outer = m_LU.outerIndexPtr();
+    const int* inner = m_LU.innerIndexPtr();
+    double* val = m_LU.valuePtr();
+
+    m_diag.resize(n);
+    for (int i = 0; i < n; i++) {
+        int p = outer[i];
+        while (inner[p] != i)
+            p++;
+        m_diag[i] = p;
+    }
+
+    // Row-wise (IKJ) incomplete factorization, restricted to the sparsity pattern of Z.
+    // 'pos' maps column indices to positions in the current row.
+    std::vector<int> pos(n, -1);
+    for (int i = 0; i < n; i++) {
+        for (int p = outer[i]; p < outer[i + 1]; p++)
+            pos[inner[p]] = p;
+
+        for (int p = outer[i]; p < m_diag[i]; p++) {
+            int k = inner[p];
+            val[p] /= val[m_diag[k]];
+            double lik = val[p];
+            for (int q = m_diag[k] + 1; q < outer[k + 1]; q++) {
+                int j = pos[inner[q]];
+                if (j >= 0)
+                    val[j] -= lik * val[q];
+            }
+        }
+
+        if (val[m_diag[i]] == 0)
+            val[m_diag[i]] = 1;
+
+        for (int p = outer[i]; p < outer[i + 1]; p++)
+            pos[inner[p]] = -1;
+    }
+
+    return true;
+}
+
+void ChPreconditionerILU0::Apply(ChVectorConstRef b, ChVectorRef x) const {
+    int n = (int)m_LU.rows();
+    const int* outer = m_LU.outerIndexPtr();
+    const int* inner = m_LU.innerIndexPtr();
+    const double* val = m_LU.valuePtr();
+
+    // Forward substitution with L (unit diagonal)
+    for (int i = 0; i < n; i++) {
+        double s = b(i);
+        for (int p = outer[i]; p < m_diag[i]; p++)
+            s -= val[p] * x(inner[p]);
+        x(i) = s;
+    }
+
+    // Backward substitution with U
+    for (int i = n - 1; i >= 0; i--) {
+        double s = x(i);
+        for (int p = m_diag[i] + 1; p < outer[i + 1]; p++)
+            s -= val[p] * x(inner[p]);
+        x(i) = s / val[m_diag[i]];
+    }
+}
+
+// ---------------------------------------------------------------------------
+
+bool ChPreconditionerIC0::Setup(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) {
+    m_L = _WithDiagonal(Z).triangularView<Eigen::Lower>();
+    m_L.makeCompressed();
+    m_num_shifted = 0;
+
+    int n = (int)m_L.rows();
+    const int* outer = m_L.outerIndexPtr();
+    const int* inner = m_L.innerIndexPtr();
+    double* val = m_L.valuePtr();
+
+    // Row-wise incomplete factorization, restricted to the sparsity pattern of the lower triangle of Z.
+    // Column indices are sorted, so that the diagonal entry is the last one in each row.
+    for (int i = 0; i < n; i++) {
+        int di = outer[i + 1] - 1;
+        for (int p = outer[i]; p < di; p++) {
+            int j = inner[p];
+            int dj = outer[j + 1] - 1;
+            // Sparse dot product of rows i and j, over columns less than j
+            double s = val[p];
+            int pi = outer[i];
+            int pj = outer[j];
+            while (pi < p && pj < dj) {
+                if (inner[pi] == inner[pj])
+                    s -= val[pi++] * val[pj++];
+                else if (inner[pi] < inner[pj])
+                    pi++;
+                else
+                    pj++;
+            }
+            val[p] = s / val[dj];
+        }
+
+        double d = val[di];
+        for (int p = outer[i]; p < di; p++)
+            d -= val[p] * val[p];
+        if (d <= 0) {
+            d = (val[di] != 0) ? std::abs(val[di]) : 1.0;
+            m_num_shifted++;
+        }
+        val[di] = std::sqrt(d);
+    }
+
+    return true;
+}
+
+void ChPreconditionerIC0::Apply(ChVectorConstRef b, ChVectorRef x) const {
+    int n = (int)m_L.rows();
+    const int* outer = m_L.outerIndexPtr();
+    const int* inner = m_L.innerIndexPtr();
+    const double* val = m_L.valuePtr();
+
+    // Forward substitution with L
+    for (int i = 0; i < n; i++) {
+        int di = outer[i + 1] - 1;
+        double s = b(i);
+        for (int p = outer[i]; p < di; p++)
+            s -= val[p] * x(inner[p]);
+        x(i) = s / val[di];
+    }
+
+    // Backward substitution with L' (column-oriented traversal of the rows of L)
+    for (int i = n - 1; i >= 0; i--) {
+        int di = outer[i + 1] - 1;
+        x(i) /= val[di];
+        for (int p = outer[i]; p < di; p++)
+            x(inner[p]) -= val[p] * x(i);
+    }
+}
+
+// ---------------------------------------------------------------------------
+
+bool ChPreconditionerSchur::Setup(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) {
+    ChPreconditionerBlockJacobi::Setup(sysd, Z);
+
+    m_use_llt = false;
+    int nc = (int)m_invdiag.size();
+    if (nc == 0)
+        return true;
+
+    // Extract the constraint Jacobian Cq and the compliance matrix E from the constraint rows of Z
+    std::vector<Eigen::Triplet<double>> Cq_triplets;
+    std::vector<Eigen::Triplet<double>> E_triplets;
+    for (int i = 0; i < nc; i++) {
+        for (ChSparseMatrix::InnerIterator it(Z, m_nq + i); it; ++it) {
+            if (it.col() < m_nq)
+                Cq_triplets.push_back(Eigen::Triplet<double>(i, (int)it.col(), it.value()));
+            else
+                E_triplets.push_back(Eigen::Triplet<double>(i, (int)it.col() - m_nq, it.value()));
+        }
+    }
+    Eigen::SparseMatrix<double> Cq(nc, m_nq);
+    Eigen::SparseMatrix<double> E(nc, nc);
+    Cq.setFromTriplets(Cq_triplets.begin(), Cq_triplets.end());
+    E.setFromTriplets(E_triplets.begin(), E_triplets.end());
+
+    // Block-diagonal approximation of H^(-1)
+    std::vector<Eigen::Triplet<double>> Hinv_triplets;
+    for (size_t b = 0; b < m_offsets.size(); b++) {
+        for (int r = 0; r < m_invblks[b].rows(); r++)
+            for (int c = 0; c < m_invblks[b].cols(); c++)
+                Hinv_triplets.push_back(
+                    Eigen::Triplet<double>(m_offsets[b] + r, m_offsets[b] + c, m_invblks[b](r, c)));
+    }
+    Eigen::SparseMatrix<double> Hinv(m_nq, m_nq);
+    Hinv.setFromTriplets(Hinv_triplets.begin(), Hinv_triplets.end());
+
+    // Approximate (negated) Schur complement
+    Eigen::SparseMatrix<double> CqHinv = Cq * Hinv;
+    Eigen::SparseMatrix<double> S = CqHinv * Cq.transpose();
+    S -= E;
+
+    m_llt.compute(S);
+    m_use_llt = (m_llt.info() == Eigen::Success);
+
+    // Fall back on the diagonal of the Schur complement
+    if (!m_use_llt) {
+        for (int i = 0; i < nc; i++)
+            m_invdiag(i) = _InvAbs(S.coeff(i, i));
+    }
+
+    return true;
+}
+
+void ChPreconditionerSchur::Apply(ChVectorConstRef b, ChVectorRef x) const {
+    ApplyBlocks(b, x);
+    int nc = (int)m_invdiag.size();
+    if (m_use_llt)
+        x.tail(nc) = m_llt.solve(b.tail(nc));
+    else
+        x.tail(nc) = m_invdiag.cwiseProduct(b.tail(nc));
+}
+
+}  // end namespace chrono
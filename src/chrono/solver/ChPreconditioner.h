@@ -0,0 +1,208 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Preconditioners for the Chrono iterative linear solvers (ChIterativeSolverLS).
+//
+// Available preconditioners:
+//   Diagonal (Jacobi)
+//   Block-Jacobi
+//   ILU(0)
+//   IC(0)
+//   Schur complement based block preconditioner for saddle-point problems
+//
+// =============================================================================
+
+#ifndef CH_PRECONDITIONER_H
+#define CH_PRECONDITIONER_H
+
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+
+#include <Eigen/SparseCholesky>
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Base class for preconditioners of the Chrono iterative linear solvers.\n
+/// A preconditioner approximates the inverse of the system matrix
+/// <pre>
+/// | H  Cq'|
+/// | Cq  E |
+/// </pre>
+/// (see ChSystemDescriptor) and is evaluated in the setup phase of the iterative solver (see ChIterativeSolverLS).
+/// Preconditioners used with MINRES must be symmetric positive definite (see IsSymmetricPositiveDefinite).
+class ChApi ChPreconditioner {
+  public:
+    /// Available types of preconditioners.
+    enum class Type {
+        DIAGONAL,      ///< diagonal (Jacobi) preconditioner
+        BLOCK_JACOBI,  ///< block-Jacobi preconditioner (one block per variable object)
+        ILU0,          ///< incomplete LU factorization with zero fill-in
+        IC0,           ///< incomplete Cholesky factorization with zero fill-in
+        SCHUR,         ///< block preconditioner for saddle-point problems based on an approximate Schur complement
+        CUSTOM
+    };
+
+    virtual ~ChPreconditioner() {}
+
+    /// Return type of the preconditioner.
+    virtual Type GetType() const { return Type::CUSTOM; }
+
+    /// Indicate whether or not the preconditioner requires the assembled system matrix.
+    /// If true, the iterative solver assembles the system matrix before calling Setup.
+    virtual bool SetupRequiresMatrix() const = 0;
+
+    /// Evaluate the preconditioner for the problem described by the given system descriptor.
+    /// Z is the assembled system matrix (in compressed form) if SetupRequiresMatrix returns true and an empty matrix
+    /// otherwise. Return true if successful and false otherwise.
+    virtual bool Setup(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) = 0;
+
+    /// Apply the preconditioner, i.e. calculate x = P^(-1) * b.
+    virtual void Apply(ChVectorConstRef b, ChVectorRef x) const = 0;
+
+    /// Indicate whether or not the preconditioner, as evaluated in the last call to Setup, is symmetric positive
+    /// definite. Only such preconditioners are used with MINRES (see ChSolverMINRES). Default: false.
+    virtual bool IsSymmetricPositiveDefinite() const { return false; }
+};
+
+// ---------------------------------------------------------------------------
+
+/// Diagonal (Jacobi) preconditioner.\n
+/// Uses the inverse of the diagonal entries of the system matrix (entries smaller than 1e-9 are replaced by 1).
+/// This preconditioner does not require the assembled system matrix. It is the default preconditioner of all iterative
+/// linear solvers, including MINRES, and is accepted by MINRES (it is positive definite if all diagonal entries of the
+/// system matrix are positive).
+class ChApi ChPreconditionerDiagonal : public ChPreconditioner {
+  public:
+    ChPreconditionerDiagonal() {}
+    virtual Type GetType() const override { return Type::DIAGONAL; }
+    virtual bool SetupRequiresMatrix() const override { return false; }
+    virtual bool Setup(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) override;
+    virtual void Apply(ChVectorConstRef b, ChVectorRef x) const override;
+    virtual bool IsSymmetricPositiveDefinite() const override { return true; }
+
+  private:
+    ChVectorDynamic<> m_invdiag;  ///< inverse diagonal entries
+};
+
+// ---------------------------------------------------------------------------
+
+/// Block-Jacobi preconditioner.\n
+/// Uses the inverse of the diagonal blocks of the H matrix corresponding to each active ChVariables object (i.e., a
+/// 6x6 block for a rigid body, a 3x3 block for an FEA node with 3 DOFs, etc.). These blocks include the mass and the
+/// stiffness and damping contributions of all elements connected to the corresponding body or node. If a block is not
+/// positive definite, its diagonal is used instead. Constraint rows use the inverse of the absolute value of their
+/// diagonal entries (or 1 if this is zero). As such, this preconditioner is symmetric positive definite and can be
+/// used with MINRES.
+class ChApi ChPreconditionerBlockJacobi : public ChPreconditioner {
+  public:
+    ChPreconditionerBlockJacobi() : m_nq(0) {}
+    virtual Type GetType() const override { return Type::BLOCK_JACOBI; }
+    virtual bool SetupRequiresMatrix() const override { return true; }
+    virtual bool Setup(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) override;
+    virtual void Apply(ChVectorConstRef b, ChVectorRef x) const override;
+    virtual bool IsSymmetricPositiveDefinite() const override { return true; }
+
+  protected:
+    /// Apply the block-diagonal approximation of H^(-1) to the first m_nq entries of b.
+    void ApplyBlocks(ChVectorConstRef b, ChVectorRef x) const;
+
+    int m_nq;                                  ///< number of active variables
+    std::vector<int> m_offsets;                ///< offsets of the diagonal blocks
+    std::vector<ChMatrixDynamic<>> m_invblks;  ///< inverses of the diagonal blocks
+    ChVectorDynamic<> m_invdiag;               ///< inverse absolute diagonal entries for constraint rows
+};
+
+// ---------------------------------------------------------------------------
+
+/// Incomplete LU factorization with zero fill-in, ILU(0).\n
+/// The factors L and U have the same sparsity pattern as the system matrix. Zero pivots (e.g., for constraints not
+/// involving any active variables) are replaced by 1. This preconditioner is not symmetric and therefore can only be
+/// used with GMRES or BiCGSTAB.
+class ChApi ChPreconditionerILU0 : public ChPreconditioner {
+  public:
+    ChPreconditionerILU0() {}
+    virtual Type GetType() const override { return Type::ILU0; }
+    virtual bool SetupRequiresMatrix() const override { return true; }
+    virtual bool Setup(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) override;
+    virtual void Apply(ChVectorConstRef b, ChVectorRef x) const override;
+
+  private:
+    ChSparseMatrix m_LU;      ///< L (unit diagonal, not stored) and U factors
+    std::vector<int> m_diag;  ///< index of the diagonal entry in each row of m_LU
+};
+
+// ---------------------------------------------------------------------------
+
+/// Incomplete Cholesky factorization with zero fill-in, IC(0).\n
+/// The factor L has the same sparsity pattern as the lower triangle of the system matrix. This preconditioner is
+/// intended for symmetric positive definite problems (e.g., FEA problems without constraints). Non-positive pivots,
+/// which occur for indefinite matrices, are replaced by the absolute value of the corresponding diagonal entry of the
+/// system matrix (or 1 if this is zero). The resulting preconditioner is then a poor approximation of an indefinite
+/// matrix and is not accepted by MINRES: it is reported as symmetric positive definite only if no pivots were replaced.
+class ChApi ChPreconditionerIC0 : public ChPreconditioner {
+  public:
+    ChPreconditionerIC0() : m_num_shifted(0) {}
+    virtual Type GetType() const override { return Type::IC0; }
+    virtual bool SetupRequiresMatrix() const override { return true; }
+    virtual bool Setup(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) override;
+    virtual void Apply(ChVectorConstRef b, ChVectorRef x) const override;
+
+    virtual bool IsSymmetricPositiveDefinite() const override { return m_num_shifted == 0; }
+
+    /// Return the number of non-positive pivots replaced during the last factorization.
+    int GetNumShiftedPivots() const { return m_num_shifted; }
+
+  private:
+    ChSparseMatrix m_L;  ///< lower triangular factor (diagonal entry last in each row)
+    int m_num_shifted;   ///< number of replaced pivots
+};
+
+// ---------------------------------------------------------------------------
+
+/// Block preconditioner for saddle-point problems, based on an approximate Schur complement.\n
+/// The preconditioner is
+/// <pre>
+/// | Hb  0 |
+/// | 0   S |
+/// </pre>
+/// where Hb is the block-Jacobi approximation of H (see ChPreconditionerBlockJacobi) and S = Cq * Hb^(-1) * Cq' - E
+/// is the corresponding (negated) approximate Schur complement, which is assembled and factorized with a sparse
+/// Cholesky decomposition. If S is not positive definite (e.g., for redundant constraints), the inverse of its
+/// absolute diagonal is used instead. This preconditioner is symmetric positive definite and can be used with MINRES.
+class ChApi ChPreconditionerSchur : public ChPreconditionerBlockJacobi {
+  public:
+    ChPreconditionerSchur() : m_use_llt(false) {}
+    virtual Type GetType() const override { return Type::SCHUR; }
+    virtual bool Setup(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) override;
+    virtual void Apply(ChVectorConstRef b, ChVectorRef x) const override;
+
+    /// Return true if the Schur complement was factorized and false if its diagonal is used instead.
+    bool IsSchurFactorized() const { return m_use_llt; }
+
+  private:
+    Eigen::SimplicialLLT<Eigen::SparseMatrix<double>> m_llt;  ///< Cholesky factorization of S
+    bool m_use_llt;                                           ///< was S successfully factorized?
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
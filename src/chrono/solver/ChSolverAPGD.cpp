@@ -15,6 +15,7 @@
 #include "chrono/solver/ChSolverAPGD.h"
 
 #include "chrono/core/ChStream.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include <iostream>
 #include <sstream>
@@ -72,6 +73,7 @@ double ChSolverAPGD::Res4(ChSystemDescriptor& sysd) {
 }
 
 double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_SCOPE("APGD::Solve", "solver");
     bool verbose = false;
     const std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     const std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
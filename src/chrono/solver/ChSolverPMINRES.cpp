@@ -14,6 +14,7 @@
 
 #include "chrono/solver/ChSolverPMINRES.h"
 #include "chrono/core/ChMathematics.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -26,6 +27,7 @@ ChSolverPMINRES::ChSolverPMINRES()
       r_proj_resid(1e30) {}
 
 double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_SCOPE("PMINRES::Solve", "solver");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
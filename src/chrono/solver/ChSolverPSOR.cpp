@@ -14,15 +14,18 @@
 
 #include "chrono/solver/ChSolverPSOR.h"
 #include "chrono/core/ChMathematics.h"
+#include "chrono/parallel/ChOpenMP.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSolverPSOR)
 
-ChSolverPSOR::ChSolverPSOR() : maxviolation(0) {}
+ChSolverPSOR::ChSolverPSOR() : maxviolation(0), m_coloring(false), m_num_colors(0) {}
 
 double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_SCOPE("PSOR::Solve", "solver");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -78,6 +81,12 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     // 4)  Perform the iteration loops
     //
 
+    if (m_coloring) {
+        ColorConstraints(sysd);
+        SolveColored(sysd);
+        return maxviolation;
+    }
+
     for (int iter = 0; iter < m_max_iterations; iter++) {
         // The iteration on all constraints
         //
@@ -187,4 +196,181 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     return maxviolation;
 }
 
+// -----------------------------------------------------------------------------
+// Parallel (colored) mode
+// -----------------------------------------------------------------------------
+
+void ChSolverPSOR::ColorConstraints(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    // The offsets of active variables were set by the descriptor when counting active variables
+    size_t n_q = 0;
+    for (auto var : mvariables) {
+        if (var->IsActive())
+            n_q = std::max(n_q, (size_t)(var->GetOffset() + var->Get_ndof()));
+    }
+    m_var_colors.assign(n_q, 0);
+
+    for (auto& color : m_colors)
+        color.clear();
+    m_uncolored.clear();
+    m_num_colors = 0;
+
+    std::vector<ChVariables*> unit_vars;
+    int nc = (int)mconstraints.size();
+    int ic = 0;
+    while (ic < nc) {
+        // A unit is a friction triplet (N,U,V) or a single constraint. The U and V components of a triplet act on the
+        // same variables as the N component, so only the latter needs to be inspected.
+        int unit_size = (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC && ic + 2 < nc) ? 3 : 1;
+        int first = ic;
+        ic += unit_size;
+
+        if (!mconstraints[first]->IsActive())
+            continue;
+
+        unit_vars.clear();
+        if (!mconstraints[first]->AppendVariables(unit_vars)) {
+            m_uncolored.push_back(first);
+            continue;
+        }
+
+        uint64_t used = 0;
+        for (auto var : unit_vars) {
+            if (var && var->IsActive())
+                used |= m_var_colors[var->GetOffset()];
+        }
+
+        // Pick the first color not used by any of the variables of this unit
+        uint64_t available = ~used;
+        if (available == 0) {
+            m_uncolored.push_back(first);
+            continue;
+        }
+        size_t color = 0;
+        while (!(available & 1)) {
+            available >>= 1;
+            color++;
+        }
+
+        uint64_t mask = uint64_t(1) << color;
+        for (auto var : unit_vars) {
+            if (var && var->IsActive())
+                m_var_colors[var->GetOffset()] |= mask;
+        }
+
+        if (color >= m_colors.size())
+            m_colors.resize(color + 1);
+        m_colors[color].push_back(first);
+        m_num_colors = std::max(m_num_colors, color + 1);
+    }
+}
+
+void ChSolverPSOR::UpdateUnit(std::vector<ChConstraint*>& mconstraints,
+                              int ic,
+                              double& violation,
+                              double& deltalambda) {
+    if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
+        // Same arithmetic as in the serial loop: residuals of N,U,V are all evaluated before q is updated
+        double old_lambda[3];
+        double new_lambda[3];
+        for (int k = 0; k < 3; k++) {
+            ChConstraint* c = mconstraints[ic + k];
+            double mresidual = c->Compute_Cq_q() + c->Get_b_i() + c->Get_cfm_i() * c->Get_l_i();
+            if (k == 0)
+                violation = fabs(ChMin(0.0, mresidual));
+            double deltal = (m_omega / c->Get_g_i()) * (-mresidual);
+            old_lambda[k] = c->Get_l_i();
+            c->Set_l_i(old_lambda[k] + deltal);
+        }
+        mconstraints[ic]->Project();  // the N normal component will take care of N,U,V
+        for (int k = 0; k < 3; k++) {
+            new_lambda[k] = mconstraints[ic + k]->Get_l_i();
+            if (m_shlambda != 1.0) {
+                new_lambda[k] = m_shlambda * new_lambda[k] + (1.0 - m_shlambda) * old_lambda[k];
+                mconstraints[ic + k]->Set_l_i(new_lambda[k]);
+            }
+        }
+        deltalambda = 0;
+        for (int k = 0; k < 3; k++) {
+            double true_delta = new_lambda[k] - old_lambda[k];
+            mconstraints[ic + k]->Increment_q(true_delta);
+            deltalambda = ChMax(deltalambda, fabs(true_delta));
+        }
+        return;
+    }
+
+    ChConstraint* c = mconstraints[ic];
+    double mresidual = c->Compute_Cq_q() + c->Get_b_i() + c->Get_cfm_i() * c->Get_l_i();
+    violation = fabs(c->Violation(mresidual));
+    double deltal = (m_omega / c->Get_g_i()) * (-mresidual);
+    double old_lambda = c->Get_l_i();
+    c->Set_l_i(old_lambda + deltal);
+    c->Project();
+    double new_lambda = c->Get_l_i();
+    if (m_shlambda != 1.0) {
+        new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+        c->Set_l_i(new_lambda);
+    }
+    double true_delta = new_lambda - old_lambda;
+    c->Increment_q(true_delta);
+    deltalambda = fabs(true_delta);
+}
+
+void ChSolverPSOR::SolveColored(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    int nthreads = std::max(1, sysd.GetNumThreads());
+    size_t ncolors = m_num_colors;
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        maxviolation = 0;
+        double maxdeltalambda = 0;
+
+        // Constraints of a same color do not share variables, so they can be updated concurrently.
+        // The implicit barrier at the end of each 'omp for' enforces the sequential sweep over colors.
+#pragma omp parallel num_threads(nthreads)
+        {
+            double t_maxviolation = 0;
+            double t_maxdeltalambda = 0;
+            for (size_t color = 0; color < ncolors; color++) {
+                const std::vector<int>& units = m_colors[color];
+                int nunits = (int)units.size();
+#pragma omp for schedule(static)
+                for (int iu = 0; iu < nunits; iu++) {
+                    double violation;
+                    double deltalambda;
+                    UpdateUnit(mconstraints, units[iu], violation, deltalambda);
+                    t_maxviolation = ChMax(t_maxviolation, violation);
+                    t_maxdeltalambda = ChMax(t_maxdeltalambda, deltalambda);
+                }
+            }
+#pragma omp critical(ChSolverPSOR_reduction)
+            {
+                maxviolation = ChMax(maxviolation, t_maxviolation);
+                maxdeltalambda = ChMax(maxdeltalambda, t_maxdeltalambda);
+            }
+        }
+
+        // Constraints that could not be colored
+        for (auto ic : m_uncolored) {
+            double violation;
+            double deltalambda;
+            UpdateUnit(mconstraints, ic, violation, deltalambda);
+            maxviolation = ChMax(maxviolation, violation);
+            maxdeltalambda = ChMax(maxdeltalambda, deltalambda);
+        }
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+    }
+}
+
 }  // end namespace chrono
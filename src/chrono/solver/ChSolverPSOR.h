@@ -15,6 +15,9 @@
 #ifndef CHSOLVER_PSOR_H
 #define CHSOLVER_PSOR_H
 
+#include <cstdint>
+#include <vector>
+
 #include "chrono/solver/ChIterativeSolverVI.h"
 
 namespace chrono {
@@ -25,7 +28,8 @@ namespace chrono {
 /// An iterative solver based on projective fixed point method, with overrelaxation and immediate variable update as in
 /// SOR methods.\n
 /// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
-/// solver.
+/// solver.\n
+/// Optionally, the solver can run in a parallel (colored) mode, see EnableColoring().
 
 class ChApi ChSolverPSOR : public ChIterativeSolverVI {
   public:
@@ -44,8 +48,40 @@ class ChApi ChSolverPSOR : public ChIterativeSolverVI {
     /// For the PSOR solver, this is the maximum constraint violation.
     virtual double GetError() const override { return maxviolation; }
 
+    /// Enable/disable the parallel Gauss-Seidel mode based on graph coloring of the constraints (default: false).
+    /// In this mode, constraints are partitioned into groups (colors) such that no two constraints in the same group
+    /// act on the same variables. Groups are swept sequentially, while the constraints of each group are updated in
+    /// parallel using the number of threads set with ChSystem::SetNumThreads. Friction constraints are kept together
+    /// as (N,U,V) triplets. Constraints that cannot report their variables (see ChConstraint::AppendVariables) are
+    /// updated serially after all colored groups. Since the update order differs from the default mode, results are
+    /// not bit-for-bit identical to those of the serial PSOR, but they do not depend on the number of threads.
+    void EnableColoring(bool val) { m_coloring = val; }
+
+    /// Return true if the parallel colored mode is enabled.
+    bool IsColoringEnabled() const { return m_coloring; }
+
+    /// Return the number of colors used during the last solve (0 if the colored mode is not enabled).
+    int GetNumColors() const { return m_coloring ? (int)m_num_colors : 0; }
+
+    /// Return the number of constraints (or friction triplets) updated serially during the last colored solve.
+    int GetNumUncolored() const { return (int)m_uncolored.size(); }
+
   private:
+    /// Partition the active constraints of the descriptor into groups with no shared variables.
+    void ColorConstraints(ChSystemDescriptor& sysd);
+
+    /// Iteration loop of the colored mode.
+    void SolveColored(ChSystemDescriptor& sysd);
+
+    /// Perform the PSOR update of one single constraint or friction triplet, starting at the given constraint.
+    void UpdateUnit(std::vector<ChConstraint*>& mconstraints, int ic, double& violation, double& deltalambda);
+
     double maxviolation;
+    bool m_coloring;                         ///< use parallel colored sweeps
+    size_t m_num_colors;                     ///< number of colors used in last colored solve
+    std::vector<std::vector<int>> m_colors;  ///< per color, indices of first constraint of each unit
+    std::vector<int> m_uncolored;            ///< units that must be updated serially
+    std::vector<uint64_t> m_var_colors;      ///< per variable dof offset, bitmask of colors already in use
 };
 
 /// @} chrono_solver
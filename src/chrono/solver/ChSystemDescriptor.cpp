@@ -15,7 +15,10 @@
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
+#include "chrono/solver/ChKblockGeneric.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/parallel/ChOpenMP.h"
 
 namespace chrono {
 
@@ -25,7 +28,7 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false), num_threads(1) {
     vconstraints.clear();
     vvariables.clear();
     vstiffness.clear();
@@ -199,7 +202,6 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChVectorDynamic<
 
     auto mv_size = mvariables.size();
     auto mc_size = mconstraints.size();
-    auto vs_size = vstiffness.size();
 
     // Count constraints.
     int mn_c = 0;
@@ -226,9 +228,7 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChVectorDynamic<
         }
 
         // If present, add stiffness matrix K to upper-left block of Z.
-        for (size_t ik = 0; ik < vs_size; ik++) {
-            vstiffness[ik]->Build_K(*Z, true);
-        }
+        LoadKblocks(*Z);
 
         // Fill Z by looping over constraints.
         int s_c = 0;
@@ -270,6 +270,84 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChVectorDynamic<
     }
 }
 
+void ChSystemDescriptor::LoadKblocks(ChSparseMatrix& storage) {
+    const int max_colors = 64;
+    int nblocks = (int)vstiffness.size();
+
+    // Load serially if single-threaded, if there are only a few blocks, or if the matrix is a sparsity pattern learner
+    // (which records the nonzeros in SetElement).
+    if (num_threads <= 1 || nblocks < 64 || dynamic_cast<ChSparsityPatternLearner*>(&storage)) {
+        for (int ik = 0; ik < nblocks; ik++) {
+            vstiffness[ik]->Build_K(storage, true);
+        }
+        return;
+    }
+
+    // Greedy coloring of the stiffness blocks. For each variable (identified by its offset), keep a bit mask of the
+    // colors of the blocks already referencing it; a block gets the first color not used by any of its variables.
+    // Blocks of other types and blocks that cannot be colored are loaded serially.
+    std::vector<uint64_t> var_colors(storage.rows(), 0);
+    std::vector<int> block_color(nblocks, -1);
+    kblock_color_start.assign(max_colors + 1, 0);
+    kblock_serial.clear();
+
+    for (int ik = 0; ik < nblocks; ik++) {
+        auto kb = dynamic_cast<ChKblockGeneric*>(vstiffness[ik]);
+        if (!kb) {
+            kblock_serial.push_back(ik);
+            continue;
+        }
+        uint64_t used = 0;
+        for (unsigned int iv = 0; iv < kb->GetNvars(); iv++) {
+            if (kb->GetVariableN(iv)->IsActive())
+                used |= var_colors[kb->GetVariableN(iv)->GetOffset()];
+        }
+        if (used == ~uint64_t(0)) {
+            kblock_serial.push_back(ik);
+            continue;
+        }
+        int color = 0;
+        while (used & (uint64_t(1) << color))
+            color++;
+        for (unsigned int iv = 0; iv < kb->GetNvars(); iv++) {
+            if (kb->GetVariableN(iv)->IsActive())
+                var_colors[kb->GetVariableN(iv)->GetOffset()] |= uint64_t(1) << color;
+        }
+        block_color[ik] = color;
+        kblock_color_start[color + 1]++;
+    }
+
+    for (int c = 0; c < max_colors; c++)
+        kblock_color_start[c + 1] += kblock_color_start[c];
+    kblock_colored.resize(kblock_color_start[max_colors]);
+    std::vector<int> fill(kblock_color_start.begin(), kblock_color_start.end() - 1);
+    for (int ik = 0; ik < nblocks; ik++) {
+        if (block_color[ik] >= 0)
+            kblock_colored[fill[block_color[ik]]++] = ik;
+    }
+
+    // Load the blocks of each color in parallel. Elements that cannot be stored in place are collected per thread.
+    std::vector<std::vector<Eigen::Triplet<double>>> overflow(num_threads);
+    for (int c = 0; c < max_colors; c++) {
+        int start = kblock_color_start[c];
+        int end = kblock_color_start[c + 1];
+#pragma omp parallel for schedule(dynamic, 16) num_threads(num_threads)
+        for (int i = start; i < end; i++) {
+            auto kb = static_cast<ChKblockGeneric*>(vstiffness[kblock_colored[i]]);
+            kb->Build_K_InPlace(storage, overflow[ChOMP::GetThreadNum()]);
+        }
+    }
+
+    // Serial loading of the remaining blocks and elements
+    for (auto ik : kblock_serial) {
+        vstiffness[ik]->Build_K(storage, true);
+    }
+    for (const auto& list : overflow) {
+        for (const auto& t : list)
+            storage.SetElement(t.row(), t.col(), t.value(), false);
+    }
+}
+
 void ChSystemDescriptor::DumpLastMatrices(bool assembled, const char* path) {
     char filename[300];
     try {
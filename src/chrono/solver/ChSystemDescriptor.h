@@ -81,6 +81,11 @@ class ChApi ChSystemDescriptor {
     int n_q;            ///< number of active variables
     int n_c;            ///< number of active constraints
     bool freeze_count;  ///< for optimization: avoid to re-count the number of active variables and constraints
+    int num_threads;    ///< number of threads that solvers may use when operating on this descriptor
+
+    std::vector<int> kblock_color_start;  ///< start of each color in kblock_colored
+    std::vector<int> kblock_colored;      ///< stiffness blocks loaded in parallel, grouped by color
+    std::vector<int> kblock_serial;       ///< stiffness blocks loaded serially
 
   public:
     /// Constructor
@@ -146,6 +151,13 @@ class ChApi ChSystemDescriptor {
     /// when performing ShurComplementProduct(), SystemProduct(), ConvertToMatrixForm(),
     virtual double GetMassFactor() { return c_a; }
 
+    /// Set the number of threads that solvers may use when operating on this descriptor (default: 1).
+    /// This is set automatically by the owning ChSystem (see ChSystem::SetNumThreads).
+    void SetNumThreads(int nthreads) { num_threads = nthreads; }
+
+    /// Get the number of threads that solvers may use when operating on this descriptor.
+    int GetNumThreads() const { return num_threads; }
+
     // DATA <-> MATH.VECTORS FUNCTIONS
 
     /// Get a vector with all the 'fb' known terms ('forces'etc.) associated to all variables,
@@ -321,10 +333,21 @@ class ChApi ChSystemDescriptor {
     );
 
     /// Create and return the assembled system matrix and RHS vector.
+    /// If using more than one thread (see SetNumThreads), the stiffness blocks are loaded in parallel (see
+    /// LoadKblocks).
     virtual void ConvertToMatrixForm(ChSparseMatrix* Z,      ///< [out] assembled system matrix
                                      ChVectorDynamic<>* rhs  ///< [out] assembled RHS vector
     );
 
+    /// Add all stiffness blocks to the given matrix (with SetElement, in add mode).
+    /// With more than one thread, the blocks are partitioned in colors such that no two blocks in the same color share
+    /// a variable (greedy coloring). The blocks of a color are then loaded concurrently, each writing only the rows of
+    /// its own variables (see ChKblockGeneric::Build_K_InPlace). This requires the sparsity pattern of the matrix to
+    /// be known (compressed matrix) or the space for the nonzeros of each row to be reserved (e.g. when using the
+    /// sparsity pattern learner); elements that do not fit in place are added serially at the end. Entries shared by
+    /// several blocks are summed in color order rather than in block order.
+    void LoadKblocks(ChSparseMatrix& storage);
+
     /// Saves to disk the LAST used matrices of the problem.
     /// If assembled == true,
     ///    dump_Z.dat   has the assembled optimization matrix (Matlab sparse format)
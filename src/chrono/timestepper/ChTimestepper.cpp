@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -306,6 +307,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicit)
 
 // Performs a step of Euler implicit for II order systems
 void ChTimestepperEulerImplicit::Advance(const double dt) {
+    CH_TRACE_SCOPE("EulerImplicit::Advance", "timestepper");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -336,6 +338,15 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
+    numrefreshes = 0;
+
+    // Unless reusing the Newton matrix across steps, a full Newton iteration is performed (matrix update at each
+    // iteration). Otherwise, the matrix is only updated if out-of-date or if the contraction rate is too slow.
+    int n = mintegrable->GetNcoords_v();
+    int m = mintegrable->GetNconstr();
+    bool call_setup = !CanReuseJacobian(dt, n, m);
+    bool converged = false;
+    double Dv_nrm_prev = 0;
 
     for (int i = 0; i < this->GetMaxiters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
@@ -350,8 +361,10 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             GetLog() << " Euler iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
                      << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << "\n";
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
+        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+            converged = true;
             break;
+        }
 
         mintegrable->StateSolveCorrection(  //
             Dv, Dl, R, Qc,                  //
@@ -361,13 +374,27 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always call the solver's Setup
+            call_setup                      // call the solver's Setup?
         );
 
         numiters++;
-        numsetups++;
         numsolves++;
 
+        bool setup_called = call_setup;
+        if (call_setup) {
+            numsetups++;
+            JacobianUpdated(dt, n, m);
+        }
+        call_setup = !jacobian_reuse;
+
+        // If reusing the Newton matrix across steps, request a refresh if convergence is too slow
+        if (jacobian_reuse) {
+            double Dv_nrm = Dv.lpNorm<Eigen::Infinity>();
+            if (i > 0 && !setup_called && MonitorContraction(Dv_nrm_prev, Dv_nrm))
+                call_setup = true;
+            Dv_nrm_prev = Dv_nrm;
+        }
+
         Dl *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
 
@@ -376,6 +403,10 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
         Xnew = X + Vnew * dt;
     }
 
+    // Do not carry over a Newton matrix with which the iteration did not converge
+    if (jacobian_reuse && !converged)
+        ForceJacobianUpdate();
+
     mintegrable->StateScatterAcceleration(
         (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
@@ -399,6 +430,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicitLinearized)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the typical Anitescu stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
+    CH_TRACE_SCOPE("EulerImplicitLinearized::Advance", "timestepper");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -469,6 +501,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicitProjected)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the Tasora stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
+    CH_TRACE_SCOPE("EulerImplicitProjected::Advance", "timestepper");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -562,6 +595,7 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidal)
 // order in constraint reactions. Use damped HHT or damped Newmark for
 // more advanced options.
 void ChTimestepperTrapezoidal::Advance(const double dt) {
+    CH_TRACE_SCOPE("Trapezoidal::Advance", "timestepper");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -822,6 +856,7 @@ void ChTimestepperNewmark::SetGammaBeta(double mgamma, double mbeta) {
 
 // Performs a step of Newmark constrained implicit for II order DAE systems
 void ChTimestepperNewmark::Advance(const double dt) {
+    CH_TRACE_SCOPE("Newmark::Advance", "timestepper");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
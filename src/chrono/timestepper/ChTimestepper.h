@@ -182,13 +182,36 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     double abstolS;  ///< absolute tolerance (states)
     double abstolL;  ///< absolute tolerance (Lagrange multipliers)
 
-    int numiters;   ///< number of iterations
-    int numsetups;  ///< number of calls to the solver's Setup function
-    int numsolves;  ///< number of calls to the solver's Solve function
+    int numiters;      ///< number of iterations
+    int numsetups;     ///< number of calls to the solver's Setup function
+    int numsolves;     ///< number of calls to the solver's Solve function
+    int numrefreshes;  ///< number of Newton matrix refreshes requested by the convergence monitor
+
+    bool jacobian_reuse;      ///< reuse the Newton matrix (and its factorization) across steps?
+    double max_contraction;   ///< contraction rate above which the Newton matrix is refreshed
+    double contraction_rate;  ///< last estimate of the Newton contraction rate
+    bool jacobian_valid;      ///< is the last evaluated Newton matrix available for reuse?
+    double jacobian_h;        ///< step size used when the Newton matrix was last evaluated
+    int jacobian_n;           ///< number of state derivatives when the Newton matrix was last evaluated
+    int jacobian_m;           ///< number of constraints when the Newton matrix was last evaluated
 
   public:
     ChImplicitIterativeTimestepper()
-        : maxiters(6), reltol(1e-4), abstolS(1e-10), abstolL(1e-10), numiters(0), numsetups(0), numsolves(0) {}
+        : maxiters(6),
+          reltol(1e-4),
+          abstolS(1e-10),
+          abstolL(1e-10),
+          numiters(0),
+          numsetups(0),
+          numsolves(0),
+          numrefreshes(0),
+          jacobian_reuse(false),
+          max_contraction(0.5),
+          contraction_rate(0),
+          jacobian_valid(false),
+          jacobian_h(0),
+          jacobian_n(0),
+          jacobian_m(0) {}
     virtual ~ChImplicitIterativeTimestepper() {}
 
     /// Set the max number of iterations using the Newton Raphson procedure
@@ -228,6 +251,65 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     /// Return the number of calls to the solver's Solve function.
     int GetNumSolveCalls() const { return numsolves; }
 
+    /// Enable/disable reuse of the Newton matrix across steps (default: false).\n
+    /// If enabled, the Newton matrix is evaluated and factorized (i.e., the solver's Setup function is called) only
+    /// when needed: at the first step, when the step size or the problem size changes, or when the Newton contraction
+    /// rate (the ratio of successive correction norms) exceeds the threshold set with SetMaxContractionRate. A step
+    /// that fails to converge with an out-of-date matrix is re-attempted with a fresh one.\n
+    /// This is only useful with solvers for which the Setup phase is expensive (e.g., direct sparse solvers) and for
+    /// problems where the Newton matrix changes slowly from step to step. Note that the solver must not be used for
+    /// other analyses in between steps; otherwise, call ForceJacobianUpdate.
+    void SetJacobianReuse(bool val) {
+        jacobian_reuse = val;
+        jacobian_valid = false;
+    }
+
+    /// Return true if reuse of the Newton matrix across steps is enabled.
+    bool GetJacobianReuse() const { return jacobian_reuse; }
+
+    /// Set the Newton contraction rate above which an out-of-date Newton matrix is refreshed (default: 0.5).
+    /// Only used if reuse of the Newton matrix across steps is enabled.
+    void SetMaxContractionRate(double rate) { max_contraction = rate; }
+
+    /// Force a re-evaluation of the Newton matrix at the next step.
+    void ForceJacobianUpdate() { jacobian_valid = false; }
+
+    /// Return the last estimate of the Newton contraction rate.
+    double GetContractionRate() const { return contraction_rate; }
+
+    /// Return the number of Newton matrix refreshes requested by the convergence monitor during the last step.
+    /// Only relevant if reuse of the Newton matrix across steps is enabled.
+    int GetNumJacobianRefreshes() const { return numrefreshes; }
+
+  protected:
+    /// Return true if the last evaluated Newton matrix can be used for a step of size h on a problem with n state
+    /// derivatives and m constraints.
+    bool CanReuseJacobian(double h, int n, int m) const {
+        return jacobian_reuse && jacobian_valid && h == jacobian_h && n == jacobian_n && m == jacobian_m;
+    }
+
+    /// Record an evaluation of the Newton matrix for a step of size h on a problem of size (n,m).
+    void JacobianUpdated(double h, int n, int m) {
+        jacobian_valid = true;
+        jacobian_h = h;
+        jacobian_n = n;
+        jacobian_m = m;
+    }
+
+    /// Update the estimate of the Newton contraction rate, given the norms of two successive corrections computed
+    /// with the same Newton matrix. Return true (and invalidate the current matrix) if the matrix must be refreshed.
+    bool MonitorContraction(double prev_norm, double norm) {
+        if (prev_norm <= 0)
+            return false;
+        contraction_rate = norm / prev_norm;
+        if (contraction_rate <= max_contraction)
+            return false;
+        jacobian_valid = false;
+        numrefreshes++;
+        return true;
+    }
+
+  public:
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& archive) {
         // version number
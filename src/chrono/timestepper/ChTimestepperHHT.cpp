@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -50,6 +51,7 @@ void ChTimestepperHHT::SetAlpha(double malpha) {
 
 // Performs a step of HHT (generalized alpha) implicit for II order systems
 void ChTimestepperHHT::Advance(const double dt) {
+    CH_TRACE_SCOPE("HHT::Advance", "timestepper");
     // Downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -103,12 +105,17 @@ void ChTimestepperHHT::Advance(const double dt) {
 
     // Monitor flags controlling whther or not the Newton matrix must be updated.
     // If using modified Newton, a matrix update occurs:
-    //   - at the beginning of a step
+    //   - at the beginning of a step (unless reusing the matrix across steps)
     //   - on a stepsize decrease
     //   - if the Newton iteration does not converge with an out-of-date matrix
+    //   - if the Newton contraction rate with an out-of-date matrix is too slow (if reusing the matrix across steps)
     // Otherwise, the matrix is updated at each iteration.
+    int n = mintegrable->GetNcoords_v();
+    int m = mintegrable->GetNconstr();
+    bool reuse = modified_Newton && jacobian_reuse;
     matrix_is_current = false;
-    call_setup = true;
+    call_setup = !(reuse && CanReuseJacobian(h, n, m));
+    numrefreshes = 0;
 
     // Loop until reaching final time
     while (true) {
@@ -117,6 +124,8 @@ void ChTimestepperHHT::Advance(const double dt) {
 
         // Newton-Raphson for state at T+h
         bool converged = false;
+        bool refreshed = call_setup;  // was the Newton matrix evaluated during this attempt?
+        double Da_nrm_prev = 0;
         int it;
 
         for (it = 0; it < maxiters; it++) {
@@ -124,6 +133,7 @@ void ChTimestepperHHT::Advance(const double dt) {
                 GetLog() << " HHT call Setup.\n";
 
             // Solve linear system and increment state
+            bool setup_called = call_setup;
             Increment(mintegrable, scaling_factor);
 
             // Increment counters
@@ -131,11 +141,24 @@ void ChTimestepperHHT::Advance(const double dt) {
             numsolves++;
             if (call_setup) {
                 numsetups++;
+                JacobianUpdated(h, n, m);
+                refreshed = true;
             }
 
             // If using modified Newton, do not call Setup again
             call_setup = !modified_Newton;
 
+            // If reusing the Newton matrix across steps, request a refresh if convergence is too slow
+            if (reuse) {
+                double Da_nrm = Da.wrmsNorm(ewtS);
+                if (it > 0 && !setup_called && MonitorContraction(Da_nrm_prev, Da_nrm)) {
+                    call_setup = true;
+                    if (verbose)
+                        GetLog() << " HHT slow contraction (" << contraction_rate << "). Refresh Newton matrix.\n";
+                }
+                Da_nrm_prev = Da_nrm;
+            }
+
             // A flag to indicate the trend of convergence
             if ((Rold.norm() < R.norm()) && (R.norm() > threshold_R)) {
                 convergence_trend_flag = false; // very dangerous, seems to diverge
@@ -182,20 +205,15 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
-            /*
-            } else if (!matrix_is_current) {
-                // ------ NR did not converge but the matrix was out-of-date
-
-                // reset the count of successive successful steps
-                num_successful_steps = 0;
+        } else if (reuse && !refreshed) {
+            // ------ NR did not converge with a Newton matrix from a previous step
 
-                // re-attempt step with updated matrix
-                if (verbose) {
-                    GetLog() << " HHT re-attempt step with updated matrix.\n";
-                }
+            // re-attempt step with updated matrix
+            if (verbose)
+                GetLog() << " HHT re-attempt step with updated matrix.\n";
 
-                call_setup = true;
-            */
+            call_setup = true;
+            numrefreshes++;
 
         } else if (!step_control) {
             // ------ NR did not converge and we do not control stepsize
@@ -0,0 +1,199 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "chrono/utils/ChTraceProfiler.h"
+
+namespace chrono {
+namespace utils {
+
+std::atomic<bool> ChTraceProfiler::enabled(false);
+
+namespace {
+
+struct TraceSpan {
+    const char* name;
+    const char* category;
+    int64_t start;
+    int64_t end;
+};
+
+// Ring buffer of spans recorded by one thread.
+struct TraceBuffer {
+    TraceBuffer(int id, size_t capacity) : tid(id), spans(capacity), head(0), count(0) {}
+
+    void Push(const TraceSpan& span) {
+        spans[head] = span;
+        head = (head + 1) % spans.size();
+        if (count < spans.size())
+            count++;
+    }
+
+    // Index of the i-th stored span, from oldest to newest
+    size_t Index(size_t i) const { return (head + spans.size() - count + i) % spans.size(); }
+
+    int tid;
+    std::vector<TraceSpan> spans;
+    size_t head;
+    size_t count;
+};
+
+// Registry of all per-thread buffers. Buffers are owned by the registry (and not by the threads), so that spans
+// recorded by threads that have terminated can still be exported.
+struct TraceRegistry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<TraceBuffer>> buffers;
+    size_t capacity = 65536;
+    std::set<std::string> names;  // interned span names
+};
+
+TraceRegistry& GetRegistry() {
+    static TraceRegistry registry;
+    return registry;
+}
+
+thread_local TraceBuffer* thread_buffer = nullptr;
+
+TraceBuffer* GetThreadBuffer() {
+    if (!thread_buffer) {
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.buffers.emplace_back(new TraceBuffer((int)registry.buffers.size(), registry.capacity));
+        thread_buffer = registry.buffers.back().get();
+    }
+    return thread_buffer;
+}
+
+void WriteEscaped(std::ostream& os, const char* str) {
+    for (const char* c = str; *c; c++) {
+        if (*c == '"' || *c == '\\')
+            os << '\\';
+        os << *c;
+    }
+}
+
+}  // end anonymous namespace
+
+int64_t ChTraceProfiler::Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void ChTraceProfiler::Record(const char* name, const char* category, int64_t start, int64_t end) {
+    GetThreadBuffer()->Push({name, category, start, end});
+}
+
+const char* ChTraceProfiler::Intern(const std::string& str) {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.names.insert(str).first->c_str();
+}
+
+void ChTraceProfiler::SetBufferSize(size_t size) {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.capacity = size > 0 ? size : 1;
+}
+
+void ChTraceProfiler::Clear() {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& buffer : registry.buffers) {
+        buffer->spans.assign(registry.capacity, TraceSpan());
+        buffer->head = 0;
+        buffer->count = 0;
+    }
+}
+
+size_t ChTraceProfiler::GetNumSpans() {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    size_t num = 0;
+    for (auto& buffer : registry.buffers)
+        num += buffer->count;
+    return num;
+}
+
+int ChTraceProfiler::GetNumThreads() {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    int num = 0;
+    for (auto& buffer : registry.buffers)
+        num += (buffer->count > 0);
+    return num;
+}
+
+void ChTraceProfiler::ExportChromeTrace(std::ostream& os) {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    // Report times relative to the earliest recorded span
+    int64_t origin = INT64_MAX;
+    for (auto& buffer : registry.buffers) {
+        if (buffer->count > 0)
+            origin = std::min(origin, buffer->spans[buffer->Index(0)].start);
+    }
+
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (auto& buffer : registry.buffers) {
+        if (buffer->count == 0)
+            continue;
+
+        // Thread name metadata event
+        os << (first ? "\n" : ",\n");
+        first = false;
+        os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->tid
+           << ",\"args\":{\"name\":\"thread " << buffer->tid << "\"}}";
+
+        // Complete events (times in microseconds)
+        for (size_t i = 0; i < buffer->count; i++) {
+            const auto& span = buffer->spans[buffer->Index(i)];
+            os << ",\n{\"name\":\"";
+            WriteEscaped(os, span.name);
+            os << "\",\"cat\":\"";
+            WriteEscaped(os, span.category);
+            os << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->tid << ",\"ts\":" << (span.start - origin) * 1e-3
+               << ",\"dur\":" << (span.end - span.start) * 1e-3 << "}";
+        }
+    }
+    os << "\n]}\n";
+
+    os.flags(flags);
+    os.precision(precision);
+}
+
+bool ChTraceProfiler::ExportChromeTrace(const std::string& filename) {
+    std::ofstream ofile(filename);
+    if (!ofile.is_open())
+        return false;
+    ExportChromeTrace(ofile);
+    return true;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,143 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Thread-aware hierarchical trace profiler, with export to the Chrome trace
+// event format (chrome://tracing, https://ui.perfetto.dev).
+//
+// =============================================================================
+
+#ifndef CH_TRACE_PROFILER_H
+#define CH_TRACE_PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "chrono/ChConfig.h"
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Thread-aware hierarchical trace profiler.
+/// Code regions are marked with the CH_TRACE_SCOPE(name, category) macro, which records a time span (begin time and
+/// duration) when the enclosing scope is exited. Spans are recorded into a fixed-size ring buffer owned by the calling
+/// thread, so that recording requires no synchronization and no memory allocation; when a buffer is full, the oldest
+/// spans are overwritten. Nesting of scopes on a given thread defines the hierarchy.
+///
+/// Recording is disabled by default and can be switched on and off at run time with Enable(). While disabled, a
+/// trace scope costs a single test of a flag. If Chrono is configured with ENABLE_TRACE_PROFILER=OFF, the macros
+/// expand to nothing.
+///
+/// The recorded spans can be exported to the Chrome trace event JSON format, which can be loaded in chrome://tracing
+/// or in the Perfetto UI. Export must not be called while other threads are recording (e.g. call it between
+/// simulation steps).
+///
+/// Note that span names and categories are stored by pointer and must therefore be string literals (or otherwise
+/// outlive the profiler).
+class ChApi ChTraceProfiler {
+  public:
+    /// Enable/disable recording of trace spans (default: false).
+    static void Enable(bool val) { enabled.store(val, std::memory_order_relaxed); }
+
+    /// Return true if recording of trace spans is enabled.
+    static bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    /// Set the capacity (number of spans) of the per-thread ring buffers (default: 65536).
+    /// Only affects buffers of threads that did not record any span yet, unless called after Clear().
+    static void SetBufferSize(size_t size);
+
+    /// Discard all recorded spans.
+    static void Clear();
+
+    /// Return the total number of spans currently stored (over all threads).
+    static size_t GetNumSpans();
+
+    /// Return the number of threads that recorded spans.
+    static int GetNumThreads();
+
+    /// Export all recorded spans in Chrome trace event JSON format.
+    static void ExportChromeTrace(std::ostream& os);
+
+    /// Export all recorded spans in Chrome trace event JSON format to the specified file.
+    /// Return false if the file could not be opened.
+    static bool ExportChromeTrace(const std::string& filename);
+
+    /// Return the current time (in nanoseconds) on the profiler clock.
+    static int64_t Now();
+
+    /// Record a span on the calling thread's buffer.
+    static void Record(const char* name, const char* category, int64_t start, int64_t end);
+
+    /// Return a pointer to a copy of the given string, owned by the profiler and valid for the lifetime of the program.
+    /// Use this to obtain span names from strings that are not literals.
+    static const char* Intern(const std::string& str);
+
+  private:
+    static std::atomic<bool> enabled;
+};
+
+/// Scope object recording a trace span from its construction to its destruction (or to an explicit call to End).
+/// Use through the CH_TRACE_SCOPE or CH_TRACE_BEGIN/CH_TRACE_END macros.
+class ChTraceScope {
+  public:
+    ChTraceScope(const char* name, const char* category)
+        : m_name(name), m_category(category), m_start(ChTraceProfiler::IsEnabled() ? ChTraceProfiler::Now() : -1) {}
+
+    ~ChTraceScope() { End(); }
+
+    /// Record the span now (the span is recorded only once).
+    void End() {
+        if (m_start >= 0)
+            ChTraceProfiler::Record(m_name, m_category, m_start, ChTraceProfiler::Now());
+        m_start = -1;
+    }
+
+  private:
+    ChTraceScope(const ChTraceScope&) = delete;
+    ChTraceScope& operator=(const ChTraceScope&) = delete;
+
+    const char* m_name;
+    const char* m_category;
+    int64_t m_start;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#define CH_TRACE_CONCAT_IMPL(a, b) a##b
+#define CH_TRACE_CONCAT(a, b) CH_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef CHRONO_TRACE_PROFILER
+/// Record a trace span with given name and category for the enclosing scope.
+#define CH_TRACE_SCOPE(name, category) \
+    chrono::utils::ChTraceScope CH_TRACE_CONCAT(ch_trace_scope_, __LINE__)(name, category)
+/// Start a trace span identified by a local variable 'var' (for code regions that are not a scope).
+/// The span ends at CH_TRACE_END(var) or, at the latest, at the end of the enclosing scope.
+#define CH_TRACE_BEGIN(var, name, category) chrono::utils::ChTraceScope var(name, category)
+/// End a trace span started with CH_TRACE_BEGIN.
+#define CH_TRACE_END(var) var.End()
+#else
+#define CH_TRACE_SCOPE(name, category)
+#define CH_TRACE_BEGIN(var, name, category)
+#define CH_TRACE_END(var)
+#endif
+
+#endif
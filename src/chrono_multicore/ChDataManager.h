@@ -191,9 +191,6 @@ typedef blaze::Subvector<const DynamicVector<real>> ConstSubVectorType;
 //// Viscosity
 //#define _GAMMAFFV_ submatrix(_gamma_,  _num_uni_ + _num_bil_ + 3 * _num_rf_c_ + _num_fluid_,  3 * _num_fluid_)
 
-// The maximum number of shear history contacts per smaller body (SMC)
-#define max_shear 20
-
 /// @addtogroup multicore_module
 /// @{
 
@@ -212,8 +209,10 @@ struct host_container {
     custom_vector<real3> ct_body_torque;  ///< Total contact torque on these bodies
 
     // Contact shear history (SMC)
-    custom_vector<vec3> shear_neigh;          ///< Neighbor list of contacting bodies and shapes
-    custom_vector<real3> shear_disp;          ///< Accumulated shear displacement for each neighbor
+    // One entry per pair of shapes in contact, rebuilt at each step and sorted by the shape pair key
+    // (larger shape ID in the upper 32 bits, smaller shape ID in the lower 32 bits).
+    custom_vector<long long> shear_pairs;     ///< Sorted keys of the shape pairs with contact history
+    custom_vector<real3> shear_disp;          ///< Accumulated shear displacement, per contact pair
     custom_vector<real> contact_relvel_init;  ///< Initial relative normal velocity manitude per contact pair
     custom_vector<real> contact_duration;     ///< Accumulated contact duration, per contact pair
 
@@ -358,6 +357,10 @@ class CH_MULTICORE_API ChMulticoreDataManager {
 
     /// Flag indicating whether or not the contact forces are current (NSC only).
     bool Fc_current;
+    /// Flag indicating whether or not host_data.M_invD is assembled (NSC only).
+    /// In mixed-precision mode, M_invD is only kept in single precision during the solve (see ChShurProduct::Setup);
+    /// the products with M_invD are then evaluated as M_inv * (D * x).
+    bool M_invD_current;
     /// Container for all timers for the system.
     ChTimerMulticore system_timer;
     /// Container for all settings for the system, collision detection, and solver.
@@ -40,6 +40,9 @@ class collision_measures {
         number_of_contacts_possible = 0;
         number_of_bins_active = 0;
         number_of_bin_intersections = 0;
+        number_of_moving_shapes = 0;
+        broadphase_time_static = 0;
+        broadphase_time_moving = 0;
 
         rigid_min_bounding_point = real3(0);
         rigid_max_bounding_point = real3(0);
@@ -61,6 +64,9 @@ class collision_measures {
     uint number_of_bins_active;        ///< Number of active bins (containing 1+ AABBs)
     uint number_of_bin_intersections;  ///< Number of AABB bin intersections
     uint number_of_contacts_possible;  ///< Number of contacts possible from broadphase
+    uint number_of_moving_shapes;      ///< Number of shapes processed as moving by the broadphase
+    double broadphase_time_static;     ///< Broadphase time spent on static shapes (incremental broadphase only)
+    double broadphase_time_moving;     ///< Broadphase time spent on moving shapes
 
     real3 rigid_min_bounding_point;
     real3 rigid_max_bounding_point;
@@ -43,7 +43,11 @@ class collision_settings {
           bin_size(real3(1, 1, 1)),
           grid_density(5),
           broadphase_grid(collision::ChBroadphase::GridType::FIXED_RESOLUTION),
-          narrowphase_algorithm(collision::ChNarrowphase::Algorithm::HYBRID) {}
+          broadphase_incremental(false),
+          broadphase_hybrid(false),
+          broadphase_hybrid_max_bins(64),
+          narrowphase_algorithm(collision::ChNarrowphase::Algorithm::HYBRID),
+          narrowphase_batched(false) {}
 
     /// For stability of NSC contact, the envelope should be set to 5-10% of the smallest collision shape size (too
     /// large a value will slow down the narrowphase collision detection). The envelope is the amount by which each
@@ -79,11 +83,29 @@ class collision_settings {
     /// `broadphase_grid` type is set to FIXED_DENSITY.
     real grid_density;
 
+    /// Use the incremental broadphase (default: false).
+    /// Recommended for scenes where most shapes do not move from one step to the next. See
+    /// ChBroadphase::SetIncremental.
+    bool broadphase_incremental;
+
+    /// Use the hybrid grid / AABB-tree broadphase (default: false).
+    /// Recommended for scenes with widely varying shape sizes. Shapes whose AABB overlaps more than
+    /// `broadphase_hybrid_max_bins` grid bins are stored in an AABB tree instead of the grid. See
+    /// ChBroadphase::SetHybrid.
+    bool broadphase_hybrid;
+
+    /// Maximum number of grid bins overlapped by a shape stored in the grid (hybrid broadphase only).
+    uint broadphase_hybrid_max_bins;
+
     /// Algorithm for narrowphase collision detection phase.
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     collision::ChNarrowphase::Algorithm narrowphase_algorithm;
+
+    /// Use the batched narrowphase for sphere-sphere, box-sphere, and box-box pairs (default: false).
+    /// Only used with the PRIMS and HYBRID narrowphase algorithms. See ChNarrowphase::SetBatched.
+    bool narrowphase_batched;
 };
 
 /// Chrono::Multicore solver_settings.
@@ -102,6 +124,8 @@ class solver_settings {
         bilateral_clamp_speed = .6;
         clamp_bilaterals = true;
         compute_N = false;
+        matrix_free = false;
+        mixed_precision = false;
         use_full_inertia_tensor = true;
         max_iteration = 100;
         max_iteration_normal = 0;
@@ -161,6 +185,19 @@ class solver_settings {
     /// Experimental options that probably don't work for all solvers.
     bool update_rhs;
     bool compute_N;
+    /// Evaluate the products with the rigid contact Jacobian matrix-free (default: false).
+    /// If enabled, the rigid contact blocks of D_T, D, and M_invD are not assembled; the Schur complement product and
+    /// the velocity updates are computed directly from the contact frames and the body inverse mass and inertia.
+    /// Bilateral and 3-DOF constraints are still assembled. Ignored by the Jacobi and Gauss-Seidel solvers, which
+    /// require the explicit Schur complement matrix.
+    bool matrix_free;
+    /// Evaluate the Schur complement products of the APGD and BB solvers in single precision (default: false).
+    /// If enabled, single-precision copies of the solver matrices are made once per step and used in all solver
+    /// iterations, halving the memory traffic of the Schur products. The double-precision Nshur (see compute_N) is then
+    /// not assembled, and the double-precision M_invD is released during the solve. The solver iterates, projections,
+    /// residuals, and the resulting impulses remain in double precision. Ignored by the other solvers, in matrix-free
+    /// mode, and if Chrono::Multicore is built in single precision.
+    bool mixed_precision;
     bool test_objective;
     bool use_full_inertia_tensor;
     bool cache_step_length;
@@ -18,11 +18,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <iostream>
 #include <string>
 
 #include "chrono/core/ChTimer.h"
+#include "chrono/parallel/ChOpenMP.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include "chrono_multicore/ChMulticoreDefines.h"
 #include "chrono/multicore_math/ChMulticoreMath.h"
@@ -32,9 +35,116 @@ namespace chrono {
 /// @addtogroup multicore_module
 /// @{
 
+/// Controller of the number of OpenMP threads used in one phase of the simulation step.
+/// Candidate thread counts (min_threads, 2*min_threads, ..., max_threads) are tried in increasing order, each for a
+/// window of calls. The sweep stops as soon as additional threads no longer reduce the average phase time, and the
+/// phase then runs with the fastest count found. The sweep is repeated periodically, so that the choice follows
+/// changes in the problem size and in the load of the node.
+struct ThreadControl {
+    ThreadControl()
+        : enabled(false),
+          pinned(false),
+          exploring(false),
+          min_threads(1),
+          max_threads(1),
+          threads(0),
+          best_threads(0),
+          base_time(0),
+          best_time(0),
+          speedup(1),
+          calls(0),
+          windows(0),
+          accum(0) {}
+
+    /// Enable automatic selection of the thread count in the range [nmin, nmax].
+    void Enable(int nmin, int nmax) {
+        enabled = true;
+        pinned = false;
+        min_threads = std::max(nmin, 1);
+        max_threads = std::max(nmax, min_threads);
+        Restart();
+    }
+
+    /// Use a fixed thread count (disables automatic selection).
+    void Pin(int nthreads) {
+        enabled = false;
+        pinned = true;
+        threads = nthreads;
+        best_threads = nthreads;
+    }
+
+    /// Return true if the thread count of this phase is controlled (automatically or pinned).
+    bool IsActive() const { return (enabled || pinned) && threads > 0; }
+
+    /// Register the duration of one call of the phase and adjust the thread count at the end of each window.
+    void Sample(double time) {
+        if (!enabled)
+            return;
+        accum += time;
+        if (++calls < window)
+            return;
+
+        double avg = accum / calls;
+        accum = 0;
+        calls = 0;
+
+        if (!exploring) {
+            if (++windows >= retune)
+                Restart();
+            return;
+        }
+
+        if (threads == min_threads) {
+            base_time = avg;
+            best_time = avg;
+            best_threads = threads;
+        } else if (avg < best_time) {
+            best_time = avg;
+            best_threads = threads;
+        }
+
+        // Keep adding threads while the phase speeds up
+        if (best_threads == threads && threads < max_threads) {
+            threads = std::min(2 * threads, max_threads);
+            return;
+        }
+
+        exploring = false;
+        threads = best_threads;
+        speedup = best_time > 0 ? base_time / best_time : 1;
+    }
+
+    static const int window = 10;  ///< number of calls averaged in one measurement
+    static const int retune = 50;  ///< number of windows between successive sweeps
+
+    bool enabled;      ///< automatic selection of the thread count
+    bool pinned;       ///< fixed thread count set by the user
+    bool exploring;    ///< a sweep over the candidate thread counts is in progress
+    int min_threads;   ///< smallest candidate thread count
+    int max_threads;   ///< largest candidate thread count
+    int threads;       ///< thread count used for the next call of the phase
+    int best_threads;  ///< fastest thread count of the last sweep
+    double base_time;  ///< average phase time with min_threads (last sweep)
+    double best_time;  ///< average phase time with best_threads (last sweep)
+    double speedup;    ///< measured speedup of best_threads relative to min_threads
+
+  private:
+    void Restart() {
+        exploring = true;
+        threads = min_threads;
+        calls = 0;
+        windows = 0;
+        accum = 0;
+    }
+
+    int calls;
+    int windows;
+    double accum;
+};
+
 /// Wrapper class for a timer object.
 struct TimerData {
-    TimerData() : runs(0) {}
+    TimerData() : runs(0), trace_name(nullptr), trace_start(-1), call_start(0), prev_threads(0) {}
 
     void Reset() {
         runs = 0;
@@ -52,6 +162,12 @@ struct TimerData {
 
     ChTimer<double> timer;
     int runs;
+    const char* trace_name;  ///< name of the trace spans recorded for this timer
+    int64_t trace_start;     ///< start time of the current trace span (if trace profiling is enabled)
+
+    ThreadControl control;  ///< controller of the number of threads used while this timer runs
+    double call_start;      ///< accumulated time at the start of the current call
+    int prev_threads;       ///< number of threads to restore when this timer stops
 };
 
 /// Utility class for managing a collection of timer objects.
@@ -72,9 +188,39 @@ class CH_MULTICORE_API ChTimerMulticore {
         }
     }
 
-    void start(const std::string& name) { timer_list.at(name).start(); }
+    void start(const std::string& name) {
+        auto& timer = timer_list.at(name);
+        if (timer.control.IsActive()) {
+            timer.call_start = timer.timer();
+            timer.prev_threads = ChOMP::GetMaxThreads();
+            ChOMP::SetNumThreads(timer.control.threads);
+        }
+        timer.start();
+#ifdef CHRONO_TRACE_PROFILER
+        if (utils::ChTraceProfiler::IsEnabled()) {
+            if (!timer.trace_name)
+                timer.trace_name = utils::ChTraceProfiler::Intern(name);
+            timer.trace_start = utils::ChTraceProfiler::Now();
+        }
+#endif
+    }
 
-    void stop(const std::string& name) { timer_list.at(name).stop(); }
+    void stop(const std::string& name) {
+        auto& timer = timer_list.at(name);
+        timer.stop();
+        if (timer.control.IsActive()) {
+            ChOMP::SetNumThreads(timer.prev_threads);
+            timer.control.Sample(timer.timer() - timer.call_start);
+        }
+#ifdef CHRONO_TRACE_PROFILER
+        // Also record a trace span
+        if (timer.trace_start >= 0) {
+            utils::ChTraceProfiler::Record(timer.trace_name, "multicore", timer.trace_start,
+                                           utils::ChTraceProfiler::Now());
+            timer.trace_start = -1;
+        }
+#endif
+    }
 
     // Returns the time associated with a specific timer
     double GetTime(const std::string& name) const {
@@ -92,11 +238,48 @@ class CH_MULTICORE_API ChTimerMulticore {
         return timer_list.at(name).runs;
     }
 
+    // Enable automatic selection of the number of threads used while the specified timer runs
+    void EnableThreadControl(const std::string& name, int min_threads, int max_threads) {
+        if (timer_list.count(name) == 0) {
+            return;
+        }
+        timer_list.at(name).control.Enable(min_threads, max_threads);
+    }
+
+    // Use a fixed number of threads while the specified timer runs (e.g., the best count found by the controller)
+    void SetThreads(const std::string& name, int num_threads) {
+        if (timer_list.count(name) == 0) {
+            return;
+        }
+        timer_list.at(name).control.Pin(num_threads);
+    }
+
+    // Returns the number of threads currently used for a specific timer (0 if not controlled)
+    int GetThreads(const std::string& name) const {
+        if (timer_list.count(name) == 0 || !timer_list.at(name).control.IsActive()) {
+            return 0;
+        }
+        return timer_list.at(name).control.threads;
+    }
+
+    // Returns the measured speedup of the selected number of threads relative to the minimum number of threads
+    double GetSpeedup(const std::string& name) const {
+        if (timer_list.count(name) == 0) {
+            return 1;
+        }
+        return timer_list.at(name).control.speedup;
+    }
+
     void PrintReport() const {
         std::cout << "Timer Report:" << std::endl;
         std::cout << "------------" << std::endl;
         for (auto& timer : timer_list) {
-            std::cout << "Name:\t" << timer.first << "\t" << timer.second.timer() << "\n";
+            std::cout << "Name:\t" << timer.first << "\t" << timer.second.timer();
+            if (timer.second.control.IsActive()) {
+                std::cout << "\tthreads: " << timer.second.control.threads
+                          << "\tspeedup: " << timer.second.control.speedup;
+            }
+            std::cout << "\n";
         }
         std::cout << "------------" << std::endl;
     }
@@ -75,7 +75,25 @@ void ChCollisionSystemChronoMulticore::PreProcess() {
     broadphase.grid_resolution = settings.bins_per_axis;
     broadphase.bin_size = settings.bin_size;
     broadphase.grid_density = settings.grid_density;
+    if (broadphase.IsIncremental() != settings.broadphase_incremental)
+        broadphase.SetIncremental(settings.broadphase_incremental);
+    if (broadphase.IsHybrid() != settings.broadphase_hybrid)
+        broadphase.SetHybrid(settings.broadphase_hybrid, settings.broadphase_hybrid_max_bins);
+    broadphase.hybrid_max_bins = settings.broadphase_hybrid_max_bins;
     narrowphase.algorithm = settings.narrowphase_algorithm;
+    narrowphase.SetBatched(settings.narrowphase_batched);
+}
+
+void ChCollisionSystemChronoMulticore::Run() {
+    ResetTimers();
+
+    data_manager->system_timer.start("collision_broad");
+    RunBroadphase();
+    data_manager->system_timer.stop("collision_broad");
+
+    data_manager->system_timer.start("collision_narrow");
+    RunNarrowphase();
+    data_manager->system_timer.stop("collision_narrow");
 }
 
 void ChCollisionSystemChronoMulticore::PostProcess() {
@@ -90,6 +108,9 @@ void ChCollisionSystemChronoMulticore::PostProcess() {
     measures.number_of_bins_active = cd_data->num_active_bins;
     measures.number_of_bin_intersections = cd_data->num_bin_aabb_intersections;
     measures.number_of_contacts_possible = cd_data->num_possible_collisions;
+    measures.number_of_moving_shapes = broadphase.GetNumMovingShapes();
+    measures.broadphase_time_static = broadphase.GetTimerStatic();
+    measures.broadphase_time_moving = broadphase.GetTimerMoving();
 
     measures.rigid_min_bounding_point = cd_data->rigid_min_bounding_point;
     measures.rigid_max_bounding_point = cd_data->rigid_max_bounding_point;
@@ -49,6 +49,11 @@ class CH_MULTICORE_API ChCollisionSystemChronoMulticore : public ChCollisionSyst
     /// information (in the Chrono::Multicore data manager).
     virtual void PreProcess() override;
 
+    /// Run the algorithm and finds all the contacts.
+    /// Different from the base class function, this override times the broadphase and narrowphase with the
+    /// "collision_broad" and "collision_narrow" timers of the multicore system (which also apply their thread counts).
+    virtual void Run() override;
+
     /// Synchronization operations, invoked after running the collision detection.
     virtual void PostProcess() override;
 
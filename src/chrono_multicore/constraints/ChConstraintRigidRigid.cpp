@@ -19,6 +19,8 @@
 #include <algorithm>
 #include <limits>
 
+#include "chrono/physics/ChBody.h"
+
 #include "chrono_multicore/ChConfigMulticore.h"
 #include "chrono_multicore/constraints/ChConstraintRigidRigid.h"
 #include "chrono_multicore/constraints/ChConstraintUtils.h"
@@ -30,7 +32,7 @@ using namespace chrono;
 // -----------------------------------------------------------------------------
 
 ChConstraintRigidRigid::ChConstraintRigidRigid()
-    : data_manager(nullptr), offset(3), inv_h(0), inv_hpa(0), inv_hhpa(0) {}
+    : data_manager(nullptr), offset(3), inv_h(0), inv_hpa(0), inv_hhpa(0), matrix_free(false) {}
 
 void ChConstraintRigidRigid::func_Project_normal(int index, const vec2* ids, const real* cohesion, real* gamma) {
     const auto num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
@@ -183,6 +185,11 @@ void ChConstraintRigidRigid::Setup(ChMulticoreDataManager* dm) {
     inv_hpa = 1 / (data_manager->settings.step_size + data_manager->settings.solver.alpha);
     inv_hhpa = inv_h * inv_hpa;
 
+    // The Jacobi and Gauss-Seidel solvers work on the explicit Schur complement matrix
+    SolverType solver_type = data_manager->settings.solver.solver_type;
+    matrix_free = data_manager->settings.solver.matrix_free && solver_type != SolverType::JACOBI &&
+                  solver_type != SolverType::GAUSS_SEIDEL;
+
     if (num_rigid_contacts <= 0) {
         return;
     }
@@ -221,6 +228,10 @@ void ChConstraintRigidRigid::Setup(ChMulticoreDataManager* dm) {
             quat_b[i] = quaternion_conjugate;
         }
     }
+
+    if (matrix_free) {
+        SetupMatrixFree();
+    }
 }
 
 void ChConstraintRigidRigid::Project(real* gamma) {
@@ -323,9 +334,28 @@ void ChConstraintRigidRigid::Build_s() {
     const DynamicVector<real>& M_invk = data_manager->host_data.M_invk;
     const DynamicVector<real>& gamma = data_manager->host_data.gamma;
 
-    const CompressedMatrix<real, blaze::columnMajor>& M_invD = data_manager->host_data.M_invD;
+    if (data_manager->M_invD_current) {
+        const CompressedMatrix<real, blaze::columnMajor>& M_invD = data_manager->host_data.M_invD;
+        v_new = M_invk + M_invD * gamma;
+    } else {
+        DynamicVector<real> D_gamma = data_manager->host_data.D * gamma;
+        v_new = M_invk + data_manager->host_data.M_inv * D_gamma;
+    }
 
-    v_new = M_invk + M_invD * gamma;
+    if (matrix_free) {
+        MinvDx(gamma, v_new, data_manager->settings.solver.solver_mode);
+        DynamicVector<real> D_t_T_v(data_manager->num_constraints, 0);
+        D_Tx(v_new, D_t_T_v, SolverMode::SLIDING);
+
+#pragma omp parallel for
+        for (int index = 0; index < (signed)num_rigid_contacts; index++) {
+            real fric = data_manager->host_data.fric_rigid_rigid[index].x;
+            real s_v = D_t_T_v[num_rigid_contacts + index * 2 + 0];
+            real s_w = D_t_T_v[num_rigid_contacts + index * 2 + 1];
+            data_manager->host_data.s[index * 1 + 0] = sqrt(s_v * s_v + s_w * s_w) * fric;
+        }
+        return;
+    }
 
 #pragma omp parallel for
     for (int index = 0; index < (signed)num_rigid_contacts; index++) {
@@ -398,6 +428,10 @@ void ChConstraintRigidRigid::Build_E() {
 
 void ChConstraintRigidRigid::Build_D() {
     LOG(INFO) << "ChConstraintRigidRigid::Build_D";
+    if (matrix_free) {
+        return;
+    }
+
     const auto num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
     real3* norm = data_manager->cd_data->norm_rigid_rigid.data();
     vec2* ids = data_manager->cd_data->bids_rigid_rigid.data();
@@ -477,6 +511,14 @@ void ChConstraintRigidRigid::GenerateSparsity() {
 
     CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
 
+    // In matrix-free mode, only finalize the (empty) contact rows
+    if (matrix_free) {
+        for (uint row = 0; row < data_manager->num_unilaterals; row++) {
+            D_T.finalize(row);
+        }
+        return;
+    }
+
     const vec2* ids = data_manager->cd_data->bids_rigid_rigid.data();
 
     for (int index = 0; index < (signed)num_rigid_contacts; index++) {
@@ -546,152 +588,232 @@ void ChConstraintRigidRigid::GenerateSparsity() {
     }
 }
 
-void ChConstraintRigidRigid::Dx(const DynamicVector<real>& gam, DynamicVector<real>& XYZUVW) {
+// -----------------------------------------------------------------------------
+// Matrix-free evaluation of the products with the rigid contact Jacobian
+
+void ChConstraintRigidRigid::SetupMatrixFree() {
     const auto num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
-    real3* norm = data_manager->cd_data->norm_rigid_rigid.data();
-    ////custom_vector<char>& active_rigid = data_manager->host_data.active_rigid;
-    ////vec2* bids_rigid_rigid = data_manager->host_data.bids_rigid_rigid.data();
+    const auto num_rigid_bodies = data_manager->num_rigid_bodies;
+    const real3* norm = data_manager->cd_data->norm_rigid_rigid.data();
+    bool spinning = data_manager->settings.solver.solver_mode == SolverMode::SPINNING;
+
+    jac_basis.resize(3 * num_rigid_contacts);
+    jac_ang_a.resize(3 * num_rigid_contacts);
+    jac_ang_b.resize(3 * num_rigid_contacts);
+    jac_spin_a.resize(spinning ? 3 * num_rigid_contacts : 0);
+    jac_spin_b.resize(spinning ? 3 * num_rigid_contacts : 0);
 
+    // Contact frames and rotational Jacobian blocks (same entries as in Build_D)
 #pragma omp parallel for
     for (int i = 0; i < (signed)num_rigid_contacts; i++) {
-        const real3& U = real3(norm[i]);
+        const real3& U = norm[i];
         real3 V, W;
         Orthogonalize(U, V, W);
-        ////int id_a = bids_rigid_rigid[i].x;
-        ////int id_b = bids_rigid_rigid[i].y;
-
-        real3 T3, T4, T5, T6, T7, T8;
-        real3 g = real3(gam[i], gam[num_rigid_contacts + i * 2 + 0], gam[num_rigid_contacts + i * 2 + 1]);
-        {
-            const real3_int& sbar = rotated_point_a[i];
-            const quaternion& q_a = quat_a[i];
-            T3 = Cross(Rotate(U, q_a), sbar.v);
-            T4 = Cross(Rotate(V, q_a), sbar.v);
-            T5 = Cross(Rotate(W, q_a), sbar.v);
-
-            ////if (active_rigid[id_a] != 0)
-
-            real3 res = -U * g.x - V * g.y - W * g.z;
-
-#pragma omp atomic
-            XYZUVW[sbar.i * 6 + 0] += res.x;
-#pragma omp atomic
-            XYZUVW[sbar.i * 6 + 1] += res.y;
-#pragma omp atomic
-            XYZUVW[sbar.i * 6 + 2] += res.z;
-
-            res = T3 * g.x + T4 * g.y + T5 * g.z;
-
-#pragma omp atomic
-            XYZUVW[sbar.i * 6 + 3] += res.x;
-#pragma omp atomic
-            XYZUVW[sbar.i * 6 + 4] += res.y;
-#pragma omp atomic
-            XYZUVW[sbar.i * 6 + 5] += res.z;
-        }
-
-        {
-            const real3_int& sbar = rotated_point_b[i];
-            const quaternion& q_b = quat_b[i];
-            T6 = Cross(Rotate(U, q_b), sbar.v);
-            T7 = Cross(Rotate(V, q_b), sbar.v);
-            T8 = Cross(Rotate(W, q_b), sbar.v);
-
-            // if (active_rigid[id_b] != 0)
-
-            real3 res = U * g.x + V * g.y + W * g.z;
-
-#pragma omp atomic
-            XYZUVW[sbar.i * 6 + 0] += res.x;
-#pragma omp atomic
-            XYZUVW[sbar.i * 6 + 1] += res.y;
-#pragma omp atomic
-            XYZUVW[sbar.i * 6 + 2] += res.z;
-
-            res = -T6 * g.x - T7 * g.y - T8 * g.z;
-
-#pragma omp atomic
-            XYZUVW[sbar.i * 6 + 3] += res.x;
-#pragma omp atomic
-            XYZUVW[sbar.i * 6 + 4] += res.y;
-#pragma omp atomic
-            XYZUVW[sbar.i * 6 + 5] += res.z;
+        jac_basis[3 * i + 0] = U;
+        jac_basis[3 * i + 1] = V;
+        jac_basis[3 * i + 2] = W;
+
+        const real3_int& sbar_a = rotated_point_a[i];
+        const real3_int& sbar_b = rotated_point_b[i];
+        real3 U_A = Rotate(U, quat_a[i]);
+        real3 V_A = Rotate(V, quat_a[i]);
+        real3 W_A = Rotate(W, quat_a[i]);
+        real3 U_B = Rotate(U, quat_b[i]);
+        real3 V_B = Rotate(V, quat_b[i]);
+        real3 W_B = Rotate(W, quat_b[i]);
+
+        jac_ang_a[3 * i + 0] = Cross(U_A, sbar_a.v);
+        jac_ang_a[3 * i + 1] = Cross(V_A, sbar_a.v);
+        jac_ang_a[3 * i + 2] = Cross(W_A, sbar_a.v);
+        jac_ang_b[3 * i + 0] = Cross(U_B, sbar_b.v);
+        jac_ang_b[3 * i + 1] = Cross(V_B, sbar_b.v);
+        jac_ang_b[3 * i + 2] = Cross(W_B, sbar_b.v);
+
+        if (spinning) {
+            jac_spin_a[3 * i + 0] = U_A;
+            jac_spin_a[3 * i + 1] = V_A;
+            jac_spin_a[3 * i + 2] = W_A;
+            jac_spin_b[3 * i + 0] = U_B;
+            jac_spin_b[3 * i + 1] = V_B;
+            jac_spin_b[3 * i + 2] = W_B;
         }
     }
-}
 
-void ChConstraintRigidRigid::D_Tx(const DynamicVector<real>& XYZUVW, DynamicVector<real>& out_vector) {
-    const auto num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
-    real3* norm = data_manager->cd_data->norm_rigid_rigid.data();
-    ////custom_vector<char>& active_rigid = data_manager->host_data.active_rigid;
-    ////real3* ptA = data_manager->cd_data->cpta_rigid_rigid.data();
-    ////real3* ptB = data_manager->cd_data->cptb_rigid_rigid.data();
-    ////vec2* bids_rigid_rigid = data_manager->cd_data->bids_rigid_rigid.data();
-    ////real3* pos = data_manager->host_data.pos_rigid.data();
-    ////quaternion* rot = data_manager->host_data.rot_rigid.data();
+    // Inverse masses and inertias (same entries as in M_inv)
+    std::vector<std::shared_ptr<ChBody>>* body_list = data_manager->body_list;
+    bool use_full_inertia_tensor = data_manager->settings.solver.use_full_inertia_tensor;
+    inv_mass.resize(num_rigid_bodies);
+    inv_inertia.resize(3 * num_rigid_bodies);
 
 #pragma omp parallel for
-    for (int i = 0; i < (signed)num_rigid_contacts; i++) {
-        const real3& U = real3(norm[i]);
-        real3 V, W;
-        Orthogonalize(U, V, W);
-        real temp[3] = {0, 0, 0};
-
-        ////real3 pA = ptA[i];
-        ////int id_a = bids_rigid_rigid[i].x;
-        ////if (active_rigid[id_a] != 0)
-        {
-            const real3_int& sbar = rotated_point_a[i];
-            const quaternion& quaternion_conjugate = quat_a[i];
-
-            real3 XYZ(XYZUVW[sbar.i * 6 + 0], XYZUVW[sbar.i * 6 + 1], XYZUVW[sbar.i * 6 + 2]);
-            real3 UVW(XYZUVW[sbar.i * 6 + 3], XYZUVW[sbar.i * 6 + 4], XYZUVW[sbar.i * 6 + 5]);
+    for (int i = 0; i < (signed)num_rigid_bodies; i++) {
+        if (data_manager->host_data.active_rigid[i]) {
+            const ChMatrix33<>& body_inv_inr = body_list->at(i)->GetInvInertia();
+            inv_mass[i] = 1.0 / body_list->at(i)->GetMass();
+            if (use_full_inertia_tensor) {
+                inv_inertia[3 * i + 0] = real3(body_inv_inr(0, 0), body_inv_inr(0, 1), body_inv_inr(0, 2));
+                inv_inertia[3 * i + 1] = real3(body_inv_inr(1, 0), body_inv_inr(1, 1), body_inv_inr(1, 2));
+                inv_inertia[3 * i + 2] = real3(body_inv_inr(2, 0), body_inv_inr(2, 1), body_inv_inr(2, 2));
+            } else {
+                inv_inertia[3 * i + 0] = real3(body_inv_inr(0, 0), 0, 0);
+                inv_inertia[3 * i + 1] = real3(0, body_inv_inr(1, 1), 0);
+                inv_inertia[3 * i + 2] = real3(0, 0, body_inv_inr(2, 2));
+            }
+        } else {
+            inv_mass[i] = 0;
+            inv_inertia[3 * i + 0] = real3(0);
+            inv_inertia[3 * i + 1] = real3(0);
+            inv_inertia[3 * i + 2] = real3(0);
+        }
+    }
 
-            real3 T1 = Cross(Rotate(U, quaternion_conjugate), sbar.v);
-            real3 T2 = Cross(Rotate(V, quaternion_conjugate), sbar.v);
-            real3 T3 = Cross(Rotate(W, quaternion_conjugate), sbar.v);
+    // List of contacts for each body, so that D*x can be accumulated per body without atomics.
+    // The lists are filled sequentially, which keeps the summation order deterministic.
+    body_contact_start.assign(num_rigid_bodies + 1, 0);
+    for (uint i = 0; i < num_rigid_contacts; i++) {
+        body_contact_start[rotated_point_a[i].i + 1]++;
+        body_contact_start[rotated_point_b[i].i + 1]++;
+    }
+    for (uint b = 0; b < num_rigid_bodies; b++) {
+        body_contact_start[b + 1] += body_contact_start[b];
+    }
+    body_contact.resize(2 * num_rigid_contacts);
+    std::vector<uint> fill(body_contact_start.begin(), body_contact_start.end() - 1);
+    for (uint i = 0; i < num_rigid_contacts; i++) {
+        body_contact[fill[rotated_point_a[i].i]++] = 2 * i + 0;
+        body_contact[fill[rotated_point_b[i].i]++] = 2 * i + 1;
+    }
+}
 
-            temp[0] = Dot(XYZ, -U) + Dot(UVW, T1);
-            temp[1] = Dot(XYZ, -V) + Dot(UVW, T2);
-            temp[2] = Dot(XYZ, -W) + Dot(UVW, T3);
+size_t ChConstraintRigidRigid::GetMatrixFreeMemory() const {
+    if (!matrix_free)
+        return 0;
+    size_t n_real3 = jac_basis.size() + jac_ang_a.size() + jac_ang_b.size() + jac_spin_a.size() + jac_spin_b.size() +
+                     inv_inertia.size();
+    return n_real3 * sizeof(real3) + inv_mass.size() * sizeof(real) +
+           (body_contact_start.size() + body_contact.size()) * sizeof(uint);
+}
 
-            ////Jacobian<false>(rot[id_a], U, V, W, ptA[i] - pos[id_a], &XYZUVW[id_a * 6 + 0], temp);
+void ChConstraintRigidRigid::BodyForce(int body,
+                                       const DynamicVector<real>& x,
+                                       SolverMode mode,
+                                       real3& force,
+                                       real3& torque) const {
+    const auto num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
+    bool sliding = mode == SolverMode::SLIDING || mode == SolverMode::SPINNING;
+    bool spinning = mode == SolverMode::SPINNING;
+
+    force = real3(0);
+    torque = real3(0);
+    for (uint k = body_contact_start[body]; k < body_contact_start[body + 1]; k++) {
+        uint i = body_contact[k] / 2;
+        bool on_b = (body_contact[k] % 2) != 0;
+
+        real3 g(x[i], 0, 0);
+        if (sliding) {
+            g.y = x[num_rigid_contacts + i * 2 + 0];
+            g.z = x[num_rigid_contacts + i * 2 + 1];
         }
 
-        ////real3 pB = ptB[i];
-        ////int id_b = bids_rigid_rigid[i].y;
-        ////if (active_rigid[id_b] != 0)
-        {
-            const real3_int& sbar = rotated_point_b[i];
-            const quaternion& quaternion_conjugate = quat_b[i];
+        const real3* B = &jac_basis[3 * i];
+        const real3* T = on_b ? &jac_ang_b[3 * i] : &jac_ang_a[3 * i];
+        real3 lin = B[0] * g.x + B[1] * g.y + B[2] * g.z;
+        real3 ang = T[0] * g.x + T[1] * g.y + T[2] * g.z;
+        if (spinning) {
+            const real3* S = on_b ? &jac_spin_b[3 * i] : &jac_spin_a[3 * i];
+            ang -= S[0] * x[3 * num_rigid_contacts + i * 3 + 0] + S[1] * x[3 * num_rigid_contacts + i * 3 + 1] +
+                   S[2] * x[3 * num_rigid_contacts + i * 3 + 2];
+        }
 
-            real3 XYZ(XYZUVW[sbar.i * 6 + 0], XYZUVW[sbar.i * 6 + 1], XYZUVW[sbar.i * 6 + 2]);
-            real3 UVW(XYZUVW[sbar.i * 6 + 3], XYZUVW[sbar.i * 6 + 4], XYZUVW[sbar.i * 6 + 5]);
+        // Body A rows: (-U, T), spinning (0, -U_A). Body B rows: (U, -T), spinning (0, U_B).
+        if (on_b) {
+            force += lin;
+            torque -= ang;
+        } else {
+            force -= lin;
+            torque += ang;
+        }
+    }
+}
 
-            real3 T1 = Cross(Rotate(U, quaternion_conjugate), sbar.v);
-            real3 T2 = Cross(Rotate(V, quaternion_conjugate), sbar.v);
-            real3 T3 = Cross(Rotate(W, quaternion_conjugate), sbar.v);
+void ChConstraintRigidRigid::Dx(const DynamicVector<real>& x, DynamicVector<real>& output, SolverMode mode) {
+    const auto num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
+    const auto num_rigid_bodies = data_manager->num_rigid_bodies;
+    if (!matrix_free || num_rigid_contacts <= 0 || mode == SolverMode::BILATERAL) {
+        return;
+    }
 
-            temp[0] += Dot(XYZ, U) + Dot(UVW, -T1);
-            temp[1] += Dot(XYZ, V) + Dot(UVW, -T2);
-            temp[2] += Dot(XYZ, W) + Dot(UVW, -T3);
-        }
+#pragma omp parallel for
+    for (int b = 0; b < (signed)num_rigid_bodies; b++) {
+        if (body_contact_start[b] == body_contact_start[b + 1])
+            continue;
+        real3 force, torque;
+        BodyForce(b, x, mode, force, torque);
+        output[b * 6 + 0] += force.x;
+        output[b * 6 + 1] += force.y;
+        output[b * 6 + 2] += force.z;
+        output[b * 6 + 3] += torque.x;
+        output[b * 6 + 4] += torque.y;
+        output[b * 6 + 5] += torque.z;
+    }
+}
 
-        out_vector[i] = temp[0];
-        out_vector[num_rigid_contacts + i * 2 + 0] = temp[1];
-        out_vector[num_rigid_contacts + i * 2 + 1] = temp[2];
+void ChConstraintRigidRigid::MinvDx(const DynamicVector<real>& x, DynamicVector<real>& output, SolverMode mode) {
+    const auto num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
+    const auto num_rigid_bodies = data_manager->num_rigid_bodies;
+    if (!matrix_free || num_rigid_contacts <= 0 || mode == SolverMode::BILATERAL) {
+        return;
+    }
 
-        //            out_vector[CONTACT + 3] = temp[3];
-        //            out_vector[CONTACT + 4] = temp[4];
-        //            out_vector[CONTACT + 5] = temp[5];
+#pragma omp parallel for
+    for (int b = 0; b < (signed)num_rigid_bodies; b++) {
+        if (inv_mass[b] == 0 || body_contact_start[b] == body_contact_start[b + 1])
+            continue;
+        real3 force, torque;
+        BodyForce(b, x, mode, force, torque);
+        force *= inv_mass[b];
+        output[b * 6 + 0] += force.x;
+        output[b * 6 + 1] += force.y;
+        output[b * 6 + 2] += force.z;
+        output[b * 6 + 3] += Dot(inv_inertia[3 * b + 0], torque);
+        output[b * 6 + 4] += Dot(inv_inertia[3 * b + 1], torque);
+        output[b * 6 + 5] += Dot(inv_inertia[3 * b + 2], torque);
     }
+}
 
-    //    // data_manager->PrintMatrix(data_manager->host_data.D);
+void ChConstraintRigidRigid::D_Tx(const DynamicVector<real>& x, DynamicVector<real>& output, SolverMode mode) {
+    const auto num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
+    if (!matrix_free || num_rigid_contacts <= 0 || mode == SolverMode::BILATERAL) {
+        return;
+    }
+    bool sliding = mode == SolverMode::SLIDING || mode == SolverMode::SPINNING;
+    bool spinning = mode == SolverMode::SPINNING;
 
-    //    DynamicVector<real> compare =
-    //            data_manager->host_data.D_T * data_manager->host_data.D * data_manager->host_data.gamma;
-    //    std::cout << "nconstr " << compare.size() << std::endl;
-    //    for (int i = 0; i < compare.size(); i++) {
-    //        std::cout << compare[i] << " " << out_vector[i] << std::endl;
-    //    }
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_rigid_contacts; i++) {
+        int a = rotated_point_a[i].i;
+        int b = rotated_point_b[i].i;
+        real3 v_a(x[a * 6 + 0], x[a * 6 + 1], x[a * 6 + 2]);
+        real3 w_a(x[a * 6 + 3], x[a * 6 + 4], x[a * 6 + 5]);
+        real3 v_b(x[b * 6 + 0], x[b * 6 + 1], x[b * 6 + 2]);
+        real3 w_b(x[b * 6 + 3], x[b * 6 + 4], x[b * 6 + 5]);
+        real3 dv = v_b - v_a;
+
+        const real3* B = &jac_basis[3 * i];
+        const real3* T_a = &jac_ang_a[3 * i];
+        const real3* T_b = &jac_ang_b[3 * i];
+
+        output[i] = Dot(B[0], dv) + Dot(T_a[0], w_a) - Dot(T_b[0], w_b);
+        if (sliding) {
+            output[num_rigid_contacts + i * 2 + 0] = Dot(B[1], dv) + Dot(T_a[1], w_a) - Dot(T_b[1], w_b);
+            output[num_rigid_contacts + i * 2 + 1] = Dot(B[2], dv) + Dot(T_a[2], w_a) - Dot(T_b[2], w_b);
+        }
+        if (spinning) {
+            const real3* S_a = &jac_spin_a[3 * i];
+            const real3* S_b = &jac_spin_b[3 * i];
+            output[3 * num_rigid_contacts + i * 3 + 0] = Dot(S_b[0], w_b) - Dot(S_a[0], w_a);
+            output[3 * num_rigid_contacts + i * 3 + 1] = Dot(S_b[1], w_b) - Dot(S_a[1], w_a);
+            output[3 * num_rigid_contacts + i * 3 + 2] = Dot(S_b[2], w_b) - Dot(S_a[2], w_a);
+        }
+    }
 }
@@ -40,8 +40,24 @@ class CH_MULTICORE_API ChConstraintRigidRigid {
     void func_Project_normal(int index, const vec2* ids, const real* cohesion, real* gam);
     void func_Project_sliding(int index, const vec2* ids, const real3* fric, const real* cohesion, real* gam);
     void func_Project_spinning(int index, const vec2* ids, const real3* fric, real* gam);
-    void Dx(const DynamicVector<real>& x, DynamicVector<real>& output);
-    void D_Tx(const DynamicVector<real>& x, DynamicVector<real>& output);
+
+    /// Return true if products with the rigid contact Jacobian are evaluated matrix-free in the current step.
+    /// In this case, the contact rows of D_T (and the contact columns of D and M_invD) are left empty.
+    /// See solver_settings::matrix_free.
+    bool IsMatrixFree() const { return matrix_free; }
+
+    /// Accumulate output += D_c * x, with D_c the contact columns of D.
+    /// Only the contact rows active in the given solver mode are used. No-op if not in matrix-free mode.
+    void Dx(const DynamicVector<real>& x, DynamicVector<real>& output, SolverMode mode);
+    /// Accumulate output += M_inv * D_c * x, with D_c the contact columns of D.
+    /// Only the contact rows active in the given solver mode are used. No-op if not in matrix-free mode.
+    void MinvDx(const DynamicVector<real>& x, DynamicVector<real>& output, SolverMode mode);
+    /// Set the contact rows of the output vector to D_c^T * x, with D_c the contact columns of D.
+    /// Only the contact rows active in the given solver mode are set. No-op if not in matrix-free mode.
+    void D_Tx(const DynamicVector<real>& x, DynamicVector<real>& output, SolverMode mode);
+
+    /// Return the memory (in bytes) used by the matrix-free contact data.
+    size_t GetMatrixFreeMemory() const;
 
     /// Compute the vector of corrections.
     void Build_b();
@@ -58,6 +74,13 @@ class CH_MULTICORE_API ChConstraintRigidRigid {
     int offset;
 
   protected:
+    /// Cache the contact Jacobian blocks, the body inverse masses, and the body-to-contact adjacency.
+    void SetupMatrixFree();
+
+    /// Sum the generalized forces (force and torque in body frame) exerted by all contacts of the given body for the
+    /// contact impulses x.
+    void BodyForce(int body, const DynamicVector<real>& x, SolverMode mode, real3& force, real3& torque) const;
+
     custom_vector<bool2> contact_active_pairs;
 
     real inv_h;     ///< reciprocal of time step, 1/h
@@ -67,6 +90,17 @@ class CH_MULTICORE_API ChConstraintRigidRigid {
     custom_vector<real3_int> rotated_point_a, rotated_point_b;
     custom_vector<quaternion> quat_a, quat_b;
 
+    bool matrix_free;                         ///< matrix-free evaluation of the contact Jacobian products
+    custom_vector<real3> jac_basis;           ///< contact frames (U, V, W), 3 per contact
+    custom_vector<real3> jac_ang_a;           ///< rotational Jacobian blocks on body A (normal, sliding), 3 per contact
+    custom_vector<real3> jac_ang_b;           ///< rotational Jacobian blocks on body B (normal, sliding), 3 per contact
+    custom_vector<real3> jac_spin_a;          ///< contact frames in body A frame (rolling, spinning), 3 per contact
+    custom_vector<real3> jac_spin_b;          ///< contact frames in body B frame (rolling, spinning), 3 per contact
+    custom_vector<real> inv_mass;             ///< inverse body masses (zero for inactive bodies)
+    custom_vector<real3> inv_inertia;         ///< rows of the inverse body inertias, 3 per body
+    custom_vector<uint> body_contact_start;   ///< start of the contact list of each body
+    custom_vector<uint> body_contact;         ///< contact lists (2 * contact index + 1 for body B)
+
     ChMulticoreDataManager* data_manager;  ///< Pointer to the system's data manager
 };
 
@@ -878,6 +878,21 @@ void ChSystemMulticore::EnableThreadTuning(int min_threads, int max_threads) {
 #endif
 }
 
+void ChSystemMulticore::EnablePhaseThreadTuning(int min_threads, int max_threads) {
+#ifdef _OPENMP
+    data_manager->settings.perform_thread_tuning = false;
+    data_manager->settings.min_threads = min_threads;
+    data_manager->settings.max_threads = max_threads;
+    auto& timer = data_manager->system_timer;
+    timer.EnableThreadControl("collision_broad", min_threads, max_threads);
+    timer.EnableThreadControl("collision_narrow", min_threads, max_threads);
+    timer.EnableThreadControl("ChIterativeSolverMulticoreSMC_ProcessContact", min_threads, max_threads);
+    timer.EnableThreadControl("ChIterativeSolverMulticore_Solve", min_threads, max_threads);
+#else
+    std::cout << "WARNING! OpenMP not enabled" << std::endl;
+#endif
+}
+
 // -------------------------------------------------------------
 
 void ChSystemMulticore::SetMaterialCompositionStrategy(std::unique_ptr<ChMaterialCompositionStrategy>&& strategy) {
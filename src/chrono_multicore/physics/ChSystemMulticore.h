@@ -175,6 +175,15 @@ class CH_MULTICORE_API ChSystemMulticore : public ChSystem {
     /// The initial number of threads is set to min_threads.
     void EnableThreadTuning(int min_threads, int max_threads);
 
+    /// Enable separate dynamic adjustment of the number of threads, between the specified limits, for the broadphase,
+    /// the narrowphase, the SMC contact force calculation, and the solver.
+    /// Each phase measures its own scaling and runs with its fastest thread count; all other operations use the number
+    /// of threads set through SetNumThreads. This disables the global thread tuning (see EnableThreadTuning).
+    /// The selected thread counts and the measured speedups are available through the system timer (see
+    /// ChTimerMulticore::GetThreads and ChTimerMulticore::GetSpeedup) and can be fixed with
+    /// ChTimerMulticore::SetThreads.
+    void EnablePhaseThreadTuning(int min_threads, int max_threads);
+
     // Based on the specified logging level and the state of that level, enable or disable logging level.
     void SetLoggingLevel(LoggingLevel level, bool state = true);
 
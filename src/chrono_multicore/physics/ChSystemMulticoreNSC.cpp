@@ -117,7 +117,11 @@ void ChSystemMulticoreNSC::CalculateContactForces() {
 
     const SubMatrixType& D_u = blaze::submatrix(data_manager->host_data.D, 0, 0, num_rigid_dof, num_unilaterals);
     DynamicVector<real> gamma_u = blaze::subvector(data_manager->host_data.gamma, 0, num_unilaterals);
-    Fc = D_u * gamma_u / data_manager->settings.step_size;
+    Fc = D_u * gamma_u;
+    if (data_manager->rigid_rigid->IsMatrixFree()) {
+        data_manager->rigid_rigid->Dx(data_manager->host_data.gamma, Fc, data_manager->settings.solver.solver_mode);
+    }
+    Fc /= data_manager->settings.step_size;
 }
 
 real3 ChSystemMulticoreNSC::GetBodyContactForce(uint body_id) const {
@@ -116,8 +116,17 @@ class CH_MULTICORE_API ChIterativeSolverMulticoreSMC : public ChIterativeSolverM
     void host_CalcContactForces(custom_vector<int>& ct_bid,
                                 custom_vector<real3>& ct_force,
                                 custom_vector<real3>& ct_torque,
-                                custom_vector<vec2>& shape_pairs,
-                                custom_vector<char>& shear_touch);
+                                custom_vector<int>& shear_hist,
+                                custom_vector<char>& shear_touch,
+                                custom_vector<real3>& shear_disp,
+                                custom_vector<real>& relvel_init,
+                                custom_vector<real>& duration);
+
+    void host_UpdateShearHistory(custom_vector<long long>& shear_keys,
+                                 const custom_vector<char>& shear_touch,
+                                 const custom_vector<real3>& shear_disp,
+                                 const custom_vector<real>& relvel_init,
+                                 const custom_vector<real>& duration);
 
     void host_AddContactForces(uint ct_body_count, const custom_vector<int>& ct_body_id);
 
@@ -93,13 +93,15 @@ void ChIterativeSolverMulticoreNSC::RunTimeStep() {
 
     if (data_manager->num_constraints > 0) {
         // Rhs should be updated with latest velocity after presolve
-        data_manager->host_data.R_full =
-            -data_manager->host_data.b -
-            data_manager->host_data.D_T *
-                (data_manager->host_data.v + data_manager->host_data.M_inv * data_manager->host_data.hf);
+        DynamicVector<real> v_k = data_manager->host_data.v + data_manager->host_data.M_inv * data_manager->host_data.hf;
+        DynamicVector<real>& R_full = data_manager->host_data.R_full;
+        R_full = data_manager->host_data.D_T * v_k;
+        data_manager->rigid_rigid->D_Tx(v_k, R_full, data_manager->settings.solver.solver_mode);
+        R_full = -data_manager->host_data.b - R_full;
     }
-    ShurProductFull.Setup(data_manager);
+    // The bilateral Schur matrix is set up first, since M_invD may be released in mixed-precision mode
     ShurProductBilateral.Setup(data_manager);
+    ShurProductFull.Setup(data_manager);
     ProjectFull.Setup(data_manager);
 
     PerformStabilization();
@@ -245,6 +247,11 @@ void ChIterativeSolverMulticoreNSC::ComputeD() {
             break;
     }
 
+    // In matrix-free mode, the rigid contact rows are left empty
+    if (data_manager->rigid_rigid->IsMatrixFree()) {
+        nnz_total = nnz_bilaterals + nnz_fluid_fluid;
+    }
+
     CLEAR_RESERVE_RESIZE(D_T, nnz_total, num_rows, num_dof)
     CLEAR_RESERVE_RESIZE(M_invD, nnz_total, num_dof, num_rows)
 
@@ -267,6 +274,7 @@ void ChIterativeSolverMulticoreNSC::ComputeD() {
     LOG(INFO) << "ChIterativeSolverMulticoreNSC::ComputeD - M_inv * D";
 
     data_manager->host_data.M_invD = M_inv * data_manager->host_data.D;
+    data_manager->M_invD_current = true;
 
     data_manager->system_timer.stop("ChIterativeSolverMulticore_D");
 }
@@ -316,7 +324,7 @@ void ChIterativeSolverMulticoreNSC::ComputeR() {
 }
 
 void ChIterativeSolverMulticoreNSC::ComputeN() {
-    if (data_manager->settings.solver.compute_N == false) {
+    if (data_manager->settings.solver.compute_N == false || data_manager->rigid_rigid->IsMatrixFree()) {
         return;
     }
 
@@ -324,7 +332,12 @@ void ChIterativeSolverMulticoreNSC::ComputeN() {
     data_manager->system_timer.start("ChIterativeSolverMulticore_N");
     const CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
     CompressedMatrix<real>& Nshur = data_manager->host_data.Nshur;
-    Nshur = D_T * data_manager->host_data.M_invD;
+    if (ChShurProduct::UseMixedPrecision(data_manager)) {
+        // Only the single-precision Nshur is used (see ChShurProduct::Setup)
+        Nshur = CompressedMatrix<real>();
+    } else {
+        Nshur = D_T * data_manager->host_data.M_invD;
+    }
     data_manager->system_timer.stop("ChIterativeSolverMulticore_N");
 }
 
@@ -391,7 +404,13 @@ void ChIterativeSolverMulticoreNSC::ComputeImpulses() {
 
     if (data_manager->num_constraints > 0) {
         // Compute new velocity based on the lagrange multipliers
-        v = v + M_inv * hf + data_manager->host_data.M_invD * gamma;
+        if (data_manager->M_invD_current) {
+            v = v + M_inv * hf + data_manager->host_data.M_invD * gamma;
+        } else {
+            DynamicVector<real> D_gamma = data_manager->host_data.D * gamma;
+            v = v + M_inv * (hf + D_gamma);
+        }
+        data_manager->rigid_rigid->MinvDx(gamma, v, data_manager->settings.solver.solver_mode);
     } else {
         // When there are no constraints we need to still apply gravity and other
         // body forces!
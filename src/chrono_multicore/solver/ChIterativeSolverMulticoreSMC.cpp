@@ -29,13 +29,16 @@
 //// case. Is there a solution?
 
 #include <algorithm>
+#include <limits>
 #include <stdexcept>
 
 #include "chrono/physics/ChSystemSMC.h"
 #include "chrono/physics/ChMaterialSurfaceSMC.h"
 #include "chrono_multicore/solver/ChIterativeSolverMulticore.h"
 
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
+#include <thrust/unique.h>
 
 #if defined _WIN32
     #include <cstdint>
@@ -53,7 +56,6 @@ using namespace chrono;
 void function_CalcContactForces(
     int index,                                            // index of this contact pair
     vec2* body_pairs,                                     // indices of the body pair in contact
-    vec2* shape_pairs,                                    // indices of the shape pair in contact
     ChSystemSMC::ContactForceModel contact_model,         // contact force model
     ChSystemSMC::AdhesionForceModel adhesion_model,       // adhesion force model
     ChSystemSMC::TangentialDisplacementModel displ_mode,  // type of tangential displacement history
@@ -77,11 +79,14 @@ void function_CalcContactForces(
     real3* normal,                                        // contact normal (per contact)
     real* depth,                                          // penetration depth (per contact)
     real* eff_radius,                                     // effective contact radius (per contact)
-    vec3* shear_neigh,                                    // neighbor list of contacting bodies and shapes (per body)
-    char* shear_touch,                                    // flag if contact in neighbor list is persistent (per body)
-    real3* shear_disp,                                    // accumulated shear displacement for each neighbor (per body)
-    real* contact_relvel_init,                            // initial relative normal velocity per contact pair
-    real* contact_duration,                               // duration of persistent contact between contact pairs
+    int* shear_hist,                                      // index in contact history table, -1 if none (per contact)
+    real3* shear_disp,                                    // accumulated shear displacement (per history entry)
+    real* contact_relvel_init,                            // initial relative normal velocity (per history entry)
+    real* contact_duration,                               // duration of persistent contact (per history entry)
+    char* ct_touch,                                       // [output] flag if contact is persistent (per contact)
+    real3* ct_shear_disp,                                 // [output] accumulated shear displacement (per contact)
+    real* ct_relvel_init,                                 // [output] initial relative normal velocity (per contact)
+    real* ct_duration,                                    // [output] duration of persistent contact (per contact)
     int* ct_bid,                                          // [output] body IDs (two per contact)
     real3* ct_force,                                      // [output] body force (two per contact)
     real3* ct_torque                                      // [output] body torque (two per contact)
@@ -172,78 +177,48 @@ void function_CalcContactForces(
     real delta_n = -depth[index];
     real3 delta_t = real3(0);
 
-    int i;
-    int contact_id = -1;
     int shear_body1 = -1;
-    int shear_body2;
-    int shear_shape1;
-    int shear_shape2;
-    bool newcontact = true;
 
     if (displ_mode == ChSystemSMC::TangentialDisplacementModel::OneStep) {
         delta_t = relvel_t * dT;
     } else if (displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
         delta_t = relvel_t * dT;
 
-        // Identify the two shapes in contact (global shape IDs).
-        int s1 = shape_pairs[index].x;
-        int s2 = shape_pairs[index].y;
-
-        // Contact history information stored on the body with the smaller shape or else the body with larger index.
-        // Currently, it is assumed that the smaller shape is on the body with larger ID. We call this body shear_body1.
+        // Contact history information is expressed relative to the body with larger index. We call this body
+        // shear_body1.
         shear_body1 = std::max(b1, b2);
-        shear_body2 = std::min(b1, b2);
-        shear_shape1 = std::max(s1, s2);
-        shear_shape2 = std::min(s1, s2);
-
-        // Check if contact history already exists. If not, initialize new contact history.
-        for (i = 0; i < max_shear; i++) {
-            int ctIdUnrolled = max_shear * shear_body1 + i;
-            if (shear_neigh[ctIdUnrolled].x == shear_body2 && shear_neigh[ctIdUnrolled].y == shear_shape1 &&
-                shear_neigh[ctIdUnrolled].z == shear_shape2) {
-                contact_duration[ctIdUnrolled] += dT;
-                contact_id = i;
-                newcontact = false;
-                break;
-            }
-        }
-        if (newcontact == true) {
-            for (i = 0; i < max_shear; i++) {
-                int ctIdUnrolled = max_shear * shear_body1 + i;
-                if (shear_neigh[ctIdUnrolled].x == -1) {
-                    contact_id = i;
-                    shear_neigh[ctIdUnrolled].x = shear_body2;
-                    shear_neigh[ctIdUnrolled].y = shear_shape1;
-                    shear_neigh[ctIdUnrolled].z = shear_shape2;
-                    shear_disp[ctIdUnrolled].x = 0;
-                    shear_disp[ctIdUnrolled].y = 0;
-                    shear_disp[ctIdUnrolled].z = 0;
-                    contact_relvel_init[ctIdUnrolled] = relvel_init;
-                    contact_duration[ctIdUnrolled] = 0;
-                    break;
-                }
-            }
+
+        // Load the contact history from the previous step, if it exists. If not, initialize new contact history.
+        int hist = shear_hist[index];
+        real3 disp(0);
+        if (hist >= 0) {
+            disp = shear_disp[hist];
+            ct_relvel_init[index] = contact_relvel_init[hist];
+            ct_duration[index] = contact_duration[hist] + dT;
+        } else {
+            ct_relvel_init[index] = relvel_init;
+            ct_duration[index] = 0;
         }
 
-        // Record that these two bodies are really in contact at this time.
-        int ctSaveId = max_shear * shear_body1 + contact_id;
-        shear_touch[ctSaveId] = true;
+        // Record that these two shapes are really in contact at this time.
+        ct_touch[index] = true;
 
-        // Increment stored contact history tangential (shear) displacement vector and project it onto the current
+        // Increment the contact history tangential (shear) displacement vector and project it onto the current
         // contact plane.
         if (shear_body1 == b1) {
-            shear_disp[ctSaveId] += delta_t;
-            shear_disp[ctSaveId] -= Dot(shear_disp[ctSaveId], normal[index]) * normal[index];
-            delta_t = shear_disp[ctSaveId];
+            disp += delta_t;
+            disp -= Dot(disp, normal[index]) * normal[index];
+            delta_t = disp;
         } else {
-            shear_disp[ctSaveId] -= delta_t;
-            shear_disp[ctSaveId] -= Dot(shear_disp[ctSaveId], normal[index]) * normal[index];
-            delta_t = -shear_disp[ctSaveId];
+            disp -= delta_t;
+            disp -= Dot(disp, normal[index]) * normal[index];
+            delta_t = -disp;
         }
+        ct_shear_disp[index] = disp;
 
         // Load the initial collision velocity and accumulated contact duration from the contact history.
-        relvel_init = (contact_relvel_init[ctSaveId] < char_vel) ? char_vel : contact_relvel_init[ctSaveId];
-        t_contact = contact_duration[ctSaveId];
+        relvel_init = (ct_relvel_init[index] < char_vel) ? char_vel : ct_relvel_init[index];
+        t_contact = ct_duration[index];
     }
 
     auto eps = std::numeric_limits<double>::epsilon();
@@ -458,9 +433,9 @@ void function_CalcContactForces(
             if (displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
                 delta_t = (forceT - forceT_damp) / kt;
                 if (shear_body1 == b1) {
-                    shear_disp[max_shear * shear_body1 + contact_id] = delta_t;
+                    ct_shear_disp[index] = delta_t;
                 } else {
-                    shear_disp[max_shear * shear_body1 + contact_id] = -delta_t;
+                    ct_shear_disp[index] = -delta_t;
                 }
             }
         } else {
@@ -555,14 +530,16 @@ void function_CalcContactForces(
 void ChIterativeSolverMulticoreSMC::host_CalcContactForces(custom_vector<int>& ct_bid,
                                                            custom_vector<real3>& ct_force,
                                                            custom_vector<real3>& ct_torque,
-                                                           custom_vector<vec2>& shape_pairs,
-                                                           custom_vector<char>& shear_touch) {
+                                                           custom_vector<int>& shear_hist,
+                                                           custom_vector<char>& shear_touch,
+                                                           custom_vector<real3>& shear_disp,
+                                                           custom_vector<real>& relvel_init,
+                                                           custom_vector<real>& duration) {
 #pragma omp parallel for
     for (int index = 0; index < (signed)data_manager->cd_data->num_rigid_contacts; index++) {
         function_CalcContactForces(
             index,                                                  // index of this contact pair
             data_manager->cd_data->bids_rigid_rigid.data(),         // indices of the body pair in contact
-            shape_pairs.data(),                                     // indices of the shape pair in contact
             data_manager->settings.solver.contact_force_model,      // contact force model
             data_manager->settings.solver.adhesion_force_model,     // adhesion force model
             data_manager->settings.solver.tangential_displ_mode,    // type of tangential displacement history
@@ -586,11 +563,14 @@ void ChIterativeSolverMulticoreSMC::host_CalcContactForces(custom_vector<int>& c
             data_manager->cd_data->norm_rigid_rigid.data(),         // contact normal (per contact)
             data_manager->cd_data->dpth_rigid_rigid.data(),         // penetration depth (per contact)
             data_manager->cd_data->erad_rigid_rigid.data(),         // effective contact radius (per contact)
-            data_manager->host_data.shear_neigh.data(),  // neighbor list of contacting bodies and shapes (per body)
-            shear_touch.data(),                          // flag if contact in neighbor list is persistent (per body)
-            data_manager->host_data.shear_disp.data(),   // accumulated shear displacement for each neighbor (per body)
-            data_manager->host_data.contact_relvel_init.data(),  // initial relative normal velocity per contact pair
-            data_manager->host_data.contact_duration.data(),     // duration of persistent contact between contact pairs
+            shear_hist.data(),                                   // index in contact history table (per contact)
+            data_manager->host_data.shear_disp.data(),           // accumulated shear displacement (per history entry)
+            data_manager->host_data.contact_relvel_init.data(),  // initial relative normal velocity (per history entry)
+            data_manager->host_data.contact_duration.data(),     // duration of persistent contact (per history entry)
+            shear_touch.data(),                                  // [output] flag if contact is persistent
+            shear_disp.data(),                                   // [output] accumulated shear displacement
+            relvel_init.data(),                                  // [output] initial relative normal velocity
+            duration.data(),                                     // [output] duration of persistent contact
             ct_bid.data(),                                       // [output] body IDs (two per contact)
             ct_force.data(),                                     // [output] body force (two per contact)
             ct_torque.data()                                     // [output] body torque (two per contact)
@@ -633,6 +613,51 @@ void ChIterativeSolverMulticoreSMC::host_SetContactForcesMap(uint ct_body_count,
     }
 }
 
+// -----------------------------------------------------------------------------
+// Rebuild the contact history table from the persistent contacts of the current
+// step. The table holds one entry per shape pair in contact, sorted by the
+// shape pair key, so its size is proportional to the number of contacts. If a
+// shape pair has more than one contact, the history of its first contact is kept.
+// -----------------------------------------------------------------------------
+void ChIterativeSolverMulticoreSMC::host_UpdateShearHistory(custom_vector<long long>& shear_keys,
+                                                            const custom_vector<char>& shear_touch,
+                                                            const custom_vector<real3>& shear_disp,
+                                                            const custom_vector<real>& relvel_init,
+                                                            const custom_vector<real>& duration) {
+    const long long no_key = std::numeric_limits<long long>::max();
+    const auto num_keys = shear_keys.size();
+
+    // Move contacts without history to the end of the sorted list
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_keys; i++) {
+        if (!shear_touch[i])
+            shear_keys[i] = no_key;
+    }
+
+    custom_vector<int> ids(num_keys);
+    Thrust_Sequence(ids);
+    thrust::stable_sort_by_key(THRUST_PAR shear_keys.begin(), shear_keys.end(), ids.begin());
+    auto end = thrust::unique_by_key(THRUST_PAR shear_keys.begin(), shear_keys.end(), ids.begin());
+    size_t num_entries = end.first - shear_keys.begin();
+    if (num_entries > 0 && shear_keys[num_entries - 1] == no_key)
+        num_entries--;
+
+    custom_vector<long long>& shear_pairs = data_manager->host_data.shear_pairs;
+    shear_pairs.resize(num_entries);
+    data_manager->host_data.shear_disp.resize(num_entries);
+    data_manager->host_data.contact_relvel_init.resize(num_entries);
+    data_manager->host_data.contact_duration.resize(num_entries);
+
+#pragma omp parallel for
+    for (int k = 0; k < (signed)num_entries; k++) {
+        int i = ids[k];
+        shear_pairs[k] = shear_keys[k];
+        data_manager->host_data.shear_disp[k] = shear_disp[i];
+        data_manager->host_data.contact_relvel_init[k] = relvel_init[i];
+        data_manager->host_data.contact_duration[k] = duration[i];
+    }
+}
+
 // Binary operation for adding two-object tuples
 struct sum_tuples {
     thrust::tuple<real3, real3> operator()(const thrust::tuple<real3, real3>& a,
@@ -659,22 +684,36 @@ void ChIterativeSolverMulticoreSMC::ProcessContacts() {
     custom_vector<real3> ct_force(2 * num_rigid_contacts);
     custom_vector<real3> ct_torque(2 * num_rigid_contacts);
 
-    // Set up additional vectors for multi-step tangential model
-    custom_vector<vec2> shape_pairs;
+    // Set up additional vectors for multi-step tangential model.
+    // For each contact, find the contact history entry (if any) of its shape pair from the previous step.
+    custom_vector<long long> shear_keys;
+    custom_vector<int> shear_hist;
     custom_vector<char> shear_touch;
+    custom_vector<real3> shear_disp;
+    custom_vector<real> relvel_init;
+    custom_vector<real> duration;
     if (data_manager->settings.solver.tangential_displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
-        shape_pairs.resize(num_rigid_contacts);
-        shear_touch.resize(max_shear * data_manager->num_rigid_bodies);
+        shear_keys.resize(num_rigid_contacts);
+        shear_hist.resize(num_rigid_contacts);
+        shear_touch.resize(num_rigid_contacts);
+        shear_disp.resize(num_rigid_contacts);
+        relvel_init.resize(num_rigid_contacts);
+        duration.resize(num_rigid_contacts);
         Thrust_Fill(shear_touch, false);
+
+        const custom_vector<long long>& shear_pairs = data_manager->host_data.shear_pairs;
 #pragma omp parallel for
         for (int i = 0; i < (signed)num_rigid_contacts; i++) {
-            vec2 pair = I2(int(data_manager->cd_data->contact_shapeIDs[i] >> 32),
-                           int(data_manager->cd_data->contact_shapeIDs[i] & 0xffffffff));
-            shape_pairs[i] = pair;
+            int s1 = int(data_manager->cd_data->contact_shapeIDs[i] >> 32);
+            int s2 = int(data_manager->cd_data->contact_shapeIDs[i] & 0xffffffff);
+            long long key = ((long long)std::max(s1, s2) << 32) | (long long)std::min(s1, s2);
+            auto it = std::lower_bound(shear_pairs.begin(), shear_pairs.end(), key);
+            shear_keys[i] = key;
+            shear_hist[i] = (it != shear_pairs.end() && *it == key) ? int(it - shear_pairs.begin()) : -1;
         }
     }
 
-    host_CalcContactForces(ct_bid, ct_force, ct_torque, shape_pairs, shear_touch);
+    host_CalcContactForces(ct_bid, ct_force, ct_torque, shear_hist, shear_touch, shear_disp, relvel_init, duration);
 
     data_manager->host_data.ct_force.resize(2 * num_rigid_contacts);
     data_manager->host_data.ct_torque.resize(2 * num_rigid_contacts);
@@ -682,13 +721,7 @@ void ChIterativeSolverMulticoreSMC::ProcessContacts() {
     thrust::copy(THRUST_PAR ct_torque.begin(), ct_torque.end(), data_manager->host_data.ct_torque.begin());
 
     if (data_manager->settings.solver.tangential_displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
-#pragma omp parallel for
-        for (int index = 0; index < (signed)data_manager->num_rigid_bodies; index++) {
-            for (int i = 0; i < max_shear; i++) {
-                if (shear_touch[max_shear * index + i] == false)
-                    data_manager->host_data.shear_neigh[max_shear * index + i].x = -1;
-            }
-        }
+        host_UpdateShearHistory(shear_keys, shear_touch, shear_disp, relvel_init, duration);
     }
 
     // 2. Calculate contact forces and torques - per body basis
@@ -16,9 +16,53 @@
 
 using namespace chrono;
 
-ChShurProduct::ChShurProduct() {
+ChShurProduct::ChShurProduct() : mixed_precision(false) {
     data_manager = 0;
 }
+
+bool ChShurProduct::UseMixedPrecision(ChMulticoreDataManager* data_manager) {
+    const auto& settings = data_manager->settings.solver;
+    return settings.mixed_precision && sizeof(real) > sizeof(float) &&
+           (settings.solver_type == SolverType::APGD || settings.solver_type == SolverType::BB) &&
+           !data_manager->rigid_rigid->IsMatrixFree() && data_manager->num_constraints > 0;
+}
+
+void ChShurProduct::Setup(ChMulticoreDataManager* data_container_) {
+    data_manager = data_container_;
+
+    mixed_precision = UseMixedPrecision(data_manager);
+    if (!mixed_precision) {
+        D_T_f.clear();
+        M_invD_f.clear();
+        Nshur_f.clear();
+        E_f.clear();
+        return;
+    }
+
+    // The single-precision matrices are built once per step and then reused in all solver iterations
+    const auto& settings = data_manager->settings.solver;
+    auto& host_data = data_manager->host_data;
+    if (settings.compute_N) {
+        // The double-precision Nshur is not assembled in mixed-precision mode (see ComputeN)
+        Nshur_f = host_data.D_T * host_data.M_invD;
+        D_T_f.clear();
+        M_invD_f.clear();
+    } else {
+        D_T_f = host_data.D_T;
+        M_invD_f = host_data.M_invD;
+        Nshur_f.clear();
+
+        // Release the double-precision M_invD, unless the solve is split in sub-problems which use its sub-blocks.
+        // The remaining products with M_invD (velocity updates) are evaluated as M_inv * (D * x).
+        bool staged = (settings.solver_mode != SolverMode::NORMAL && settings.max_iteration_normal > 0) ||
+                      (settings.solver_mode == SolverMode::SPINNING && settings.max_iteration_sliding > 0);
+        if (!staged) {
+            host_data.M_invD = CompressedMatrix<real>();
+            data_manager->M_invD_current = false;
+        }
+    }
+    E_f = host_data.E;
+}
 void ChShurProduct::operator()(const DynamicVector<real>& x, DynamicVector<real>& output) {
     data_manager->system_timer.start("ShurProduct");
 
@@ -32,7 +76,12 @@ void ChShurProduct::operator()(const DynamicVector<real>& x, DynamicVector<real>
     const CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
     const CompressedMatrix<real>& Nshur = data_manager->host_data.Nshur;
 
-    if (data_manager->settings.solver.local_solver_mode == data_manager->settings.solver.solver_mode) {
+    if (data_manager->rigid_rigid->IsMatrixFree()) {
+        MatrixFreeProduct(x, output);
+    } else if (mixed_precision &&
+               data_manager->settings.solver.local_solver_mode == data_manager->settings.solver.solver_mode) {
+        MixedPrecisionProduct(x, output);
+    } else if (data_manager->settings.solver.local_solver_mode == data_manager->settings.solver.solver_mode) {
         if (data_manager->settings.solver.compute_N) {
             output = Nshur * x + E * x;
         } else {
@@ -103,8 +152,87 @@ void ChShurProduct::operator()(const DynamicVector<real>& x, DynamicVector<real>
     data_manager->system_timer.stop("ShurProduct");
 }
 
+void ChShurProduct::NormalContactProduct(const DynamicVector<real>& v, DynamicVector<real>& D_n_T_v) {
+    uint num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
+
+    if (data_manager->rigid_rigid->IsMatrixFree()) {
+        DynamicVector<real> D_T_v(data_manager->num_constraints, 0);
+        data_manager->rigid_rigid->D_Tx(v, D_T_v, SolverMode::NORMAL);
+        D_n_T_v = subvector(D_T_v, 0, num_rigid_contacts);
+    } else {
+        const SubMatrixType& D_n_T = _DNT_;
+        D_n_T_v = D_n_T * v;
+    }
+}
+
+// The contact rows of D_T (and contact columns of M_invD) are empty in matrix-free mode, so the assembled products
+// only account for the bilateral (and 3-DOF) constraints. The contact contributions are added by the rigid contact
+// constraint, directly from the contact frames and the body inverse masses.
+void ChShurProduct::MatrixFreeProduct(const DynamicVector<real>& x, DynamicVector<real>& output) {
+    const DynamicVector<real>& E = data_manager->host_data.E;
+    ChConstraintRigidRigid* rigid_rigid = data_manager->rigid_rigid;
+
+    uint num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
+    uint num_unilaterals = data_manager->num_unilaterals;
+    uint num_bilaterals = data_manager->num_bilaterals;
+    SolverMode mode = data_manager->settings.solver.local_solver_mode;
+
+    if (mode == data_manager->settings.solver.solver_mode) {
+        DynamicVector<real> tmp = data_manager->host_data.M_invD * x;
+        rigid_rigid->MinvDx(x, tmp, mode);
+        output = data_manager->host_data.D_T * tmp;
+        rigid_rigid->D_Tx(tmp, output, mode);
+        output += E * x;
+        return;
+    }
+
+    const SubMatrixType& D_b_T = _DBT_;
+    const SubMatrixType& M_invD_b = _MINVDB_;
+
+    SubVectorType o_b = subvector(output, num_unilaterals, num_bilaterals);
+    ConstSubVectorType x_b = subvector(x, num_unilaterals, num_bilaterals);
+    ConstSubVectorType E_b = subvector(E, num_unilaterals, num_bilaterals);
+
+    DynamicVector<real> tmp = M_invD_b * x_b;
+    rigid_rigid->MinvDx(x, tmp, mode);
+    o_b = D_b_T * tmp + E_b * x_b;
+    rigid_rigid->D_Tx(tmp, output, mode);
+
+    switch (mode) {
+        case SolverMode::SPINNING:
+            subvector(output, num_rigid_contacts * 3, num_rigid_contacts * 3) +=
+                subvector(E, num_rigid_contacts * 3, num_rigid_contacts * 3) *
+                subvector(x, num_rigid_contacts * 3, num_rigid_contacts * 3);
+            // fall through
+        case SolverMode::SLIDING:
+            subvector(output, num_rigid_contacts, num_rigid_contacts * 2) +=
+                subvector(E, num_rigid_contacts, num_rigid_contacts * 2) *
+                subvector(x, num_rigid_contacts, num_rigid_contacts * 2);
+            // fall through
+        case SolverMode::NORMAL:
+            subvector(output, 0, num_rigid_contacts) +=
+                subvector(E, 0, num_rigid_contacts) * subvector(x, 0, num_rigid_contacts);
+            break;
+        default:
+            break;
+    }
+}
+
+// Single-precision products with the matrices of all constraints. Only the input and output vectors are converted at
+// each call; the solver iterates, projections, and residuals remain in double precision.
+void ChShurProduct::MixedPrecisionProduct(const DynamicVector<real>& x, DynamicVector<real>& output) {
+    x_f = x;
+    if (data_manager->settings.solver.compute_N) {
+        out_f = Nshur_f * x_f + E_f * x_f;
+    } else {
+        tmp_f = M_invD_f * x_f;
+        out_f = D_T_f * tmp_f + E_f * x_f;
+    }
+    output = out_f;
+}
+
 void ChShurProductBilateral::Setup(ChMulticoreDataManager* data_container_) {
-    ChShurProduct::Setup(data_container_);
+    data_manager = data_container_;
     if (data_manager->num_bilaterals == 0) {
         return;
     }
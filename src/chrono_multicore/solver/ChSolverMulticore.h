@@ -61,12 +61,43 @@ class CH_MULTICORE_API ChShurProduct {
     ChShurProduct();
     virtual ~ChShurProduct() {}
 
-    virtual void Setup(ChMulticoreDataManager* data_container_) { data_manager = data_container_; }
+    /// Set the data manager and, in mixed-precision mode, create single-precision copies of the solver matrices.
+    /// The double-precision matrices duplicated by these copies are not kept: Nshur is not assembled and M_invD is
+    /// released, unless the solve is split in sub-problems (e.g. normal, then sliding) which use its sub-blocks.
+    virtual void Setup(ChMulticoreDataManager* data_container_);
 
     //. Perform the Shur Product.
     virtual void operator()(const DynamicVector<real>& x, DynamicVector<real>& AX);
 
+    /// Compute the normal contact rows of D^T * v, for a vector v of rigid body velocities.
+    /// The product uses the assembled contact Jacobian or, in matrix-free mode, the contact frames.
+    void NormalContactProduct(const DynamicVector<real>& v, DynamicVector<real>& D_n_T_v);
+
+    /// Return true if the Shur products are evaluated in single precision (see solver_settings::mixed_precision).
+    bool IsMixedPrecision() const { return mixed_precision; }
+
+    /// Return true if the Shur products of the current step are to be evaluated in single precision.
+    /// Mixed precision is only used by the APGD and BB solvers, with the assembled solver matrices, and only makes
+    /// sense if the library is built with double precision.
+    static bool UseMixedPrecision(ChMulticoreDataManager* data_manager);
+
     ChMulticoreDataManager* data_manager;  ///< Pointer to the system's data manager
+
+  private:
+    /// Perform the Shur product without the assembled rigid contact Jacobian (see solver_settings::matrix_free).
+    void MatrixFreeProduct(const DynamicVector<real>& x, DynamicVector<real>& AX);
+
+    /// Perform the Shur product with the single-precision copies of the solver matrices.
+    void MixedPrecisionProduct(const DynamicVector<real>& x, DynamicVector<real>& AX);
+
+    bool mixed_precision;              ///< Shur products evaluated in single precision
+    CompressedMatrix<float> D_T_f;     ///< single-precision copy of D_T
+    CompressedMatrix<float> M_invD_f;  ///< single-precision copy of M_invD
+    CompressedMatrix<float> Nshur_f;   ///< single-precision Nshur = D_T * M_invD (if compute_N)
+    DynamicVector<float> E_f;          ///< single-precision copy of E
+    DynamicVector<float> x_f;          ///< single-precision input vector
+    DynamicVector<float> tmp_f;        ///< single-precision intermediate vector (M_invD * x)
+    DynamicVector<float> out_f;        ///< single-precision output vector
 };
 
 /// Functor class for performing the Shur product of the matrix of bilateral constraints.
@@ -173,7 +204,7 @@ class CH_MULTICORE_API ChSolverMulticoreAPGD : public ChSolverMulticore {
                DynamicVector<real>& x         ///< The vector of unknowns
                );
 
-    void UpdateR();
+    void UpdateR(ChShurProduct& ShurProduct);
 
     // APGD specific vectors
     DynamicVector<real> obj2_temp, obj1_temp, temp, g, gamma_new, y, gamma_hat, N_gamma_new, _t_g;
@@ -200,7 +231,7 @@ class CH_MULTICORE_API ChSolverMulticoreBB : public ChSolverMulticore {
                DynamicVector<real>& x         ///< The vector of unknowns
                );
 
-    void UpdateR();
+    void UpdateR(ChShurProduct& ShurProduct);
 
     // BB specific vectors
     DynamicVector<real> temp, ml, mg, mg_p, ml_candidate, ms, my, mdir, ml_p;
@@ -240,7 +271,7 @@ class CH_MULTICORE_API ChSolverMulticoreSPGQP : public ChSolverMulticore {
                DynamicVector<real>& x         ///< The vector of unknowns
                );
 
-    void UpdateR();
+    void UpdateR(ChShurProduct& ShurProduct);
 
     // BB specific vectors
     real alpha, f_max, xi, beta_bar, beta_tilde, beta_k, gam;
@@ -31,8 +31,7 @@ ChSolverMulticoreAPGD::ChSolverMulticoreAPGD()
       L(0),
       g_diff(0) {}
 
-void ChSolverMulticoreAPGD::UpdateR() {
-    const SubMatrixType& D_n_T = _DNT_;
+void ChSolverMulticoreAPGD::UpdateR(ChShurProduct& ShurProduct) {
     const DynamicVector<real>& M_invk = data_manager->host_data.M_invk;
     const DynamicVector<real>& b = data_manager->host_data.b;
     DynamicVector<real>& R = data_manager->host_data.R;
@@ -49,7 +48,9 @@ void ChSolverMulticoreAPGD::UpdateR() {
     SubVectorType R_n = blaze::subvector(R, 0, num_contacts);
     SubVectorType s_n = blaze::subvector(s, 0, num_contacts);
 
-    R_n = -b_n - D_n_T * M_invk + s_n;
+    DynamicVector<real> D_n_T_v;
+    ShurProduct.NormalContactProduct(M_invk, D_n_T_v);
+    R_n = -b_n - D_n_T_v + s_n;
 }
 
 uint ChSolverMulticoreAPGD::Solve(ChShurProduct& ShurProduct,
@@ -212,7 +213,7 @@ uint ChSolverMulticoreAPGD::Solve(ChShurProduct& ShurProduct,
         gamma = gamma_new;
 
         if (data_manager->settings.solver.update_rhs) {
-            UpdateR();
+            UpdateR(ShurProduct);
         }
     }
     if (data_manager->settings.solver.solver_mode == SolverMode::NORMAL) {
@@ -18,8 +18,7 @@ using namespace chrono;
 
 ChSolverMulticoreSPGQP::ChSolverMulticoreSPGQP() : ChSolverMulticore() {}
 
-void ChSolverMulticoreSPGQP::UpdateR() {
-    const SubMatrixType& D_n_T = _DNT_;
+void ChSolverMulticoreSPGQP::UpdateR(ChShurProduct& ShurProduct) {
     const DynamicVector<real>& M_invk = data_manager->host_data.M_invk;
     const DynamicVector<real>& b = data_manager->host_data.b;
     DynamicVector<real>& R = data_manager->host_data.R;
@@ -36,7 +35,9 @@ void ChSolverMulticoreSPGQP::UpdateR() {
     SubVectorType R_n = blaze::subvector(R, 0, num_contacts);
     SubVectorType s_n = blaze::subvector(s, 0, num_contacts);
 
-    R_n = -b_n - D_n_T * M_invk + s_n;
+    DynamicVector<real> D_n_T_v;
+    ShurProduct.NormalContactProduct(M_invk, D_n_T_v);
+    R_n = -b_n - D_n_T_v + s_n;
 }
 
 uint ChSolverMulticoreSPGQP::Solve(ChShurProduct& ShurProduct,
@@ -27,6 +27,16 @@ bool ChSolverPardisoMKL::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverPardisoMKL::AnalyzeMatrix() {
+    m_engine.analyzePattern(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
+bool ChSolverPardisoMKL::FactorizeMatrixNumeric() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverPardisoMKL::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
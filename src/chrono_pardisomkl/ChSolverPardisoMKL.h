@@ -69,6 +69,11 @@ class ChApiPardisoMKL ChSolverPardisoMKL : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Pardiso supports separate symbolic and numeric factorization.
+    virtual bool SupportsSymbolicReuse() const override { return true; }
+    virtual bool AnalyzeMatrix() override;
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
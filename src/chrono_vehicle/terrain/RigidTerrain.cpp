@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <map>
 
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/assets/ChTexture.h"
@@ -49,6 +50,8 @@ RigidTerrain::RigidTerrain(ChSystem* system)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_use_hfield(false),
+      m_hfield_resolution(0.1),
       m_contact_callback(nullptr),
       m_collision_family(14) {}
 
@@ -59,6 +62,8 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_use_hfield(false),
+      m_hfield_resolution(0.1),
       m_contact_callback(nullptr),
       m_collision_family(14) {
     // Open and parse the input file
@@ -525,6 +530,10 @@ void RigidTerrain::Initialize() {
         // and disable collision with other collision models in this family.
         patch->m_body->GetCollisionModel()->SetFamily(m_collision_family);
         patch->m_body->GetCollisionModel()->SetFamilyMaskNoCollisionWithFamily(m_collision_family);
+
+        // If requested, bake the height-field of mesh and height-map patches
+        if (m_use_hfield && patch->m_type != PatchType::BOX)
+            std::static_pointer_cast<MeshPatch>(patch)->BakeHeightField(m_hfield_resolution);
     }
 
     if (!m_friction_fun)
@@ -617,6 +626,19 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector<>& loc, double& height, Ch
 }
 
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const {
+    // Use the baked height-field if available. Fall back on ray casting in grid cells only partially covered by the
+    // mesh surface.
+    if (m_hfield) {
+        ChVector<> loc_iso = ChWorldFrame::ToISO(loc);
+        double x = loc_iso.x();
+        double y = loc_iso.y();
+        if (x < m_hfield->x0 || y < m_hfield->y0 || x > m_hfield->x0 + (m_hfield->nx - 1) * m_hfield->delta ||
+            y > m_hfield->y0 + (m_hfield->ny - 1) * m_hfield->delta)
+            return false;
+        if (m_hfield->Interpolate(x, y, height, normal))
+            return true;
+    }
+
     ChVector<> from = loc + (m_radius + 1000) * ChWorldFrame::Vertical();
     ChVector<> to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
@@ -628,6 +650,200 @@ bool RigidTerrain::MeshPatch::FindPoint(const ChVector<>& loc, double& height, C
     return result.hit;
 }
 
+// -----------------------------------------------------------------------------
+// Baked height-fields for mesh patches
+// -----------------------------------------------------------------------------
+
+void RigidTerrain::EnableHeightFieldCache(bool val, double resolution) {
+    m_use_hfield = val;
+    m_hfield_resolution = resolution;
+}
+
+double RigidTerrain::GetHeightFieldError() const {
+    double error = 0;
+    for (auto patch : m_patches) {
+        if (patch->m_type == PatchType::BOX)
+            continue;
+        auto mpatch = std::static_pointer_cast<MeshPatch>(patch);
+        if (mpatch->m_hfield)
+            error = std::max(error, mpatch->m_hfield->error);
+    }
+    return error;
+}
+
+// Invoke f(k, z) for each node (i, j) of the grid {x0 + i * delta, y0 + j * delta} which lies inside the horizontal
+// projection of the triangle ABC, with k = j * nx + i and z the height of the triangle at that node.
+template <typename F>
+static void RasterizeTriangle(const ChVector<>& A,
+                              const ChVector<>& B,
+                              const ChVector<>& C,
+                              double x0,
+                              double y0,
+                              double delta,
+                              int nx,
+                              int ny,
+                              F f) {
+    const double eps = 1e-9;
+    double det = (B.x() - A.x()) * (C.y() - A.y()) - (C.x() - A.x()) * (B.y() - A.y());
+
+    double xmin = std::min(A.x(), std::min(B.x(), C.x()));
+    double xmax = std::max(A.x(), std::max(B.x(), C.x()));
+    double ymin = std::min(A.y(), std::min(B.y(), C.y()));
+    double ymax = std::max(A.y(), std::max(B.y(), C.y()));
+    int i0 = std::max(0, (int)std::ceil((xmin - x0) / delta - eps));
+    int i1 = std::min(nx - 1, (int)std::floor((xmax - x0) / delta + eps));
+    int j0 = std::max(0, (int)std::ceil((ymin - y0) / delta - eps));
+    int j1 = std::min(ny - 1, (int)std::floor((ymax - y0) / delta + eps));
+
+    for (int j = j0; j <= j1; j++) {
+        double y = y0 + j * delta;
+        for (int i = i0; i <= i1; i++) {
+            double x = x0 + i * delta;
+            // Barycentric coordinates of (x,y) in the projected triangle
+            double u = ((B.x() - x) * (C.y() - y) - (C.x() - x) * (B.y() - y)) / det;
+            double v = ((C.x() - x) * (A.y() - y) - (A.x() - x) * (C.y() - y)) / det;
+            double w = 1 - u - v;
+            if (u < -eps || v < -eps || w < -eps)
+                continue;
+            f(j * nx + i, u * A.z() + v * B.z() + w * C.z());
+        }
+    }
+}
+
+void RigidTerrain::MeshPatch::BakeHeightField(double resolution) {
+    const auto& vertices = m_trimesh->getCoordsVertices();
+    const auto& faces = m_trimesh->getIndicesVertexes();
+    if (faces.empty())
+        return;
+
+    // Mesh vertices in absolute frame, expressed in the ISO frame
+    std::vector<ChVector<>> verts(vertices.size());
+    ChVector<> vmin(+std::numeric_limits<double>::max());
+    ChVector<> vmax(-std::numeric_limits<double>::max());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        verts[i] = ChWorldFrame::ToISO(m_body->TransformPointLocalToParent(vertices[i]));
+        for (int d = 0; d < 3; d++) {
+            vmin[d] = std::min(vmin[d], verts[i][d]);
+            vmax[d] = std::max(vmax[d], verts[i][d]);
+        }
+    }
+
+    // Grid covering the horizontal bounding box of the mesh
+    auto hf = std::unique_ptr<HeightField>(new HeightField);
+    hf->delta = resolution;
+    hf->x0 = vmin.x();
+    hf->y0 = vmin.y();
+    hf->nx = std::max(2, (int)std::ceil((vmax.x() - vmin.x()) / resolution) + 1);
+    hf->ny = std::max(2, (int)std::ceil((vmax.y() - vmin.y()) / resolution) + 1);
+    hf->height.assign(hf->nx * hf->ny, std::numeric_limits<double>::lowest());
+    hf->normal.assign(hf->nx * hf->ny, ChWorldFrame::Vertical());
+    hf->error = 0;
+
+    // Face normals (pointing up, in world frame). Vertical faces are not visible from above.
+    std::vector<ChVector<>> fnormals(faces.size());
+    std::vector<char> visible(faces.size());
+    for (size_t it = 0; it < faces.size(); it++) {
+        const auto& A = verts[faces[it][0]];
+        ChVector<> nrm = Vcross(verts[faces[it][1]] - A, verts[faces[it][2]] - A);
+        visible[it] = std::abs(nrm.z()) > 1e-9 * nrm.Length();
+        if (nrm.z() < 0)
+            nrm = -nrm;
+        fnormals[it] = ChWorldFrame::FromISO(nrm.GetNormalized());
+    }
+
+    // Rasterize all faces, keeping the topmost surface point at each grid node
+    for (size_t it = 0; it < faces.size(); it++) {
+        if (!visible[it])
+            continue;
+        RasterizeTriangle(verts[faces[it][0]], verts[faces[it][1]], verts[faces[it][2]], hf->x0, hf->y0, hf->delta,
+                          hf->nx, hf->ny, [&](int k, double z) {
+                              if (z > hf->height[k]) {
+                                  hf->height[k] = z;
+                                  hf->normal[k] = fnormals[it];
+                              }
+                          });
+    }
+
+    // Estimate the interpolation error at the cell centers and at the midpoints of the cell edges
+    double offsets[3][2] = {{0.5, 0.5}, {0.5, 0}, {0, 0.5}};
+    for (const auto& off : offsets) {
+        double x0 = hf->x0 + off[0] * hf->delta;
+        double y0 = hf->y0 + off[1] * hf->delta;
+        int nx = hf->nx - (off[0] > 0);
+        int ny = hf->ny - (off[1] > 0);
+        std::vector<double> height(nx * ny, std::numeric_limits<double>::lowest());
+        for (size_t it = 0; it < faces.size(); it++) {
+            if (!visible[it])
+                continue;
+            RasterizeTriangle(verts[faces[it][0]], verts[faces[it][1]], verts[faces[it][2]], x0, y0, hf->delta, nx, ny,
+                              [&](int k, double z) { height[k] = std::max(height[k], z); });
+        }
+        for (int j = 0; j < ny; j++) {
+            for (int i = 0; i < nx; i++) {
+                double h;
+                ChVector<> n;
+                if (height[j * nx + i] == std::numeric_limits<double>::lowest() ||
+                    !hf->Interpolate(x0 + i * hf->delta, y0 + j * hf->delta, h, n))
+                    continue;
+                hf->error = std::max(hf->error, std::abs(h - height[j * nx + i]));
+            }
+        }
+    }
+
+    // Evaluate the interpolation error at the vertices of all visible faces, where the bilinear interpolant of the
+    // piecewise-linear surface typically deviates most. Vertices sharing the same horizontal location (e.g., at the
+    // top and bottom of a vertical face) are compared against the topmost one.
+    std::map<std::pair<double, double>, double> vtop;
+    for (size_t it = 0; it < faces.size(); it++) {
+        if (!visible[it])
+            continue;
+        for (int iv = 0; iv < 3; iv++) {
+            const auto& v = verts[faces[it][iv]];
+            auto res = vtop.insert(std::make_pair(std::make_pair(v.x(), v.y()), v.z()));
+            if (!res.second)
+                res.first->second = std::max(res.first->second, v.z());
+        }
+    }
+    for (const auto& v : vtop) {
+        double h;
+        ChVector<> n;
+        if (!hf->Interpolate(v.first.first, v.first.second, h, n))
+            continue;
+        hf->error = std::max(hf->error, std::abs(h - v.second));
+    }
+
+    m_hfield = std::move(hf);
+}
+
+bool RigidTerrain::HeightField::Interpolate(double x, double y, double& h, ChVector<>& n) const {
+    double sx = (x - x0) / delta;
+    double sy = (y - y0) / delta;
+    if (sx < 0 || sy < 0 || sx > nx - 1 || sy > ny - 1)
+        return false;
+
+    int i = std::min((int)sx, nx - 2);
+    int j = std::min((int)sy, ny - 2);
+    double a = sx - i;
+    double b = sy - j;
+
+    int k00 = j * nx + i;
+    int k10 = k00 + 1;
+    int k01 = k00 + nx;
+    int k11 = k01 + 1;
+    const double none = std::numeric_limits<double>::lowest();
+    if (height[k00] == none || height[k10] == none || height[k01] == none || height[k11] == none)
+        return false;
+
+    double w00 = (1 - a) * (1 - b);
+    double w10 = a * (1 - b);
+    double w01 = (1 - a) * b;
+    double w11 = a * b;
+    h = w00 * height[k00] + w10 * height[k10] + w01 * height[k01] + w11 * height[k11];
+    n = w00 * normal[k00] + w10 * normal[k10] + w01 * normal[k01] + w11 * normal[k11];
+    n.Normalize();
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Export all patch meshes
 // -----------------------------------------------------------------------------
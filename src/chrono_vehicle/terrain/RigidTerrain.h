@@ -19,6 +19,7 @@
 #ifndef RIGID_TERRAIN_H
 #define RIGID_TERRAIN_H
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -185,6 +186,23 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// Collision is disabled with all other objects in this family (to prevent generating contact forces between patches, if more than one is defined).
     void SetCollisionFamily(int family) { m_collision_family = family; }
 
+    /// Enable use of baked height-fields for the mesh and height-map patches (default: false).
+    /// If enabled, Initialize rasterizes the triangles of each mesh patch into a regular grid of heights and normals,
+    /// with the specified spacing in the horizontal plane of the world frame. Terrain queries (FindPoint and the
+    /// functions using it) on such patches are then answered in constant time, through bilinear interpolation of the
+    /// values at the corners of the grid cell containing the query point, instead of casting a ray into the patch
+    /// collision model. Queries in grid cells not fully covered by the mesh fall back on ray casting.
+    /// This assumes the patch surface is a height field (no overhangs); the sweep sphere radius of the contact mesh
+    /// is ignored. The size of the grid (and hence the memory footprint) is that of the patch bounding box divided by
+    /// the square of the grid spacing. This function must be called before Initialize.
+    void EnableHeightFieldCache(bool val, double resolution = 0.1);
+
+    /// Get the maximum error in height of the baked height-fields (see EnableHeightFieldCache).
+    /// This is the largest difference between the interpolated height and the exact height of the mesh surface,
+    /// evaluated at the centers and edge midpoints of all grid cells and at the vertices of all visible mesh faces,
+    /// in the grid cells fully covered by the mesh. Returns 0 if no height-field was baked.
+    double GetHeightFieldError() const;
+
   private:
     /// Patch represented as a box domain.
     struct CH_VEHICLE_API BoxPatch : public Patch {
@@ -195,11 +213,29 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         virtual bool FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const override;
     };
 
+    /// Height and normal values on a regular grid in the horizontal plane (ISO frame).
+    struct HeightField {
+        double x0;                       ///< x coordinate of first grid node
+        double y0;                       ///< y coordinate of first grid node
+        double delta;                    ///< grid spacing
+        int nx;                          ///< number of grid nodes in x direction
+        int ny;                          ///< number of grid nodes in y direction
+        std::vector<double> height;      ///< height at grid nodes (lowest double if no surface point)
+        std::vector<ChVector<>> normal;  ///< surface normal at grid nodes (world frame)
+        double error;                    ///< maximum interpolation error
+
+        /// Interpolate height and normal at the given location (ISO frame).
+        /// Return false if the grid cell containing the location is not fully covered by the surface.
+        bool Interpolate(double x, double y, double& h, ChVector<>& n) const;
+    };
+
     /// Patch represented as a mesh.
     struct CH_VEHICLE_API MeshPatch : public Patch {
         std::shared_ptr<geometry::ChTriangleMeshConnected> m_trimesh;  ///< associated mesh (contact and visualization)
         std::shared_ptr<geometry::ChTriangleMeshSoup> m_trimesh_s;     ///< associated contact mesh soup
         std::string m_mesh_name;                                       ///< name of associated mesh
+        std::unique_ptr<HeightField> m_hfield;                         ///< baked height-field (optional)
+        void BakeHeightField(double resolution);
         virtual bool FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const override;
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
         virtual void ExportMeshWavefront(const std::string& out_dir) override;
@@ -209,6 +245,8 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     int m_num_patches;
     std::vector<std::shared_ptr<Patch>> m_patches;
     bool m_use_friction_functor;
+    bool m_use_hfield;
+    double m_hfield_resolution;
     std::shared_ptr<ChContactContainer::AddContactCallback> m_contact_callback;
 
     void AddPatch(std::shared_ptr<Patch> patch,
@@ -17,6 +17,7 @@
 //
 // =============================================================================
 
+#include <bitset>
 #include <cstdio>
 #include <cmath>
 #include <queue>
@@ -32,6 +33,7 @@
 #include "chrono/assets/ChTexture.h"
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/utils/ChConvexHull.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
@@ -161,6 +163,12 @@ void SCMDeformableTerrain::SetBulldozingParameters(
     m_ground->m_erosion_propagations = erosion_propagations;
 }
 
+// Enable/disable compaction of idle grid tiles.
+void SCMDeformableTerrain::EnableTileCompaction(bool val, int num_idle_steps) {
+    m_ground->m_tile_compaction = val;
+    m_ground->m_tile_idle_steps = num_idle_steps;
+}
+
 void SCMDeformableTerrain::SetTestHeight(double offset) {
     m_ground->m_test_offset_up = offset;
 }
@@ -254,6 +262,17 @@ int SCMDeformableTerrain::GetNumErosionNodes() const {
     return m_ground->m_num_erosion_nodes;
 }
 
+// Return the current number of modified grid nodes.
+int SCMDeformableTerrain::GetNumGridNodes() const {
+    return static_cast<int>(m_ground->m_grid_map.GetNumNodes());
+}
+
+// Return the current number of grid tiles.
+int SCMDeformableTerrain::GetNumGridTiles(int& num_compact) const {
+    num_compact = static_cast<int>(m_ground->m_grid_map.GetNumCompactTiles());
+    return static_cast<int>(m_ground->m_grid_map.GetNumTiles());
+}
+
 // Timer information
 double SCMDeformableTerrain::GetTimerMovingPatches() const {
     return 1e3 * m_ground->m_timer_moving_patches();
@@ -296,6 +315,9 @@ void SCMDeformableTerrain::PrintStepStatistics(std::ostream& os) const {
     os << "   Number ray hits:         " << m_ground->m_num_ray_hits << std::endl;
     os << "   Number contact patches:  " << m_ground->m_num_contact_patches << std::endl;
     os << "   Number erosion nodes:    " << m_ground->m_num_erosion_nodes << std::endl;
+    os << "   Number grid nodes:       " << m_ground->m_grid_map.GetNumNodes() << std::endl;
+    os << "   Number grid tiles:       " << m_ground->m_grid_map.GetNumTiles() << " ("
+       << m_ground->m_grid_map.GetNumCompactTiles() << " compacted)" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -343,6 +365,10 @@ SCMDeformableSoil::SCMDeformableSoil(ChSystem* system, bool visualization_mesh)
     m_erosion_iterations = 3;
     m_erosion_propagations = 10;
 
+    // Grid tiles
+    m_tile_compaction = false;
+    m_tile_idle_steps = 1000;
+
     // Default soil parameters
     m_Bekker_Kphi = 2e6;
     m_Bekker_Kc = 0;
@@ -371,6 +397,7 @@ void SCMDeformableSoil::Initialize(double sizeX, double sizeY, double delta) {
     m_ny = static_cast<int>(std::ceil((sizeY / 2) / delta));  // number of divisions in Y direction
 
     m_delta = sizeX / (2 * m_nx);   // grid spacing
+    m_grid_map.Reset(m_nx, m_ny);
     m_area = std::pow(m_delta, 2);  // area of a cell
 
     // Return now if no visualization
@@ -465,6 +492,7 @@ void SCMDeformableSoil::Initialize(const std::string& heightmap_file,
     m_ny = static_cast<int>(std::ceil((sizeY / 2) / delta));  // number of divisions in Y direction
 
     m_delta = sizeX / (2.0 * m_nx);  // grid spacing
+    m_grid_map.Reset(m_nx, m_ny);
     m_area = std::pow(m_delta, 2);   // area of a cell
 
     double dx_grid = 0.5 / m_nx;
@@ -681,10 +709,10 @@ ChVector<> SCMDeformableSoil::GetInitNormal(const ChVector2<int>& loc) const {
 
 // Get the terrain height (relative to the SCM plane) at the specified grid vertex.
 double SCMDeformableSoil::GetHeight(const ChVector2<int>& loc) const {
-    // First query the hash-map
-    auto p = m_grid_map.find(loc);
-    if (p != m_grid_map.end())
-        return p->second.level;
+    // First query the grid of modified nodes
+    double level;
+    if (m_grid_map.GetLevel(loc, level))
+        return level;
 
     // Else return undeformed height
     return GetInitHeight(loc);
@@ -900,12 +928,13 @@ static const std::vector<ChVector2<int>> neighbors4{
     ChVector2<int>(0, 1)    // N
 };
 
-// Default implementation uses Map-Reduce for collecting ray intersection hits.
-// The alternative is to simultaenously load the global map of hits while ray casting (using a critical section).
-////#define RAY_CASTING_WITH_CRITICAL_SECTION
+// Number of shards in the hash-map of ray-cast hits
+static const int num_hit_shards = 64;
 
 // Reset the list of forces, and fills it with forces from a soil contact model.
 void SCMDeformableSoil::ComputeInternalForces() {
+    CH_TRACE_SCOPE("SCM::ComputeInternalForces", "terrain");
+
     // Initialize list of modified visualization mesh vertices (use any externally modified vertices)
     std::vector<int> modified_vertices = m_external_modified_vertices;
     m_external_modified_vertices.clear();
@@ -913,7 +942,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
     // Reset quantities at grid nodes modified over previous step
     // (required for bulldozing effects and for proper visualization coloring)
     for (const auto& ij : m_modified_nodes) {
-        auto& nr = m_grid_map.at(ij);
+        auto& nr = m_grid_map.At(ij);
         nr.sigma = 0;
         nr.sinkage_elastic = 0;
         nr.step_plastic_flow = 0;
@@ -951,6 +980,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
     // ---------------------
 
     m_timer_moving_patches.start();
+    CH_TRACE_BEGIN(trace_moving_patches, "SCM::MovingPatches", "terrain");
 
     // Update patch information (find range of grid indices)
     if (m_moving_patch) {
@@ -962,6 +992,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
     }
 
     m_timer_moving_patches.stop();
+    CH_TRACE_END(trace_moving_patches);
 
     // -------------------------
     // Perform ray casting tests
@@ -974,77 +1005,42 @@ void SCMDeformableSoil::ComputeInternalForces() {
         int patch_id;                // index of associated patch id
     };
 
-    // Hash-map for vertices with ray-cast hits
-    std::unordered_map<ChVector2<int>, HitRecord, CoordHash> hits;
+    // Hash-map for vertices with ray-cast hits, split in shards by grid coordinates.
+    // Each shard is loaded by a single thread, so that all shards can be loaded concurrently.
+    struct HitMap {
+        std::vector<std::unordered_map<ChVector2<int>, HitRecord, CoordHash>> shards;
+        std::vector<std::pair<const ChVector2<int>, HitRecord>*> list;  // all hits, in shard order
 
-    m_num_ray_casts = 0;
-    m_num_ray_hits = 0;
-
-    m_timer_ray_casting.start();
+        static int Shard(const ChVector2<int>& ij) { return (int)(CoordHash()(ij) % num_hit_shards); }
 
-#ifdef RAY_CASTING_WITH_CRITICAL_SECTION
-
-    int nthreads = GetSystem()->GetNumThreadsChrono();
-
-    // Loop through all moving patches (user-defined or default one)
-    for (auto& p : m_patches) {
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            ChVector2<int> ij = p.m_range[k];
-
-            // Move from (i, j) to (x, y, z) representation in the world frame
-            double x = ij.x() * m_delta;
-            double y = ij.y() * m_delta;
-            double z;
-    #pragma omp critical(SCM_ray_casting)
-            z = GetHeight(ij);
-
-            ChVector<> vertex_abs = m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
-
-            // Create ray at current grid location
-            collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector<> to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector<> from = to - m_Z * m_test_offset_down;
+        std::pair<const ChVector2<int>, HitRecord>* find(const ChVector2<int>& ij) {
+            auto& shard = shards[Shard(ij)];
+            auto h = shard.find(ij);
+            return (h == shard.end()) ? nullptr : &(*h);
+        }
+    };
 
-            // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
+    HitMap hits;
+    hits.shards.resize(num_hit_shards);
 
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
-
-            if (mrayhit_result.hit) {
-    #pragma omp critical(SCM_ray_casting)
-                {
-                    // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
-                    }
+    m_num_ray_casts = 0;
+    m_num_ray_hits = 0;
 
-                    // Add to our map of hits to process
-                    HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                    hits.insert(std::make_pair(ij, record));
-                    m_num_ray_hits++;
-                }
-            }
-        }
-        m_num_ray_casts += num_ray_casts;
-    }
+    m_timer_ray_casting.start();
+    CH_TRACE_BEGIN(trace_ray_casting, "SCM::RayCasting", "terrain");
 
-#else
+    const int nthreads = GetSystem()->GetNumThreadsChrono();
 
-    // Map-reduce approach (to eliminate critical section)
+    // Per-thread hit buffers, one list per shard.
+    // The grid map is not modified during ray casting, so it can be safely queried concurrently (in GetHeight).
+    typedef std::vector<std::pair<ChVector2<int>, HitRecord>> HitBuffer;
+    std::vector<std::vector<HitBuffer>> t_hits(nthreads, std::vector<HitBuffer>(num_hit_shards));
 
-    const int nthreads = GetSystem()->GetNumThreadsChrono();
-    std::vector<std::unordered_map<ChVector2<int>, HitRecord, CoordHash>> t_hits(nthreads);
+    m_timer_ray_testing.start();
+    CH_TRACE_BEGIN(trace_ray_testing, "SCM::RayTesting", "terrain");
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
-        m_timer_ray_testing.start();
-
         // Loop through all vertices in the patch range
         int num_ray_casts = 0;
     #pragma omp parallel for num_threads(nthreads) reduction(+:num_ray_casts)
@@ -1073,43 +1069,61 @@ void SCMDeformableSoil::ComputeInternalForces() {
             num_ray_casts++;
 
             if (mrayhit_result.hit) {
-                // Add to our map of hits to process
+                // Add to this thread's buffer of hits to process
                 HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
+                t_hits[t_num][HitMap::Shard(ij)].push_back(std::make_pair(ij, record));
             }
         }
 
-        m_timer_ray_testing.stop();
-
         m_num_ray_casts += num_ray_casts;
+    }
+
+    m_timer_ray_testing.stop();
+    CH_TRACE_END(trace_ray_testing);
 
-        // Sequential insertion in global hits
+    // Merge the per-thread buffers into the shards of the hit map (each shard processed by a single thread).
+    // Collect the records of nodes hit for the first time; these are inserted in the grid map in a separate pass.
+    std::vector<std::vector<std::pair<ChVector2<int>, NodeRecord>>> new_nodes(num_hit_shards);
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+    for (int s = 0; s < num_hit_shards; s++) {
+        auto& shard = hits.shards[s];
         for (int t_num = 0; t_num < nthreads; t_num++) {
-            
-            for (auto& h : t_hits[t_num]) {
-                // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
+            for (const auto& h : t_hits[t_num][s]) {
+                // Skip nodes already hit (from a different, overlapping patch)
+                if (!shard.insert(h).second)
+                    continue;
+                // If this is the first hit from this node, create the node record
+                if (!m_grid_map.Contains(h.first)) {
                     double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
+                    new_nodes[s].push_back(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
                 }
-                ////hits.insert(h);
             }
-            
-            hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
-            t_hits[t_num].clear();
         }
-        m_num_ray_hits = (int)hits.size();
     }
 
-#endif
+    // Insert new node records in the grid map and flatten the list of hits
+    size_t num_hits = 0;
+    for (int s = 0; s < num_hit_shards; s++)
+        num_hits += hits.shards[s].size();
+    hits.list.reserve(num_hits);
+    for (int s = 0; s < num_hit_shards; s++) {
+        for (const auto& n : new_nodes[s])
+            m_grid_map.Insert(n.first, n.second);
+        for (auto& h : hits.shards[s])
+            hits.list.push_back(&h);
+    }
+    m_num_ray_hits = (int)num_hits;
 
     m_timer_ray_casting.stop();
+    CH_TRACE_END(trace_ray_casting);
 
     // --------------------
     // Find contact patches
     // --------------------
 
     m_timer_contact_patches.start();
+    CH_TRACE_BEGIN(trace_contact_patches, "SCM::ContactPatches", "terrain");
 
     // Collect hit vertices assigned to each contact patch.
     struct ContactPatchRecord {
@@ -1124,7 +1138,8 @@ void SCMDeformableSoil::ComputeInternalForces() {
     // Loop through all hit nodes and determine to which contact patch they belong.
     // Use a queue-based flood-filling algorithm based on the neighbors of each hit node.
     m_num_contact_patches = 0;
-    for (auto& h : hits) {
+    for (auto h_ptr : hits.list) {
+        auto& h = *h_ptr;
         if (h.second.patch_id != -1)
             continue;
 
@@ -1152,7 +1167,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
                 ChVector2<int> nbr_ij = crt_ij + neighbors4[k];
                 // If neighbor is not a hit node, move on
                 auto nbr = hits.find(nbr_ij);
-                if (nbr == hits.end())
+                if (!nbr)
                     continue;
                 // If neighbor already assigned to a contact patch, move on
                 if (nbr->second.patch_id != -1)
@@ -1183,12 +1198,14 @@ void SCMDeformableSoil::ComputeInternalForces() {
     }
 
     m_timer_contact_patches.stop();
+    CH_TRACE_END(trace_contact_patches);
 
     // ----------------------
     // Compute contact forces
     // ----------------------
 
     m_timer_contact_forces.start();
+    CH_TRACE_BEGIN(trace_contact_forces, "SCM::ContactForces", "terrain");
 
     // Initialize local values for the soil parameters
     double Bekker_Kphi = m_Bekker_Kphi;
@@ -1201,10 +1218,11 @@ void SCMDeformableSoil::ComputeInternalForces() {
     double damping_R = m_damping_R;
 
     // Process only hit nodes
-    for (auto& h : hits) {
+    for (auto h_ptr : hits.list) {
+        auto& h = *h_ptr;
         ChVector2<> ij = h.first;
 
-        auto& nr = m_grid_map.at(ij);      // node record
+        auto& nr = m_grid_map.At(ij);      // node record
         const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
 
         ChContactable* contactable = h.second.contactable;
@@ -1339,12 +1357,14 @@ void SCMDeformableSoil::ComputeInternalForces() {
     }  // end loop on ray hits
 
     m_timer_contact_forces.stop();
+    CH_TRACE_END(trace_contact_forces);
 
     // --------------------------------------------------
     // Flow material to the side of rut, using heuristics
     // --------------------------------------------------
 
     m_timer_bulldozing.start();
+    CH_TRACE_BEGIN(trace_bulldozing, "SCM::Bulldozing", "terrain");
 
     m_num_erosion_nodes = 0;
 
@@ -1356,6 +1376,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
 
         // (1) Raise boundaries of each contact patch
         m_timer_bulldozing_boundary.start();
+        CH_TRACE_BEGIN(trace_bulldozing_boundary, "SCM::BulldozingBoundary", "terrain");
 
         NodeSet boundary;  // union of contact patch boundaries
         for (auto p : contact_patches) {
@@ -1364,7 +1385,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
             // Calculate the displaced material from all touched nodes and identify boundary
             double tot_step_flow = 0;
             for (const auto& ij : p.nodes) {                     // for each node in contact patch
-                const auto& nr = m_grid_map.at(ij);              //   get node record
+                const auto& nr = m_grid_map.At(ij);              //   get node record
                 if (nr.sigma <= 0)                               //   if node not touched
                     continue;                                    //     skip (not in effective patch)
                 tot_step_flow += nr.step_plastic_flow;           //   accumulate displaced material
@@ -1372,9 +1393,10 @@ void SCMDeformableSoil::ComputeInternalForces() {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];  //     neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                     //     if neighbor out of bounds
                     ////    continue;                                     //       skip neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end())  //     if neighbor not yet recorded
+                    auto nbr_nr = m_grid_map.Find(nbr_ij);            //     neighbor node record
+                    if (!nbr_nr)                                      //     if neighbor not yet recorded
                         p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
-                    else if (m_grid_map.at(nbr_ij).sigma <= 0)        //     if neighbor not touched
+                    else if (nbr_nr->sigma <= 0)                      //     if neighbor not touched
                         p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
                 }
             }
@@ -1386,13 +1408,13 @@ void SCMDeformableSoil::ComputeInternalForces() {
             // Raise boundary (create a sharp spike which will be later smoothed out with erosion)
             for (const auto& ij : p_boundary) {                                  // for each node in bndry
                 m_modified_nodes.push_back(ij);                                  //   mark as modified
-                if (m_grid_map.find(ij) == m_grid_map.end()) {                   //   if not yet recorded
+                if (!m_grid_map.Contains(ij)) {                                  //   if not yet recorded
                     double z = GetInitHeight(ij);                                //     undeformed height
                     const ChVector<>& n = GetInitNormal(ij);                     //     terrain normal
-                    m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, n)));  //     add new node record
+                    m_grid_map.Insert(ij, NodeRecord(z, z, n));                  //     add new node record
                     m_modified_nodes.push_back(ij);                              //     mark as modified
                 }                                                                //
-                auto& nr = m_grid_map.at(ij);                                    //   node record
+                auto& nr = m_grid_map.At(ij);                                    //   node record
                 nr.erosion = true;                                               //   add to erosion domain
                 AddMaterialToNode(diff, nr);                                     //   add raise amount
             }
@@ -1403,9 +1425,11 @@ void SCMDeformableSoil::ComputeInternalForces() {
         }  // end for contact_patches
 
         m_timer_bulldozing_boundary.stop();
+        CH_TRACE_END(trace_bulldozing_boundary);
 
         // (2) Calculate erosion domain (dilate boundary)
         m_timer_bulldozing_domain.start();
+        CH_TRACE_BEGIN(trace_bulldozing_domain, "SCM::BulldozingDomain", "terrain");
 
         NodeSet erosion_domain = boundary;
         NodeSet erosion_front = boundary;  // initialize erosion front to boundary nodes
@@ -1416,16 +1440,16 @@ void SCMDeformableSoil::ComputeInternalForces() {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];  //   neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                       //   if out of bounds
                     ////    continue;                                       //     ignore neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end()) {  //   if neighbor not yet recorded
+                    if (!m_grid_map.Contains(nbr_ij)) {                 //   if neighbor not yet recorded
                         double z = GetInitHeight(nbr_ij);               //     undeformed height at neighbor location
                         const ChVector<>& n = GetInitNormal(nbr_ij);    //     terrain normal at neighbor location
                         NodeRecord nr(z, z, n);                         //     create new record
                         nr.erosion = true;                              //     include in erosion domain
-                        m_grid_map.insert(std::make_pair(nbr_ij, nr));  //     add new node record
+                        m_grid_map.Insert(nbr_ij, nr);                  //     add new node record
                         front.insert(nbr_ij);                           //     add neighbor to new front
                         m_modified_nodes.push_back(nbr_ij);             //     mark as modified
                     } else {                                            //   if neighbor previously recorded
-                        NodeRecord& nr = m_grid_map.at(nbr_ij);         //     get existing record
+                        NodeRecord& nr = m_grid_map.At(nbr_ij);         //     get existing record
                         if (!nr.erosion && nr.sigma <= 0) {             //     if neighbor not touched
                             nr.erosion = true;                          //       include in erosion domain
                             front.insert(nbr_ij);                       //       add neighbor to new front
@@ -1440,19 +1464,21 @@ void SCMDeformableSoil::ComputeInternalForces() {
 
         m_num_erosion_nodes = static_cast<int>(erosion_domain.size());
         m_timer_bulldozing_domain.stop();
+        CH_TRACE_END(trace_bulldozing_domain);
 
         // (3) Erosion algorithm on domain
         m_timer_bulldozing_erosion.start();
+        CH_TRACE_BEGIN(trace_bulldozing_erosion, "SCM::BulldozingErosion", "terrain");
 
         for (int iter = 0; iter < m_erosion_iterations; iter++) {
             for (const auto& ij : erosion_domain) {
-                auto& nr = m_grid_map.at(ij);
+                auto& nr = m_grid_map.At(ij);
                 for (int k = 0; k < 4; k++) {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];
-                    auto rec = m_grid_map.find(nbr_ij);
-                    if (rec == m_grid_map.end())
+                    auto rec = m_grid_map.Find(nbr_ij);
+                    if (!rec)
                         continue;
-                    auto& nbr_nr = rec->second;
+                    auto& nbr_nr = *rec;
 
                     // (3.1) Flow remaining material to neighbor
                     double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
@@ -1480,16 +1506,19 @@ void SCMDeformableSoil::ComputeInternalForces() {
         }
 
         m_timer_bulldozing_erosion.stop();
+        CH_TRACE_END(trace_bulldozing_erosion);
 
     }  // end do_bulldozing
 
     m_timer_bulldozing.stop();
+    CH_TRACE_END(trace_bulldozing);
 
     // --------------------
     // Update visualization
     // --------------------
 
     m_timer_visualization.start();
+    CH_TRACE_BEGIN(trace_visualization, "SCM::Visualization", "terrain");
 
     if (m_trimesh_shape) {
         // Loop over list of modified nodes and adjust corresponding mesh vertices.
@@ -1497,7 +1526,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
         for (const auto& ij : m_modified_nodes) {
             if (!CheckMeshBounds(ij))                 // if node outside mesh
                 continue;                             //   do nothing
-            const auto& nr = m_grid_map.at(ij);       // grid node record
+            const auto& nr = m_grid_map.At(ij);       // grid node record
             int iv = GetMeshVertexIndex(ij);          // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
             modified_vertices.push_back(iv);          // cache in list of modified mesh vertices
@@ -1509,6 +1538,10 @@ void SCMDeformableSoil::ComputeInternalForces() {
     }
 
     m_timer_visualization.stop();
+    CH_TRACE_END(trace_visualization);
+
+    // Advance the grid step counter and compact idle tiles
+    m_grid_map.Advance(m_tile_compaction, m_tile_idle_steps);
 }
 
 void SCMDeformableSoil::AddMaterialToNode(double amount, NodeRecord& nr) {
@@ -1620,14 +1653,12 @@ void SCMDeformableSoil::UpdateMeshVertexNormal(const ChVector2<int> ij, int iv)
 std::vector<SCMDeformableTerrain::NodeLevel> SCMDeformableSoil::GetModifiedNodes(bool all_nodes) const {
     std::vector<SCMDeformableTerrain::NodeLevel> nodes;
     if (all_nodes) {
-        for (const auto& nr : m_grid_map) {
-            nodes.push_back(std::make_pair(nr.first, nr.second.level));
-        }
+        m_grid_map.GetLevels(nodes);
     } else {
         for (const auto& ij : m_modified_nodes) {
-            auto rec = m_grid_map.find(ij);
-            assert(rec != m_grid_map.end());
-            nodes.push_back(std::make_pair(ij, rec->second.level));
+            double level = 0;
+            m_grid_map.GetLevel(ij, level);
+            nodes.push_back(std::make_pair(ij, level));
         }
     }
     return nodes;
@@ -1639,7 +1670,8 @@ std::vector<SCMDeformableTerrain::NodeLevel> SCMDeformableSoil::GetModifiedNodes
 void SCMDeformableSoil::SetModifiedNodes(const std::vector<SCMDeformableTerrain::NodeLevel>& nodes) {
     for (const auto& n : nodes) {
         // Modify existing entry in grid map or insert new one
-        m_grid_map[n.first] = SCMDeformableSoil::NodeRecord(n.second, n.second, GetInitNormal(n.first));
+        NodeRecord nr(n.second, n.second, GetInitNormal(n.first));
+        m_grid_map.Insert(n.first, nr) = nr;
     }
 
     // Update visualization
@@ -1648,7 +1680,7 @@ void SCMDeformableSoil::SetModifiedNodes(const std::vector<SCMDeformableTerrain:
             auto ij = n.first;                           // grid location
             if (!CheckMeshBounds(ij))                    // if outside mesh
                 continue;                                //   do nothing
-            const auto& nr = m_grid_map.at(ij);          // grid node record
+            const auto& nr = m_grid_map.At(ij);          // grid node record
             int iv = GetMeshVertexIndex(ij);             // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);     // update vertex coordinates and color
             if (!m_trimesh_shape->IsWireframe())         // if not in wireframe mode
@@ -1658,5 +1690,199 @@ void SCMDeformableSoil::SetModifiedNodes(const std::vector<SCMDeformableTerrain:
     }
 }
 
+// -----------------------------------------------------------------------------
+// Implementation of the grid of node records
+// -----------------------------------------------------------------------------
+
+const int SCMDeformableSoil::NodeGrid::TILE_BITS;
+const int SCMDeformableSoil::NodeGrid::TILE_SIZE;
+const int SCMDeformableSoil::NodeGrid::TILE_NODES;
+
+SCMDeformableSoil::NodeGrid::NodeGrid() {
+    Reset(0, 0);
+}
+
+void SCMDeformableSoil::NodeGrid::Reset(int nx, int ny) {
+    m_tile_min = ChVector2<int>(TileCoord(-nx), TileCoord(-ny));
+    m_tile_num = ChVector2<int>(TileCoord(nx) - m_tile_min.x() + 1, TileCoord(ny) - m_tile_min.y() + 1);
+    m_tiles.clear();
+    m_tiles.resize(m_tile_num.x() * m_tile_num.y());
+    m_far_tiles.clear();
+    m_step = 0;
+    m_num_nodes = 0;
+    m_num_tiles = 0;
+    m_num_compact_tiles = 0;
+}
+
+const SCMDeformableSoil::NodeGrid::Tile* SCMDeformableSoil::NodeGrid::GetTile(const ChVector2<int>& ij) const {
+    int ti = TileCoord(ij.x()) - m_tile_min.x();
+    int tj = TileCoord(ij.y()) - m_tile_min.y();
+    if (ti >= 0 && ti < m_tile_num.x() && tj >= 0 && tj < m_tile_num.y())
+        return m_tiles[ti + m_tile_num.x() * tj].get();
+
+    auto t = m_far_tiles.find(ChVector2<int>(ti, tj));
+    return (t == m_far_tiles.end()) ? nullptr : t->second.get();
+}
+
+SCMDeformableSoil::NodeGrid::Tile* SCMDeformableSoil::NodeGrid::GetTile(const ChVector2<int>& ij, bool create) {
+    int ti = TileCoord(ij.x()) - m_tile_min.x();
+    int tj = TileCoord(ij.y()) - m_tile_min.y();
+
+    // Locate the tile slot (in the directory or in the map of far tiles)
+    std::unique_ptr<Tile>* slot;
+    if (ti >= 0 && ti < m_tile_num.x() && tj >= 0 && tj < m_tile_num.y()) {
+        slot = &m_tiles[ti + m_tile_num.x() * tj];
+    } else if (create) {
+        slot = &m_far_tiles[ChVector2<int>(ti, tj)];
+    } else {
+        auto t = m_far_tiles.find(ChVector2<int>(ti, tj));
+        if (t == m_far_tiles.end())
+            return nullptr;
+        slot = &t->second;
+    }
+
+    // Allocate a new tile on first touch
+    if (!*slot) {
+        if (!create)
+            return nullptr;
+        slot->reset(new Tile);
+        (*slot)->origin = ChVector2<int>(TILE_SIZE * TileCoord(ij.x()), TILE_SIZE * TileCoord(ij.y()));
+        (*slot)->mask.assign(TILE_NODES / 64, 0);
+        (*slot)->nodes.resize(TILE_NODES);
+        m_num_tiles++;
+    }
+
+    // Mark tile as active and expand it if needed
+    Tile* tile = slot->get();
+    tile->last_step = m_step;
+    if (tile->IsCompact())
+        Expand(*tile);
+
+    return tile;
+}
+
+bool SCMDeformableSoil::NodeGrid::Contains(const ChVector2<int>& ij) const {
+    const Tile* tile = GetTile(ij);
+    return tile && IsRecorded(*tile, NodeIndex(ij));
+}
+
+bool SCMDeformableSoil::NodeGrid::GetLevel(const ChVector2<int>& ij, double& level) const {
+    const Tile* tile = GetTile(ij);
+    int k = NodeIndex(ij);
+    if (!tile || !IsRecorded(*tile, k))
+        return false;
+
+    if (tile->IsCompact()) {
+        // Index in the list of compacted records: recorded nodes before the mask word, plus those before k in it
+        int w = k >> 6;
+        uint64_t below = tile->mask[w] & ((uint64_t(1) << (k & 63)) - 1);
+        level = tile->compact[tile->rank[w] + std::bitset<64>(below).count()].level;
+    } else {
+        level = tile->nodes[k].level;
+    }
+
+    return true;
+}
+
+SCMDeformableSoil::NodeRecord* SCMDeformableSoil::NodeGrid::Find(const ChVector2<int>& ij) {
+    Tile* tile = GetTile(ij, false);
+    int k = NodeIndex(ij);
+    if (!tile || !IsRecorded(*tile, k))
+        return nullptr;
+    return &tile->nodes[k];
+}
+
+SCMDeformableSoil::NodeRecord& SCMDeformableSoil::NodeGrid::At(const ChVector2<int>& ij) {
+    NodeRecord* nr = Find(ij);
+    assert(nr);
+    return *nr;
+}
+
+SCMDeformableSoil::NodeRecord& SCMDeformableSoil::NodeGrid::Insert(const ChVector2<int>& ij, const NodeRecord& nr) {
+    Tile* tile = GetTile(ij, true);
+    int k = NodeIndex(ij);
+    if (!IsRecorded(*tile, k)) {
+        tile->mask[k >> 6] |= uint64_t(1) << (k & 63);
+        tile->nodes[k] = nr;
+        m_num_nodes++;
+    }
+    return tile->nodes[k];
+}
+
+void SCMDeformableSoil::NodeGrid::Advance(bool compact, int num_idle_steps) {
+    m_step++;
+    if (!compact)
+        return;
+
+    for (auto& tile : m_tiles) {
+        if (tile && !tile->IsCompact() && m_step - tile->last_step > num_idle_steps)
+            Compact(*tile);
+    }
+    for (auto& tile : m_far_tiles) {
+        if (!tile.second->IsCompact() && m_step - tile.second->last_step > num_idle_steps)
+            Compact(*tile.second);
+    }
+}
+
+void SCMDeformableSoil::NodeGrid::Compact(Tile& tile) {
+    tile.rank.resize(TILE_NODES / 64);
+    tile.compact.clear();
+    for (int w = 0; w < TILE_NODES / 64; w++) {
+        tile.rank[w] = static_cast<uint16_t>(tile.compact.size());
+        for (int k = 64 * w; k < 64 * (w + 1); k++) {
+            if (!IsRecorded(tile, k))
+                continue;
+            const auto& nr = tile.nodes[k];
+            tile.compact.push_back({nr.level_initial, nr.level, nr.normal, nr.sinkage, nr.sinkage_plastic,
+                                    nr.sigma_yield, nr.kshear, nr.massremainder});
+        }
+    }
+    tile.compact.shrink_to_fit();
+    std::vector<NodeRecord>().swap(tile.nodes);
+    m_num_compact_tiles++;
+}
+
+void SCMDeformableSoil::NodeGrid::Expand(Tile& tile) {
+    tile.nodes.resize(TILE_NODES);
+    int n = 0;
+    for (int k = 0; k < TILE_NODES; k++) {
+        if (!IsRecorded(tile, k))
+            continue;
+        const auto& cr = tile.compact[n++];
+        auto& nr = tile.nodes[k];
+        nr = NodeRecord(cr.level_initial, cr.level, cr.normal);
+        nr.sinkage = cr.sinkage;
+        nr.sinkage_plastic = cr.sinkage_plastic;
+        nr.sigma_yield = cr.sigma_yield;
+        nr.kshear = cr.kshear;
+        nr.massremainder = cr.massremainder;
+    }
+    std::vector<CompactNodeRecord>().swap(tile.compact);
+    std::vector<uint16_t>().swap(tile.rank);
+    m_num_compact_tiles--;
+}
+
+void SCMDeformableSoil::NodeGrid::GetLevels(std::vector<std::pair<ChVector2<int>, double>>& levels) const {
+    auto collect = [&levels](const Tile& tile) {
+        int n = 0;
+        for (int k = 0; k < TILE_NODES; k++) {
+            if (!IsRecorded(tile, k))
+                continue;
+            ChVector2<int> ij = tile.origin + ChVector2<int>(k % TILE_SIZE, k / TILE_SIZE);
+            double level = tile.IsCompact() ? tile.compact[n].level : tile.nodes[k].level;
+            levels.push_back(std::make_pair(ij, level));
+            n++;
+        }
+    };
+
+    levels.reserve(levels.size() + m_num_nodes);
+    for (const auto& tile : m_tiles) {
+        if (tile)
+            collect(*tile);
+    }
+    for (const auto& tile : m_far_tiles)
+        collect(*tile.second);
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
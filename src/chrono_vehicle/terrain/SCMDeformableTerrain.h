@@ -20,9 +20,12 @@
 #ifndef SCM_DEFORMABLE_TERRAIN_H
 #define SCM_DEFORMABLE_TERRAIN_H
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <ostream>
 #include <unordered_map>
+#include <vector>
 
 #include "chrono/assets/ChColorAsset.h"
 #include "chrono/assets/ChTriangleMeshShape.h"
@@ -111,6 +114,13 @@ class CH_VEHICLE_API SCMDeformableTerrain : public ChTerrain {
         int erosion_propagations = 10  ///< number of concentric vertex selections subject to erosion
     );
 
+    /// Enable/disable compaction of idle grid tiles (default: disabled).
+    /// The modified grid nodes are stored in square tiles of 64x64 nodes. If enabled, a tile with no node accessed
+    /// over the specified number of steps is compacted: only the recorded nodes and their persistent soil state are
+    /// kept. A compacted tile is expanded back when any of its nodes is contacted again. Use this option to limit
+    /// memory use for long runs over large terrain patches.
+    void EnableTileCompaction(bool val, int num_idle_steps = 1000);
+
     /// Set the vertical level up to which collision is tested (relative to the reference level at the sample point).
     /// Since the contact is unilateral, this could be zero. However, when computing bulldozing flow, one might also
     /// need to know if in the surrounding there is some potential future contact: so it might be better to use a
@@ -241,6 +251,10 @@ class CH_VEHICLE_API SCMDeformableTerrain : public ChTerrain {
     int GetNumContactPatches() const;
     /// Return the number of nodes in the erosion domain at last step (bulldosing effects).
     int GetNumErosionNodes() const;
+    /// Return the current number of modified grid nodes (from the start of simulation).
+    int GetNumGridNodes() const;
+    /// Return the current number of grid tiles (of which 'num_compact' are compacted).
+    int GetNumGridTiles(int& num_compact) const;
 
     /// Return time for updating moving patches at last step (ms).
     double GetTimerMovingPatches() const;
@@ -367,6 +381,93 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
         std::size_t operator()(const ChVector2<int>& p) const { return p.x() * 31 + p.y(); }
     };
 
+    // Persistent information at an idle node (quantities reset at each step are not stored)
+    struct CompactNodeRecord {
+        double level_initial;    // initial node level (relative to SCM frame)
+        double level;            // current node level (relative to SCM frame)
+        ChVector<> normal;       // normal of undeformed terrain (in SCM frame)
+        double sinkage;          // along local normal direction
+        double sinkage_plastic;  // along local normal direction
+        double sigma_yield;      // along local normal direction
+        double kshear;           // along local tangent direction
+        double massremainder;    // for bulldozing
+    };
+
+    // Sparse grid of node records, stored in dense square tiles allocated on first touch.
+    // Tiles covering the range of grid indices set with SetRange are accessed by index; any other tiles are accessed
+    // through a hash-map. Node records are addressed by their grid coordinates; pointers and references to records
+    // remain valid until the tile is compacted. Const functions do not modify the grid and can be called concurrently.
+    class CH_VEHICLE_API NodeGrid {
+      public:
+        static const int TILE_BITS = 6;                      // log2 of tile size
+        static const int TILE_SIZE = 1 << TILE_BITS;         // number of nodes along a tile side
+        static const int TILE_NODES = TILE_SIZE * TILE_SIZE;  // number of nodes in a tile
+
+        NodeGrid();
+
+        // Remove all tiles and set the range of grid indices with direct tile access: [-nx, nx] x [-ny, ny].
+        void Reset(int nx, int ny);
+
+        // Check if a record exists for the specified node.
+        bool Contains(const ChVector2<int>& ij) const;
+
+        // Get the current level of the specified node (return false if the node has no record).
+        bool GetLevel(const ChVector2<int>& ij, double& level) const;
+
+        // Find the record of the specified node (return nullptr if the node has no record).
+        // The containing tile is marked as active and expanded if compacted.
+        NodeRecord* Find(const ChVector2<int>& ij);
+
+        // Access the record of the specified node (which must exist).
+        NodeRecord& At(const ChVector2<int>& ij);
+
+        // Insert a record for the specified node, if one does not exist already. Return the node record.
+        NodeRecord& Insert(const ChVector2<int>& ij, const NodeRecord& nr);
+
+        // Increment the step counter and compact all tiles not accessed over the last 'num_idle_steps' steps.
+        void Advance(bool compact, int num_idle_steps);
+
+        // Collect the levels of all recorded nodes.
+        void GetLevels(std::vector<std::pair<ChVector2<int>, double>>& levels) const;
+
+        size_t GetNumNodes() const { return m_num_nodes; }
+        size_t GetNumTiles() const { return m_num_tiles; }
+        size_t GetNumCompactTiles() const { return m_num_compact_tiles; }
+
+      private:
+        struct Tile {
+            ChVector2<int> origin;                   // grid coordinates of first tile node
+            std::vector<uint64_t> mask;              // flags for recorded nodes
+            std::vector<NodeRecord> nodes;           // dense array of node records (empty if compacted)
+            std::vector<CompactNodeRecord> compact;  // records of recorded nodes, in index order (if compacted)
+            std::vector<uint16_t> rank;              // number of recorded nodes before each mask word (if compacted)
+            int last_step;                           // last step when the tile was accessed
+            bool IsCompact() const { return nodes.empty(); }
+        };
+
+        static int TileCoord(int i) { return (i >= 0) ? i / TILE_SIZE : -((-i - 1) / TILE_SIZE) - 1; }
+        static int NodeIndex(const ChVector2<int>& ij) {
+            return (ij.x() & (TILE_SIZE - 1)) + TILE_SIZE * (ij.y() & (TILE_SIZE - 1));
+        }
+        static bool IsRecorded(const Tile& tile, int k) { return (tile.mask[k >> 6] >> (k & 63)) & 1; }
+
+        const Tile* GetTile(const ChVector2<int>& ij) const;
+        Tile* GetTile(const ChVector2<int>& ij, bool create);
+        void Compact(Tile& tile);
+        void Expand(Tile& tile);
+
+        ChVector2<int> m_tile_min;                   // lower bounds of directory tile indices
+        ChVector2<int> m_tile_num;                   // number of directory tiles in each direction
+        std::vector<std::unique_ptr<Tile>> m_tiles;  // directory of tiles in the index range
+        std::unordered_map<ChVector2<int>, std::unique_ptr<Tile>, CoordHash> m_far_tiles;  // tiles outside range
+        int m_step;                                  // step counter
+        size_t m_num_nodes;                          // number of recorded nodes
+        size_t m_num_tiles;                          // number of allocated tiles
+        size_t m_num_compact_tiles;                  // number of compacted tiles
+
+        friend class SCMNodeGridTest;
+    };
+
     // Get the initial undeformed terrain height (relative to the SCM plane) at the specified grid node.
     double GetInitHeight(const ChVector2<int>& loc) const;
 
@@ -469,8 +570,11 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
 
     ChMatrixDynamic<> m_heights;  // (base) grid heights (when initializing from height-field map)
 
-    std::unordered_map<ChVector2<int>, NodeRecord, CoordHash> m_grid_map;  // modified grid nodes (persistent)
-    std::vector<ChVector2<int>> m_modified_nodes;                          // modified grid nodes (current)
+    NodeGrid m_grid_map;                           // modified grid nodes (persistent)
+    std::vector<ChVector2<int>> m_modified_nodes;  // modified grid nodes (current)
+
+    bool m_tile_compaction;  // compact idle grid tiles?
+    int m_tile_idle_steps;   // number of steps after which an idle tile is compacted
 
     std::vector<MovingPatchInfo> m_patches;  // set of active moving patches
     bool m_moving_patch;                     // user-specified moving patches?
@@ -529,6 +633,7 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
     int m_num_erosion_nodes;
 
     friend class SCMDeformableTerrain;
+    friend class SCMNodeGridTest;
 };
 
 /// @} vehicle_terrain
@@ -16,7 +16,11 @@
 //
 // =============================================================================
 
+#include <atomic>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
 
@@ -95,7 +99,21 @@ namespace vehicle {
 
 // -----------------------------------------------------------------------------
 
-void ReadFileJSON(const std::string& filename, Document& d) {
+// Cache of parsed JSON documents (see EnableCacheJSON)
+static std::atomic<bool> json_cache_enabled(false);
+static std::mutex json_cache_mutex;
+static std::unordered_map<std::string, std::unique_ptr<Document>> json_cache;
+
+void EnableCacheJSON(bool val) {
+    json_cache_enabled = val;
+}
+
+void ClearCacheJSON() {
+    std::lock_guard<std::mutex> lock(json_cache_mutex);
+    json_cache.clear();
+}
+
+static void ParseFileJSON(const std::string& filename, Document& d) {
     std::ifstream ifs(filename);
     if (!ifs.good()) {
         GetLog() << "ERROR: Could not open JSON file: " << filename << "\n";
@@ -108,6 +126,21 @@ void ReadFileJSON(const std::string& filename, Document& d) {
     }
 }
 
+void ReadFileJSON(const std::string& filename, Document& d) {
+    if (!json_cache_enabled) {
+        ParseFileJSON(filename, d);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(json_cache_mutex);
+    auto& cached = json_cache[filename];
+    if (!cached) {
+        cached = std::unique_ptr<Document>(new Document);
+        ParseFileJSON(filename, *cached);
+    }
+    d.CopyFrom(*cached, d.GetAllocator());
+}
+
 // -----------------------------------------------------------------------------
 
 ChVector<> ReadVectorJSON(const Value& a) {
@@ -50,6 +50,15 @@ namespace vehicle {
 /// A Null document is returned if the file cannot be opened.
 CH_VEHICLE_API void ReadFileJSON(const std::string& filename, rapidjson::Document& d);
 
+/// Enable caching of parsed JSON files (default: false).
+/// If enabled, ReadFileJSON parses each file only once and returns copies of the cached document on subsequent calls
+/// for the same file. This avoids re-reading and re-parsing the same specification files when many vehicle instances
+/// are constructed (e.g., with ChVehicleBatchRunner). Access to the cache is thread-safe.
+CH_VEHICLE_API void EnableCacheJSON(bool val);
+
+/// Remove all documents from the cache of parsed JSON files.
+CH_VEHICLE_API void ClearCacheJSON();
+
 // -----------------------------------------------------------------------------
 
 /// Load and return a ChVector from the specified JSON array
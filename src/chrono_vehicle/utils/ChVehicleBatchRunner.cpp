@@ -0,0 +1,171 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Runner for batches of independent vehicle simulations (e.g., parameter
+// sweeps), executed concurrently in a single process.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "chrono/core/ChTimer.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+#include "chrono_vehicle/utils/ChVehicleBatchRunner.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChVehicleBatchRunner::ChVehicleBatchRunner(int num_runs)
+    : m_num_runs(num_runs), m_step(1e-3), m_end_time(1), m_output_step(0), m_run_time(0) {
+    SetNumThreads(0);
+}
+
+void ChVehicleBatchRunner::SetNumThreads(int num_threads) {
+    m_num_threads = num_threads > 0 ? num_threads : std::max(1, (int)std::thread::hardware_concurrency());
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleBatchRunner::Run(const InstanceFactory& factory) {
+    int num_channels = (int)m_channels.size();
+    std::vector<RunOutput> outputs(m_num_runs);
+    m_failed.clear();
+
+    ChTimer<double> timer;
+    timer.start();
+
+    // Worker threads pull the next run index until all runs are processed
+    std::atomic<int> next_run(0);
+    std::mutex failed_mutex;
+    auto worker = [&]() {
+        while (true) {
+            int run = next_run++;
+            if (run >= m_num_runs)
+                break;
+            try {
+                Simulate(run, factory, outputs[run]);
+            } catch (const std::exception& e) {
+                // Discard the partial output of a failed run
+                outputs[run].records.clear();
+                outputs[run].records.shrink_to_fit();
+                std::lock_guard<std::mutex> lock(failed_mutex);
+                m_failed.push_back(std::make_pair(run, std::string(e.what())));
+            }
+        }
+    };
+
+    int num_workers = std::min(m_num_threads, m_num_runs);
+    std::vector<std::thread> threads;
+    for (int i = 1; i < num_workers; i++)
+        threads.push_back(std::thread(worker));
+    worker();
+    for (auto& t : threads)
+        t.join();
+
+    timer.stop();
+    m_run_time = timer();
+
+    std::sort(m_failed.begin(), m_failed.end());
+
+    // Assemble the output table, in order of run index
+    int record_size = 1 + num_channels;
+    size_t num_records = 0;
+    for (const auto& output : outputs)
+        num_records += output.records.size() / record_size;
+
+    m_columns.assign(2 + num_channels, std::vector<double>());
+    for (auto& column : m_columns)
+        column.reserve(num_records);
+    for (int run = 0; run < m_num_runs; run++) {
+        const auto& records = outputs[run].records;
+        for (size_t i = 0; i < records.size(); i += record_size) {
+            m_columns[0].push_back(run);
+            for (int j = 0; j < record_size; j++)
+                m_columns[1 + j].push_back(records[i + j]);
+        }
+    }
+}
+
+void ChVehicleBatchRunner::Simulate(int run, const InstanceFactory& factory, RunOutput& output) {
+    int num_channels = (int)m_channels.size();
+
+    auto instance = factory(run);
+    auto system = instance->GetSystem();
+    system->SetNumThreads(1, 1, 1);
+
+    std::vector<double> values;
+    double next_output = system->GetChTime();
+    while (true) {
+        double time = system->GetChTime();
+
+        // Record output
+        if (time >= next_output - 1e-6 * m_step) {
+            values.clear();
+            instance->GetOutput(values);
+            if ((int)values.size() != num_channels)
+                throw ChException("ChVehicleBatchRunner: incorrect number of output values for run " +
+                                  std::to_string(run));
+            output.records.push_back(time);
+            output.records.insert(output.records.end(), values.begin(), values.end());
+            next_output += m_output_step;
+        }
+
+        if (time >= m_end_time - 1e-6 * m_step || instance->Done())
+            break;
+
+        instance->Advance(m_step);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+std::vector<std::string> ChVehicleBatchRunner::GetColumnNames() const {
+    std::vector<std::string> names = {"run", "time"};
+    names.insert(names.end(), m_channels.begin(), m_channels.end());
+    return names;
+}
+
+const std::vector<double>& ChVehicleBatchRunner::GetColumn(const std::string& name) const {
+    auto names = GetColumnNames();
+    auto it = std::find(names.begin(), names.end(), name);
+    if (it == names.end() || m_columns.empty())
+        throw ChException("ChVehicleBatchRunner: no output column named " + name);
+    return m_columns[it - names.begin()];
+}
+
+void ChVehicleBatchRunner::WriteOutput(const std::string& filename, const std::string& delim) const {
+    auto names = GetColumnNames();
+
+    utils::CSV_writer csv(delim);
+    for (const auto& name : names)
+        csv << name;
+    csv << std::endl;
+
+    size_t num_records = m_columns.empty() ? 0 : m_columns[0].size();
+    for (size_t i = 0; i < num_records; i++) {
+        csv << (int)m_columns[0][i];
+        for (size_t j = 1; j < m_columns.size(); j++)
+            csv << m_columns[j][i];
+        csv << std::endl;
+    }
+
+    csv.write_to_file(filename);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Runner for batches of independent vehicle simulations (e.g., parameter
+// sweeps), executed concurrently in a single process.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_BATCH_RUNNER_H
+#define CH_VEHICLE_BATCH_RUNNER_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_utils
+/// @{
+
+/// Runner for a batch of independent vehicle simulations.
+/// Each run of the batch is an instance of a user-provided class derived from ChVehicleBatchRunner::Instance, which
+/// encapsulates a complete simulation (Chrono system, vehicle, terrain, driver, ...) for one set of parameters. The
+/// instances are created and simulated concurrently, by a pool of worker threads, each worker processing one run at a
+/// time. Each Chrono system is set to run single-threaded, so that the available cores are used across runs rather than
+/// within a run.
+///
+/// At each output time, the values of the output channels (see SetOutputChannels) are collected from each instance.
+/// On completion, the outputs of all runs are available as one columnar table (with the run index and simulation time
+/// in the first two columns), ordered by run index and then by time, independent of the order in which runs complete.
+///
+/// Construction of the instances typically reads the same specification files for all runs. Enable the JSON cache (see
+/// EnableCacheJSON) so that these files are parsed only once, and share read-only data (e.g., meshes or vehicle paths)
+/// between instances through the factory function. Note that the instance factory is invoked from the worker threads.
+class CH_VEHICLE_API ChVehicleBatchRunner {
+  public:
+    /// Interface for one simulation of the batch.
+    class CH_VEHICLE_API Instance {
+      public:
+        virtual ~Instance() {}
+
+        /// Return the Chrono system of this simulation.
+        virtual ChSystem* GetSystem() = 0;
+
+        /// Advance the simulation by one step of the given size (synchronize and advance all modules).
+        virtual void Advance(double step) = 0;
+
+        /// Return the values of the output channels at the current time.
+        /// The number and order of values must match the channel names passed to SetOutputChannels.
+        virtual void GetOutput(std::vector<double>& values) {}
+
+        /// Return true to terminate this run before the final time.
+        virtual bool Done() { return false; }
+    };
+
+    /// Function creating the simulation instance for the run with given index (in [0, num_runs)).
+    typedef std::function<std::unique_ptr<Instance>(int run)> InstanceFactory;
+
+    ChVehicleBatchRunner(int num_runs);
+    ~ChVehicleBatchRunner() {}
+
+    /// Set the number of worker threads (default: number of hardware threads).
+    void SetNumThreads(int num_threads);
+
+    /// Set the integration step size (default: 1e-3).
+    void SetStepSize(double step) { m_step = step; }
+
+    /// Set the final simulation time for all runs (default: 1).
+    void SetEndTime(double end_time) { m_end_time = end_time; }
+
+    /// Set the output interval (default: 0, output at every step).
+    void SetOutputStep(double output_step) { m_output_step = output_step; }
+
+    /// Set the names of the output channels.
+    void SetOutputChannels(const std::vector<std::string>& names) { m_channels = names; }
+
+    /// Create and simulate all runs of the batch. Return when all runs have completed.
+    /// Runs which throw an exception are reported as failed (see GetFailedRuns); their partial output is discarded, so
+    /// failed runs have no records in the output table.
+    void Run(const InstanceFactory& factory);
+
+    /// Get the number of runs in the batch.
+    int GetNumRuns() const { return m_num_runs; }
+
+    /// Get the number of worker threads.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Get the indices of the runs which failed, with the corresponding error messages.
+    const std::vector<std::pair<int, std::string>>& GetFailedRuns() const { return m_failed; }
+
+    /// Get the names of the output columns ("run", "time", followed by the output channels).
+    std::vector<std::string> GetColumnNames() const;
+
+    /// Get the output column with the given index (see GetColumnNames).
+    const std::vector<double>& GetColumn(int index) const { return m_columns[index]; }
+
+    /// Get the output column with the given name. A ChException is thrown if no such column exists.
+    const std::vector<double>& GetColumn(const std::string& name) const;
+
+    /// Write the output table to the specified file (one line per output record, with a header line).
+    void WriteOutput(const std::string& filename, const std::string& delim = ",") const;
+
+    /// Get the wall clock time (in seconds) for the last call to Run.
+    double GetRunTime() const { return m_run_time; }
+
+    /// Get the throughput achieved in the last call to Run (number of runs per hour).
+    double GetRunsPerHour() const { return m_run_time > 0 ? 3600 * m_num_runs / m_run_time : 0; }
+
+  private:
+    /// Output of a single run (row-major, one record of 1 + num_channels values per output time).
+    struct RunOutput {
+        std::vector<double> records;
+    };
+
+    void Simulate(int run, const InstanceFactory& factory, RunOutput& output);
+
+    int m_num_runs;
+    int m_num_threads;
+    double m_step;
+    double m_end_time;
+    double m_output_step;
+    std::vector<std::string> m_channels;
+
+    std::vector<std::vector<double>> m_columns;        ///< output table (column-major)
+    std::vector<std::pair<int, std::string>> m_failed;  ///< failed runs and error messages
+    double m_run_time;                                  ///< wall clock time of last batch
+};
+
+/// @} vehicle_utils
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,137 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark for the ray-hit queries of the collision systems. A dense grid of
+// vertical rays (as used, e.g., by the SCM deformable terrain) is cast onto a
+// field of spheres and boxes resting on a ground plate. Compares individual ray
+// queries and batched ray queries (reported as rays per second), for the
+// Bullet and (if available) the Chrono collision systems.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/ChCollisionSystemBullet.h"
+#ifdef CHRONO_COLLISION
+    #include "chrono/collision/ChCollisionSystemChrono.h"
+#endif
+
+#include "benchmark/benchmark.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// =============================================================================
+
+enum class CollisionType { BULLET, CHRONO };
+
+class RaycastTest {
+  public:
+    RaycastTest(CollisionType type);
+
+    ChCollisionSystem& GetCollisionSystem() { return *m_system.GetCollisionSystem(); }
+
+    std::vector<ChVector<>> m_from;
+    std::vector<ChVector<>> m_to;
+
+  private:
+    ChSystemNSC m_system;
+};
+
+RaycastTest::RaycastTest(CollisionType type) {
+    if (type == CollisionType::CHRONO) {
+#ifdef CHRONO_COLLISION
+        auto coll = chrono_types::make_shared<ChCollisionSystemChrono>();
+        coll->SetBroadphaseGridResolution(ChVector<int>(20, 4, 20));
+        m_system.SetCollisionSystem(coll);
+#endif
+    }
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    m_system.AddBody(ground);
+
+    for (int ix = 0; ix < 40; ix++) {
+        for (int iz = 0; iz < 40; iz++) {
+            std::shared_ptr<ChBody> body;
+            if ((ix + iz) % 2 == 0)
+                body = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, true, mat);
+            else
+                body = chrono_types::make_shared<ChBodyEasyBox>(0.3, 0.3, 0.3, 1000, false, true, mat);
+            body->SetPos(ChVector<>(-9.75 + 0.5 * ix, 0.2 + 0.1 * ((ix * iz) % 3), -9.75 + 0.5 * iz));
+            m_system.AddBody(body);
+        }
+    }
+
+    m_system.Setup();
+    m_system.Update();
+    m_system.ComputeCollisions();
+
+    // Vertical rays on a regular grid, ordered row by row (neighboring rays are coherent)
+    int n = 400;
+    double delta = 20.0 / n;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            double x = -10 + (i + 0.5) * delta;
+            double z = -10 + (j + 0.5) * delta;
+            m_from.push_back(ChVector<>(x, 2, z));
+            m_to.push_back(ChVector<>(x, -1, z));
+        }
+    }
+}
+
+// =============================================================================
+
+template <CollisionType TYPE>
+static void RayHitSingle(benchmark::State& st) {
+    RaycastTest test(TYPE);
+    auto& coll = test.GetCollisionSystem();
+    size_t num_rays = test.m_from.size();
+    int num_hits = 0;
+    for (auto _ : st) {
+        num_hits = 0;
+        for (size_t i = 0; i < num_rays; i++) {
+            ChCollisionSystem::ChRayhitResult result;
+            if (coll.RayHit(test.m_from[i], test.m_to[i], result))
+                num_hits++;
+        }
+    }
+    st.counters["rays_per_sec"] = benchmark::Counter((double)num_rays, benchmark::Counter::kIsIterationInvariantRate);
+    st.counters["hits"] = num_hits;
+}
+
+template <CollisionType TYPE>
+static void RayHitBatch(benchmark::State& st) {
+    RaycastTest test(TYPE);
+    auto& coll = test.GetCollisionSystem();
+    size_t num_rays = test.m_from.size();
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    int num_hits = 0;
+    for (auto _ : st) {
+        num_hits = coll.RayHit(test.m_from, test.m_to, results);
+    }
+    st.counters["rays_per_sec"] = benchmark::Counter((double)num_rays, benchmark::Counter::kIsIterationInvariantRate);
+    st.counters["hits"] = num_hits;
+}
+
+BENCHMARK_TEMPLATE(RayHitSingle, CollisionType::BULLET)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(RayHitBatch, CollisionType::BULLET)->Unit(benchmark::kMillisecond)->UseRealTime();
+#ifdef CHRONO_COLLISION
+BENCHMARK_TEMPLATE(RayHitSingle, CollisionType::CHRONO)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(RayHitBatch, CollisionType::CHRONO)->Unit(benchmark::kMillisecond)->UseRealTime();
+#endif
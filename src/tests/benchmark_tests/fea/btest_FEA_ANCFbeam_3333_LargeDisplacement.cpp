@@ -68,7 +68,7 @@ enum class SolverType { MINRES, SparseLU, SparseQR, MKL, MUMPS, PARDISO_PROJECT
 
 class ANCFBeamTest {
   public:
-    ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt);
+    ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched = false);
 
     ~ANCFBeamTest() { delete m_system; }
 
@@ -90,7 +90,7 @@ class ANCFBeamTest {
     int m_NumThreads;
 };
 
-ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt) {
+ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched) {
     m_SolverType = solver_type;
     m_NumElements = num_elements;
     m_NumThreads = NumThreads;
@@ -211,6 +211,9 @@ ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThre
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
 
+    // Optionally evaluate the internal forces and Jacobians of the elements in SIMD batches
+    mesh->EnableBatchedANCF(useBatched);
+
     // Setup visualization
     auto vis_surf = chrono_types::make_shared<ChVisualizationFEAmesh>(*mesh);
     vis_surf->SetFEMdataType(ChVisualizationFEAmesh::E_PLOT_SURFACE);
@@ -490,6 +493,10 @@ int main(int argc, char* argv[]) {
                         ANCFBeamTest test(num_els(i), ls, NumThreads, true);
                         test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_ContInt");
                     }
+                    {
+                        ANCFBeamTest test(num_els(i), ls, NumThreads, true, true);
+                        test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_ContIntBatched");
+                    }
                     {
                         ANCFBeamTest test(num_els(i), ls, NumThreads, false);
                         test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_PreInt");
@@ -67,7 +67,7 @@ enum class SolverType { MINRES, SparseLU, SparseQR, MKL, MUMPS, PARDISO_PROJECT
 
 class ANCFHexaTest {
   public:
-    ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt);
+    ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched = false);
 
     ~ANCFHexaTest() { delete m_system; }
 
@@ -89,7 +89,7 @@ class ANCFHexaTest {
     int m_NumThreads;
 };
 
-ANCFHexaTest::ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt) {
+ANCFHexaTest::ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched) {
     m_SolverType = solver_type;
     m_NumElements = 2 * num_elements * num_elements;
     m_NumThreads = NumThreads;
@@ -203,6 +203,9 @@ ANCFHexaTest::ANCFHexaTest(int num_elements, SolverType solver_type, int NumThre
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
 
+    // Optionally evaluate the internal forces and Jacobians of the elements in SIMD batches
+    mesh->EnableBatchedANCF(useBatched);
+
     // Setup visualization
     auto mvisualizemesh = chrono_types::make_shared<ChVisualizationFEAmesh>(*(mesh.get()));
     mvisualizemesh->SetFEMdataType(ChVisualizationFEAmesh::E_PLOT_NODE_SPEED_NORM);
@@ -511,6 +514,10 @@ int main(int argc, char* argv[]) {
                         ANCFHexaTest test(num_els(i), ls, NumThreads, true);
                         test.RunTimingTest(timing_stats, "ChElementHexaANCF_3843_ContInt");
                     }
+                    {
+                        ANCFHexaTest test(num_els(i), ls, NumThreads, true, true);
+                        test.RunTimingTest(timing_stats, "ChElementHexaANCF_3843_ContIntBatched");
+                    }
                     {
                         ANCFHexaTest test(num_els(i), ls, NumThreads, false);
                         test.RunTimingTest(timing_stats, "ChElementHexaANCF_3843_PreInt");
@@ -16,6 +16,8 @@
 //
 // Note that the MKL Pardiso and Mumps solvers are set to lock the sparsity
 // pattern, but not to use the sparsity pattern learner.
+// The SparseLU solver is benchmarked with and without reuse of the symbolic
+// factorization across steps.
 //
 // =============================================================================
 
@@ -49,7 +51,7 @@
 using namespace chrono;
 using namespace chrono::fea;
 
-enum class SolverType { MINRES, MKL, MUMPS, PARDISO_PROJECT, SparseQR };
+enum class SolverType { MINRES, MKL, MUMPS, PARDISO_PROJECT, SparseQR, SparseLU, SparseLU_REUSE };
 
 template <int N>
 class ANCFshell : public utils::ChBenchmarkTest {
@@ -79,6 +81,18 @@ class ANCFshell_SparseQR : public ANCFshell<N> {
     ANCFshell_SparseQR() : ANCFshell<N>(SolverType::SparseQR) {}
 };
 
+template <int N>
+class ANCFshell_SparseLU : public ANCFshell<N> {
+  public:
+    ANCFshell_SparseLU() : ANCFshell<N>(SolverType::SparseLU) {}
+};
+
+template <int N>
+class ANCFshell_SparseLU_REUSE : public ANCFshell<N> {
+  public:
+    ANCFshell_SparseLU_REUSE() : ANCFshell<N>(SolverType::SparseLU_REUSE) {}
+};
+
 template <int N>
 class ANCFshell_MKL : public ANCFshell<N> {
   public:
@@ -171,6 +185,19 @@ ANCFshell<N>::ANCFshell(SolverType solver_type) {
             m_system->SetSolver(solver);
             break;
         }
+        case SolverType::SparseLU: {
+            auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+            solver->LockSparsityPattern(true);
+            m_system->SetSolver(solver);
+            break;
+        }
+        case SolverType::SparseLU_REUSE: {
+            auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+            solver->LockSparsityPattern(true);
+            solver->ReuseSymbolicFactorization(true);
+            m_system->SetSolver(solver);
+            break;
+        }
     }
 
     // Set up integrator
@@ -280,6 +307,16 @@ CH_BM_SIMULATION_LOOP(ANCFshell16_SparseQR, ANCFshell_SparseQR<16>, NUM_SKIP_STE
 CH_BM_SIMULATION_LOOP(ANCFshell32_SparseQR, ANCFshell_SparseQR<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(ANCFshell64_SparseQR, ANCFshell_SparseQR<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 
+CH_BM_SIMULATION_LOOP(ANCFshell08_SparseLU, ANCFshell_SparseLU<8>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell16_SparseLU, ANCFshell_SparseLU<16>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell32_SparseLU, ANCFshell_SparseLU<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell64_SparseLU, ANCFshell_SparseLU<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
+CH_BM_SIMULATION_LOOP(ANCFshell08_SparseLU_REUSE, ANCFshell_SparseLU_REUSE<8>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell16_SparseLU_REUSE, ANCFshell_SparseLU_REUSE<16>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell32_SparseLU_REUSE, ANCFshell_SparseLU_REUSE<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell64_SparseLU_REUSE, ANCFshell_SparseLU_REUSE<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
 #ifdef CHRONO_PARDISO_MKL
 CH_BM_SIMULATION_LOOP(ANCFshell08_MKL, ANCFshell_MKL<8>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(ANCFshell16_MKL, ANCFshell_MKL<16>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
@@ -67,7 +67,7 @@ enum class SolverType { MINRES, SparseLU, SparseQR, MKL, MUMPS, PARDISO_PROJECT
 
 class ANCFShellTest {
   public:
-    ANCFShellTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt);
+    ANCFShellTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched = false);
 
     ~ANCFShellTest() { delete m_system; }
 
@@ -89,7 +89,7 @@ class ANCFShellTest {
     int m_NumThreads;
 };
 
-ANCFShellTest::ANCFShellTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt) {
+ANCFShellTest::ANCFShellTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched) {
     m_SolverType = solver_type;
     m_NumElements = 2 * num_elements * num_elements;
     m_NumThreads = NumThreads;
@@ -203,6 +203,9 @@ ANCFShellTest::ANCFShellTest(int num_elements, SolverType solver_type, int NumTh
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
 
+    // Optionally evaluate the internal forces and Jacobians of the elements in SIMD batches
+    mesh->EnableBatchedANCF(useBatched);
+
     // Setup visualization
     auto mvisualizemesh = chrono_types::make_shared<ChVisualizationFEAmesh>(*(mesh.get()));
     mvisualizemesh->SetFEMdataType(ChVisualizationFEAmesh::E_PLOT_SURFACE);
@@ -509,6 +512,10 @@ int main(int argc, char* argv[]) {
                         ANCFShellTest test(num_els(i), ls, NumThreads, true);
                         test.RunTimingTest(timing_stats, "ChElementShellANCF_3833_ContInt");
                     }
+                    {
+                        ANCFShellTest test(num_els(i), ls, NumThreads, true, true);
+                        test.RunTimingTest(timing_stats, "ChElementShellANCF_3833_ContIntBatched");
+                    }
                     {
                         ANCFShellTest test(num_els(i), ls, NumThreads, false);
                         test.RunTimingTest(timing_stats, "ChElementShellANCF_3833_PreInt");
@@ -0,0 +1,153 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for the Craig-Bampton reduced-order element.
+// A flexible beam, meshed with ChElementHexaCorot_8 elements, is clamped at one
+// end and carries a rigid body attached to the nodes of its other end. The
+// model is simulated with the full mesh and with a Craig-Bampton reduction to
+// the nodes of the two end faces and 10 fixed-interface modes.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChElementCraigBampton.h"
+#include "chrono/fea/ChElementHexaCorot_8.h"
+#include "chrono/fea/ChLinkPointFrame.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// =============================================================================
+
+template <bool REDUCED>
+class CraigBamptonTest : public utils::ChBenchmarkTest {
+  public:
+    CraigBamptonTest();
+    ~CraigBamptonTest() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(1e-3); }
+
+  private:
+    ChSystemSMC* m_system;
+};
+
+template <bool REDUCED>
+CraigBamptonTest<REDUCED>::CraigBamptonTest() {
+    int nx = 40;
+    int ny = 4;
+    int nz = 4;
+    double length = 2.0;
+    double width = 0.1;
+    int num_modes = 10;
+
+    m_system = new ChSystemSMC();
+    m_system->Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto material = chrono_types::make_shared<ChContinuumElastic>();
+    material->Set_E(2e9);
+    material->Set_v(0.3);
+    material->Set_density(1000);
+    material->Set_RayleighDampingK(1e-4);
+
+    // Create the full mesh
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> root;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> tip;
+    for (int i = 0; i <= nx; i++) {
+        for (int j = 0; j <= ny; j++) {
+            for (int k = 0; k <= nz; k++) {
+                ChVector<> pos(i * length / nx, j * width / ny, k * width / nz);
+                auto node = chrono_types::make_shared<ChNodeFEAxyz>(pos);
+                mesh->AddNode(node);
+                nodes.push_back(node);
+                if (i == 0)
+                    root.push_back(node);
+                if (i == nx)
+                    tip.push_back(node);
+            }
+        }
+    }
+
+    auto N = [&](int i, int j, int k) { return nodes[(i * (ny + 1) + j) * (nz + 1) + k]; };
+    for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) {
+            for (int k = 0; k < nz; k++) {
+                auto element = chrono_types::make_shared<ChElementHexaCorot_8>();
+                element->SetNodes(N(i, j, k), N(i, j + 1, k), N(i, j + 1, k + 1), N(i, j, k + 1),          //
+                                  N(i + 1, j, k), N(i + 1, j + 1, k), N(i + 1, j + 1, k + 1), N(i + 1, j, k + 1));
+                element->SetMaterial(material);
+                mesh->AddElement(element);
+            }
+        }
+    }
+
+    // If requested, replace the full mesh with a reduced one
+    if (REDUCED) {
+        std::vector<std::shared_ptr<ChNodeFEAxyz>> boundary = root;
+        boundary.insert(boundary.end(), tip.begin(), tip.end());
+
+        auto element = chrono_types::make_shared<ChElementCraigBampton>();
+        element->Initialize(mesh, boundary, num_modes);
+
+        mesh = chrono_types::make_shared<ChMesh>();
+        for (auto& node : boundary)
+            mesh->AddNode(node);
+        mesh->AddNode(element->GetModalNode());
+        mesh->AddElement(element);
+    }
+
+    m_system->Add(mesh);
+    for (auto& node : root)
+        node->SetFixed(true);
+
+    // Rigid body attached to the tip nodes
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetPos(ChVector<>(length + 0.1, width / 2, width / 2));
+    body->SetMass(20);
+    body->SetInertiaXX(ChVector<>(0.1, 0.1, 0.1));
+    m_system->AddBody(body);
+    for (auto& node : tip) {
+        auto link = chrono_types::make_shared<ChLinkPointFrame>();
+        link->Initialize(node, body);
+        m_system->Add(link);
+    }
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->UseSparsityPatternLearner(true);
+    solver->LockSparsityPattern(true);
+    m_system->SetSolver(solver);
+    m_system->SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 10  // number of steps for hot start
+#define NUM_SIM_STEPS 100  // number of simulation steps for each benchmark
+
+CH_BM_SIMULATION_ONCE(CraigBampton_FullMesh, CraigBamptonTest<false>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_ONCE(CraigBampton_Reduced, CraigBamptonTest<true>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -14,7 +14,10 @@
 //
 // Benchmark test for sparse matrix setup (assembly of system matrix).
 // This provides a measure of the effect and performance of using the "sparsity
-// learner".
+// learner" and of the parallel (colored) loading of the element stiffness
+// blocks into the system matrix. The assembly benchmarks time the matrix
+// assembly alone (ChSystemDescriptor::ConvertToMatrixForm) and the loading of
+// the element stiffness blocks (ChSystemDescriptor::LoadKblocks).
 //
 // =============================================================================
 
@@ -22,6 +25,7 @@
 #include "chrono/utils/ChBenchmark.h"
 
 #include "chrono/core/ChMatrix.h"
+#include "chrono/core/ChSparsityPatternLearner.h"
 #include "chrono/physics/ChSystemSMC.h"
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/fea/ChElementShellANCF_3423.h"
@@ -175,6 +179,48 @@ class SystemFixture : public ::benchmark::Fixture {
     }                                                                                 \
     BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
 
+// Assemble the system matrix in a matrix with a known sparsity pattern (the stiffness blocks are loaded once, with
+// a single linear static analysis, outside the timed loop).
+#define BM_ASSEMBLY(TEST_NAME, N, NUM_THREADS)                                        \
+    BENCHMARK_TEMPLATE_DEFINE_F(SystemFixture, TEST_NAME, N)(benchmark::State & st) { \
+        m_system->SetSolver(chrono_types::make_shared<ChSolverSparseLU>());           \
+        m_system->SetNumThreads(NUM_THREADS);                                         \
+        m_system->DoStaticLinear();                                                   \
+        auto descr = m_system->GetSystemDescriptor();                                 \
+        int n = descr->CountActiveVariables() + descr->CountActiveConstraints();      \
+        ChSparsityPatternLearner pattern(n, n);                                       \
+        descr->ConvertToMatrixForm(&pattern, nullptr);                                \
+        ChSparseMatrix Z;                                                             \
+        pattern.Apply(Z);                                                             \
+        while (st.KeepRunning()) {                                                    \
+            descr->ConvertToMatrixForm(&Z, nullptr);                                  \
+        }                                                                             \
+        st.counters["SIZE"] = n;                                                      \
+    }                                                                                 \
+    BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
+
+// Load only the stiffness blocks in a matrix with a known sparsity pattern (the matrix is reset outside the timing).
+#define BM_LOAD_KBLOCKS(TEST_NAME, N, NUM_THREADS)                                    \
+    BENCHMARK_TEMPLATE_DEFINE_F(SystemFixture, TEST_NAME, N)(benchmark::State & st) { \
+        m_system->SetSolver(chrono_types::make_shared<ChSolverSparseLU>());           \
+        m_system->SetNumThreads(NUM_THREADS);                                         \
+        m_system->DoStaticLinear();                                                   \
+        auto descr = m_system->GetSystemDescriptor();                                 \
+        int n = descr->CountActiveVariables() + descr->CountActiveConstraints();      \
+        ChSparsityPatternLearner pattern(n, n);                                       \
+        descr->ConvertToMatrixForm(&pattern, nullptr);                                \
+        ChSparseMatrix Z;                                                             \
+        pattern.Apply(Z);                                                             \
+        while (st.KeepRunning()) {                                                    \
+            st.PauseTiming();                                                         \
+            Z.setZeroValues();                                                        \
+            st.ResumeTiming();                                                        \
+            descr->LoadKblocks(Z);                                                    \
+        }                                                                             \
+        st.counters["SIZE"] = n;                                                      \
+    }                                                                                 \
+    BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
+
 #ifdef CHRONO_PARDISO_MKL
 BM_SOLVER_MKL(MKL_learner_500, 500, true)
 BM_SOLVER_MKL(MKL_no_learner_500, 500, false)
@@ -225,6 +271,20 @@ BM_SOLVER_QR(QR_no_learner_4000, 4000, false)
 BM_SOLVER_QR(QR_learner_8000, 8000, true)
 BM_SOLVER_QR(QR_no_learner_8000, 8000, false)
 
+BM_ASSEMBLY(Assembly_1thread_8000, 8000, 1)
+BM_ASSEMBLY(Assembly_2threads_8000, 8000, 2)
+BM_ASSEMBLY(Assembly_4threads_8000, 8000, 4)
+BM_ASSEMBLY(Assembly_1thread_32000, 32000, 1)
+BM_ASSEMBLY(Assembly_2threads_32000, 32000, 2)
+BM_ASSEMBLY(Assembly_4threads_32000, 32000, 4)
+
+BM_LOAD_KBLOCKS(LoadKblocks_1thread_8000, 8000, 1)
+BM_LOAD_KBLOCKS(LoadKblocks_2threads_8000, 8000, 2)
+BM_LOAD_KBLOCKS(LoadKblocks_4threads_8000, 8000, 4)
+BM_LOAD_KBLOCKS(LoadKblocks_1thread_32000, 32000, 1)
+BM_LOAD_KBLOCKS(LoadKblocks_2threads_32000, 32000, 2)
+BM_LOAD_KBLOCKS(LoadKblocks_4threads_32000, 32000, 4)
+
 int main(int argc, char* argv[]) {
     ::benchmark::Initialize(&argc, argv);
     ::benchmark::RunSpecifiedBenchmarks();
@@ -0,0 +1,129 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Chrono::Multicore benchmark for the broadphase on a mixed-scale scene: small
+// granular particles on a large ground plate, next to a long conveyor and a set
+// of large guide plates. The broadphase grid bin size is set from the particle
+// size, so that each large shape overlaps a very large number of bins.
+// Compares the uniform grid broadphase and the hybrid grid / AABB-tree
+// broadphase (time spent in the broadphase, number of bin - shape AABB
+// intersections, and number of shapes stored in the tree).
+//
+// The global reference frame has Z up.
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/utils/ChUtilsCreators.h"
+#include "chrono/utils/ChUtilsGenerators.h"
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+template <bool HYBRID>
+class MixedScaleTest : public utils::ChBenchmarkTest {
+  public:
+    MixedScaleTest();
+    ~MixedScaleTest() { delete m_system; }
+
+    virtual ChSystem* GetSystem() override { return m_system; }
+    virtual void ExecuteStep() override {
+        m_system->DoStepDynamics(m_step);
+        m_time_broad += m_system->GetTimerCollisionBroad();
+    }
+
+    void ResetTimers() { m_time_broad = 0; }
+    double GetTimeBroad() const { return m_time_broad; }
+    unsigned int GetNumParticles() const { return m_num_particles; }
+
+  private:
+    ChSystemMulticoreSMC* m_system;
+    double m_step;
+    double m_time_broad;
+    unsigned int m_num_particles;
+};
+
+template <bool HYBRID>
+MixedScaleTest<HYBRID>::MixedScaleTest()
+    : m_system(new ChSystemMulticoreSMC), m_step(1e-4), m_time_broad(0), m_num_particles(0) {
+    double radius = 0.01;
+
+    m_system->Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    m_system->GetSettings()->solver.max_iteration_bilateral = 0;
+    m_system->GetSettings()->collision.narrowphase_algorithm = collision::ChNarrowphase::Algorithm::HYBRID;
+    m_system->GetSettings()->collision.broadphase_grid = collision::ChBroadphase::GridType::FIXED_BIN_SIZE;
+    m_system->GetSettings()->collision.bin_size = real3(4 * radius, 4 * radius, 4 * radius);
+    m_system->GetSettings()->collision.broadphase_hybrid = HYBRID;
+    m_system->GetSettings()->collision.broadphase_hybrid_max_bins = 64;
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetYoungModulus(2e6f);
+    mat->SetFriction(0.4f);
+    mat->SetRestitution(0.1f);
+
+    // Large ground plate, long conveyor, and guide plates (all fixed)
+    auto ground = std::shared_ptr<ChBody>(m_system->NewBody());
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), mat, ChVector<>(4, 4, 0.05), ChVector<>(0, 0, -0.05));
+    utils::AddBoxGeometry(ground.get(), mat, ChVector<>(3.5, 0.2, 0.02), ChVector<>(0, 1, 0.3));
+    for (int i = 0; i < 8; i++)
+        utils::AddBoxGeometry(ground.get(), mat, ChVector<>(0.01, 1.5, 0.2), ChVector<>(-3.5 + i, -2, 0.2));
+    ground->GetCollisionModel()->BuildModel();
+    m_system->AddBody(ground);
+
+    // Layers of small particles
+    double r = 1.01 * radius;
+    utils::PDSampler<double> sampler(2 * r);
+    utils::Generator gen(m_system);
+    std::shared_ptr<utils::MixtureIngredient> m1 = gen.AddMixtureIngredient(utils::MixtureType::SPHERE, 1.0);
+    m1->setDefaultMaterial(mat);
+    m1->setDefaultDensity(2000);
+    m1->setDefaultSize(radius);
+
+    ChVector<> range(1.0, 1.0, 0);
+    ChVector<> center(0, -0.5, 2 * r);
+    for (int il = 0; il < 4; il++) {
+        gen.CreateObjectsBox(sampler, center, range);
+        center.z() += 2 * r;
+    }
+    m_num_particles = gen.getTotalNumBodies();
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 100  // number of steps for hot start
+#define NUM_SIM_STEPS 200   // number of simulation steps for benchmarking
+
+template <bool HYBRID>
+static void MixedScale(benchmark::State& st) {
+    MixedScaleTest<HYBRID> test;
+    test.Simulate(NUM_SKIP_STEPS);
+    test.ResetTimers();
+    for (auto _ : st) {
+        test.Simulate(NUM_SIM_STEPS);
+    }
+    auto sys = static_cast<ChSystemMulticore*>(test.GetSystem());
+    const auto& cd_data = sys->data_manager->cd_data;
+    st.counters["broad_ms"] = 1e3 * test.GetTimeBroad() / NUM_SIM_STEPS;
+    st.counters["bin_intersections"] = cd_data->num_bin_aabb_intersections;
+    st.counters["tree_shapes"] = (double)cd_data->tree_shapes.size();
+    st.counters["particles"] = test.GetNumParticles();
+}
+BENCHMARK_TEMPLATE(MixedScale, false)->Unit(benchmark::kMillisecond)->Iterations(1)->UseRealTime();
+BENCHMARK_TEMPLATE(MixedScale, true)->Unit(benchmark::kMillisecond)->Iterations(1)->UseRealTime();
@@ -0,0 +1,122 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Chrono::Multicore benchmark for the narrowphase on a granular scene: a mix
+// of spheres and boxes settling in a box container. Compares the scalar
+// narrowphase dispatch and the batched narrowphase (time spent in the
+// narrowphase and contact throughput).
+//
+// The global reference frame has Z up.
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/utils/ChUtilsCreators.h"
+#include "chrono/utils/ChUtilsGenerators.h"
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+template <bool BATCHED>
+class GranularMixTest : public utils::ChBenchmarkTest {
+  public:
+    GranularMixTest();
+    ~GranularMixTest() { delete m_system; }
+
+    virtual ChSystem* GetSystem() override { return m_system; }
+    virtual void ExecuteStep() override {
+        m_system->DoStepDynamics(m_step);
+        m_time_narrow += m_system->GetTimerCollisionNarrow();
+        m_num_contacts += m_system->GetNcontacts();
+    }
+
+    void ResetTimers() {
+        m_time_narrow = 0;
+        m_num_contacts = 0;
+    }
+    double GetTimeNarrow() const { return m_time_narrow; }
+    double GetNumContacts() const { return m_num_contacts; }
+
+  private:
+    ChSystemMulticoreNSC* m_system;
+    double m_step;
+    double m_time_narrow;
+    double m_num_contacts;
+};
+
+template <bool BATCHED>
+GranularMixTest<BATCHED>::GranularMixTest()
+    : m_system(new ChSystemMulticoreNSC), m_step(1e-3), m_time_narrow(0), m_num_contacts(0) {
+    double radius = 0.02;
+
+    m_system->Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    m_system->GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    m_system->GetSettings()->solver.max_iteration_normal = 0;
+    m_system->GetSettings()->solver.max_iteration_sliding = 50;
+    m_system->GetSettings()->solver.max_iteration_spinning = 0;
+    m_system->GetSettings()->solver.max_iteration_bilateral = 0;
+    m_system->GetSettings()->collision.collision_envelope = 0.05 * radius;
+    m_system->GetSettings()->collision.narrowphase_algorithm = collision::ChNarrowphase::Algorithm::HYBRID;
+    m_system->GetSettings()->collision.narrowphase_batched = BATCHED;
+    m_system->GetSettings()->collision.bins_per_axis = vec3(20, 20, 10);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    utils::CreateBoxContainer(m_system, -1, mat, ChVector<>(0.5, 0.5, 0.4), 0.05, ChVector<>(0, 0, 0),
+                              QUNIT, true, false, true, false);
+
+    // Mixture of spheres and boxes (3:1)
+    double r = 1.01 * radius;
+    utils::PDSampler<double> sampler(2 * r);
+    utils::Generator gen(m_system);
+    std::shared_ptr<utils::MixtureIngredient> m1 = gen.AddMixtureIngredient(utils::MixtureType::SPHERE, 0.75);
+    m1->setDefaultMaterial(mat);
+    m1->setDefaultDensity(2000);
+    m1->setDefaultSize(radius);
+    std::shared_ptr<utils::MixtureIngredient> m2 = gen.AddMixtureIngredient(utils::MixtureType::BOX, 0.25);
+    m2->setDefaultMaterial(mat);
+    m2->setDefaultDensity(2000);
+    m2->setDefaultSize(ChVector<>(0.8 * radius, 0.6 * radius, 0.7 * radius));
+
+    ChVector<> range(0.45, 0.45, 0);
+    ChVector<> center(0, 0, 2 * r);
+    for (int il = 0; il < 8; il++) {
+        gen.CreateObjectsBox(sampler, center, range);
+        center.z() += 2 * r;
+    }
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 200  // number of steps for hot start
+#define NUM_SIM_STEPS 100   // number of simulation steps for benchmarking
+
+template <bool BATCHED>
+static void GranularMix(benchmark::State& st) {
+    GranularMixTest<BATCHED> test;
+    test.Simulate(NUM_SKIP_STEPS);
+    test.ResetTimers();
+    for (auto _ : st) {
+        test.Simulate(NUM_SIM_STEPS);
+    }
+    st.counters["narrow_ms"] = 1e3 * test.GetTimeNarrow() / NUM_SIM_STEPS;
+    st.counters["contacts"] = test.GetNumContacts() / NUM_SIM_STEPS;
+    st.counters["contacts_per_ms"] = test.GetNumContacts() / (1e3 * test.GetTimeNarrow());
+}
+BENCHMARK_TEMPLATE(GranularMix, false)->Unit(benchmark::kMillisecond)->Iterations(1)->UseRealTime();
+BENCHMARK_TEMPLATE(GranularMix, true)->Unit(benchmark::kMillisecond)->Iterations(1)->UseRealTime();
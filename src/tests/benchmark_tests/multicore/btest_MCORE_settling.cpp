@@ -13,6 +13,11 @@
 // =============================================================================
 //
 // Chrono::Multicore benchmark program using SMC method for frictional contact.
+// The settling test is also run with the NSC method, comparing the assembled,
+// the matrix-free, and the mixed-precision Schur complement products (time spent
+// assembling the solver matrices, time spent in Schur products, and memory used
+// by the solver matrices). An accuracy report compares the mixed-precision and
+// the double-precision solutions of the same settling problem.
 //
 // The global reference frame has Z up.
 // =============================================================================
@@ -25,6 +30,7 @@
 
 // =============================================================================
 
+#include <algorithm>
 #include <cstdio>
 
 #include "chrono/ChConfig.h"
@@ -38,6 +44,57 @@
 
 using namespace chrono;
 
+// Create a fixed bin and granular material in layers. Return the number of particles.
+static unsigned int CreateContainer(ChSystemMulticore* sys, std::shared_ptr<ChMaterialSurface> mat, double radius) {
+    // Container half-dimensions
+    ChVector<> hdim(2, 2, 0.5);
+    double hthick = 0.1;
+
+    // Create a bin consisting of five boxes attached to the ground.
+    auto bin = std::shared_ptr<ChBody>(sys->NewBody());
+    bin->SetMass(1);
+    bin->SetPos(ChVector<>(0, 0, 0));
+    bin->SetCollide(true);
+    bin->SetBodyFixed(true);
+
+    bin->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hdim.x(), hdim.y(), hthick), ChVector<>(0, 0, -hthick));
+    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hthick, hdim.y(), hdim.z()),
+                          ChVector<>(-hdim.x() - hthick, 0, hdim.z()));
+    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hthick, hdim.y(), hdim.z()),
+                          ChVector<>(hdim.x() + hthick, 0, hdim.z()));
+    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hdim.x(), hthick, hdim.z()),
+                          ChVector<>(0, -hdim.y() - hthick, hdim.z()));
+    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hdim.x(), hthick, hdim.z()),
+                          ChVector<>(0, hdim.y() + hthick, hdim.z()));
+    bin->GetCollisionModel()->BuildModel();
+
+    sys->AddBody(bin);
+
+    // Create granular material in layers
+    double rho = 2000;
+    int num_layers = 8;
+
+    // Create a particle generator and a mixture entirely made out of spheres
+    double r = 1.01 * radius;
+    utils::PDSampler<double> sampler(2 * r);
+    utils::Generator gen(sys);
+    std::shared_ptr<utils::MixtureIngredient> m1 = gen.AddMixtureIngredient(utils::MixtureType::SPHERE, 1.0);
+    m1->setDefaultMaterial(mat);
+    m1->setDefaultDensity(rho);
+    m1->setDefaultSize(radius);
+
+    // Create particles in layers until reaching the desired number of particles
+    ChVector<> range(hdim.x() - r, hdim.y() - r, 0);
+    ChVector<> center(0, 0, 2 * r);
+    for (int il = 0; il < num_layers; il++) {
+        gen.CreateObjectsBox(sampler, center, range);
+        center.z() += 2 * r;
+    }
+
+    return gen.getTotalNumBodies();
+}
+
 class SettlingSMC : public utils::ChBenchmarkTest {
   public:
     SettlingSMC();
@@ -88,54 +145,7 @@ SettlingSMC::SettlingSMC() : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
     mat->SetRestitution(cr);
     mat->SetAdhesion(0);
 
-    // Container half-dimensions
-    ChVector<> hdim(2, 2, 0.5);
-    double hthick = 0.1;
-
-    // Create a bin consisting of five boxes attached to the ground.
-    auto bin = std::shared_ptr<ChBody>(m_system->NewBody());
-    bin->SetMass(1);
-    bin->SetPos(ChVector<>(0, 0, 0));
-    bin->SetCollide(true);
-    bin->SetBodyFixed(true);
-
-    bin->GetCollisionModel()->ClearModel();
-    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hdim.x(), hdim.y(), hthick), ChVector<>(0, 0, -hthick));
-    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hthick, hdim.y(), hdim.z()),
-                          ChVector<>(-hdim.x() - hthick, 0, hdim.z()));
-    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hthick, hdim.y(), hdim.z()),
-                          ChVector<>(hdim.x() + hthick, 0, hdim.z()));
-    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hdim.x(), hthick, hdim.z()),
-                          ChVector<>(0, -hdim.y() - hthick, hdim.z()));
-    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hdim.x(), hthick, hdim.z()),
-                          ChVector<>(0, hdim.y() + hthick, hdim.z()));
-    bin->GetCollisionModel()->BuildModel();
-
-    m_system->AddBody(bin);
-
-    // Create granular material in layers
-    double rho = 2000;
-    double radius = 0.02;
-    int num_layers = 8;
-
-    // Create a particle generator and a mixture entirely made out of spheres
-    double r = 1.01 * radius;
-    utils::PDSampler<double> sampler(2 * r);
-    utils::Generator gen(m_system);
-    std::shared_ptr<utils::MixtureIngredient> m1 = gen.AddMixtureIngredient(utils::MixtureType::SPHERE, 1.0);
-    m1->setDefaultMaterial(mat);
-    m1->setDefaultDensity(rho);
-    m1->setDefaultSize(radius);
-
-    // Create particles in layers until reaching the desired number of particles
-    ChVector<> range(hdim.x() - r, hdim.y() - r, 0);
-    ChVector<> center(0, 0, 2 * r);
-    for (int il = 0; il < num_layers; il++) {
-        gen.CreateObjectsBox(sampler, center, range);
-        center.z() += 2 * r;
-    }
-
-    m_num_particles = gen.getTotalNumBodies();
+    m_num_particles = CreateContainer(m_system, mat, 0.02);
 }
 
 // Run settling simulation with visualization
@@ -159,6 +169,78 @@ void SettlingSMC::SimulateVis() {
 
 // =============================================================================
 
+// Evaluation of the Schur complement product in the NSC settling test.
+enum class ShurType { ASSEMBLED, MATRIX_FREE, MIXED_PRECISION };
+
+// Settling test using the NSC method, with the specified evaluation of the Schur complement product.
+template <ShurType SHUR>
+class SettlingNSC : public utils::ChBenchmarkTest {
+  public:
+    SettlingNSC();
+    ~SettlingNSC() { delete m_system; }
+
+    virtual ChSystem* GetSystem() override { return m_system; }
+    virtual void ExecuteStep() override {
+        m_system->DoStepDynamics(m_step);
+        m_time_matrices += m_system->data_manager->system_timer.GetTime("ChIterativeSolverMulticore_Matrices");
+        m_time_shur += m_system->data_manager->system_timer.GetTime("ShurProduct");
+    }
+
+    void ResetTimers() {
+        m_time_matrices = 0;
+        m_time_shur = 0;
+    }
+    double GetTimeMatrices() const { return m_time_matrices; }
+    double GetTimeShur() const { return m_time_shur; }
+
+    /// Memory (in bytes) used by the solver matrices and by the matrix-free contact data.
+    double GetSolverMemory() const {
+        const auto& host_data = m_system->data_manager->host_data;
+        size_t nnz = host_data.D_T.nonZeros() + host_data.D.nonZeros() + host_data.M_invD.nonZeros();
+        return (double)(nnz * (sizeof(real) + sizeof(size_t)) +
+                        m_system->data_manager->rigid_rigid->GetMatrixFreeMemory());
+    }
+
+    ChSystemMulticoreNSC* GetSystemNSC() const { return m_system; }
+    double GetStep() const { return m_step; }
+
+  private:
+    ChSystemMulticoreNSC* m_system;
+    double m_step;
+    double m_time_matrices;
+    double m_time_shur;
+};
+
+template <ShurType SHUR>
+SettlingNSC<SHUR>::SettlingNSC()
+    : m_system(new ChSystemMulticoreNSC), m_step(1e-3), m_time_matrices(0), m_time_shur(0) {
+    double radius = 0.02;
+
+    m_system->Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    // Set solver parameters
+    m_system->GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    m_system->GetSettings()->solver.max_iteration_normal = 0;
+    m_system->GetSettings()->solver.max_iteration_sliding = 100;
+    m_system->GetSettings()->solver.max_iteration_spinning = 0;
+    m_system->GetSettings()->solver.max_iteration_bilateral = 0;
+    m_system->GetSettings()->solver.tolerance = 1e-3;
+    m_system->GetSettings()->solver.alpha = 0;
+    m_system->GetSettings()->solver.contact_recovery_speed = 10;
+    m_system->GetSettings()->solver.matrix_free = (SHUR == ShurType::MATRIX_FREE);
+    m_system->GetSettings()->solver.mixed_precision = (SHUR == ShurType::MIXED_PRECISION);
+    m_system->ChangeSolverType(SolverType::APGD);
+
+    m_system->GetSettings()->collision.collision_envelope = 0.1 * radius;
+    m_system->GetSettings()->collision.narrowphase_algorithm = collision::ChNarrowphase::Algorithm::HYBRID;
+    m_system->GetSettings()->collision.bins_per_axis = vec3(10, 10, 1);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    CreateContainer(m_system, mat, radius);
+}
+
 #define NUM_SKIP_STEPS 500  // number of steps for hot start
 #define NUM_SIM_STEPS 500   // number of simulation steps for benchmarking
 
@@ -182,6 +264,78 @@ BENCHMARK_REGISTER_F(TEST_NAME, Settle)
     ->UseRealTime()
     ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
 
+template <ShurType SHUR>
+static void SettleNSC(benchmark::State& st) {
+    SettlingNSC<SHUR> test;
+    test.Simulate(NUM_SKIP_STEPS);
+    test.ResetTimers();
+    for (auto _ : st) {
+        test.Simulate(NUM_SIM_STEPS);
+    }
+    st.counters["matrices_ms"] = 1e3 * test.GetTimeMatrices() / NUM_SIM_STEPS;
+    st.counters["shur_ms"] = 1e3 * test.GetTimeShur() / NUM_SIM_STEPS;
+    st.counters["memory_MB"] = test.GetSolverMemory() / (1024 * 1024);
+}
+BENCHMARK_TEMPLATE(SettleNSC, ShurType::ASSEMBLED)->Unit(benchmark::kMillisecond)->Iterations(1)->UseRealTime();
+BENCHMARK_TEMPLATE(SettleNSC, ShurType::MATRIX_FREE)->Unit(benchmark::kMillisecond)->Iterations(1)->UseRealTime();
+BENCHMARK_TEMPLATE(SettleNSC, ShurType::MIXED_PRECISION)->Unit(benchmark::kMillisecond)->Iterations(1)->UseRealTime();
+
+// Accuracy report for the mixed-precision Schur products.
+// The double-precision and mixed-precision systems are advanced in lockstep; at each step the contact forces on the
+// bin and the solver residuals are compared. The particle positions are compared at the end of the simulation.
+static void SettleNSCAccuracy(benchmark::State& st) {
+    SettlingNSC<ShurType::ASSEMBLED> test_d;
+    SettlingNSC<ShurType::MIXED_PRECISION> test_m;
+    auto sys_d = test_d.GetSystemNSC();
+    auto sys_m = test_m.GetSystemNSC();
+    double step = test_d.GetStep();
+
+    double max_force_err = 0;
+    double sum_force_err = 0;
+    double sum_res_d = 0;
+    double sum_res_m = 0;
+    int num_steps = 0;
+    for (auto _ : st) {
+        for (int i = 0; i < NUM_SKIP_STEPS + NUM_SIM_STEPS; i++) {
+            sys_d->DoStepDynamics(step);
+            sys_m->DoStepDynamics(step);
+            sum_res_d += sys_d->data_manager->measures.solver.residual;
+            sum_res_m += sys_m->data_manager->measures.solver.residual;
+
+            sys_d->CalculateContactForces();
+            sys_m->CalculateContactForces();
+            real3 frc_d = sys_d->GetBodyContactForce(0);
+            real3 frc_m = sys_m->GetBodyContactForce(0);
+            double frc_norm = Length(frc_d);
+            if (frc_norm > 0) {
+                double err = Length(frc_m - frc_d) / frc_norm;
+                max_force_err = std::max(max_force_err, err);
+                sum_force_err += err;
+            }
+            num_steps++;
+        }
+    }
+
+    // Particle position differences, relative to the particle radius
+    const auto& pos_d = sys_d->data_manager->host_data.pos_rigid;
+    const auto& pos_m = sys_m->data_manager->host_data.pos_rigid;
+    double max_pos_err = 0;
+    double sum_pos_err = 0;
+    for (size_t i = 0; i < pos_d.size(); i++) {
+        double err = Length(pos_m[i] - pos_d[i]) / 0.02;  // particle radius
+        max_pos_err = std::max(max_pos_err, err);
+        sum_pos_err += err;
+    }
+
+    st.counters["force_err_max"] = max_force_err;
+    st.counters["force_err_avg"] = sum_force_err / num_steps;
+    st.counters["pos_err_max"] = max_pos_err;
+    st.counters["pos_err_avg"] = sum_pos_err / pos_d.size();
+    st.counters["residual_double"] = sum_res_d / num_steps;
+    st.counters["residual_mixed"] = sum_res_m / num_steps;
+}
+BENCHMARK(SettleNSCAccuracy)->Unit(benchmark::kMillisecond)->Iterations(1)->UseRealTime();
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
@@ -15,6 +15,7 @@
 
 #include "chrono/core/ChTimer.h"
 #include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChLinkTSDA.h"
 
 using namespace chrono;
 
@@ -99,4 +100,92 @@ BENCHMARK_DEFINE_F(SystemFixture, SingleLoop)(benchmark::State& st) {
 BENCHMARK_REGISTER_F(SystemFixture, SingleLoop)->Unit(benchmark::kMicrosecond);
 ////BENCHMARK_REGISTER_F(SystemFixture, SingleLoop)->Unit(benchmark::kMicrosecond)->Iterations(1);
 
+// -----------------------------------------------------------------------------
+
+// Benchmarking fixture for the assembly-level state functions: create a system with the specified number of bodies
+// (first argument), connected in a chain by spring links, and use the specified number of threads (second argument)
+// for the parallel update of bodies and links.
+class AssemblyFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        int num_bodies = (int)st.range(0);
+        int num_threads = (int)st.range(1);
+
+        sys = new ChSystemNSC();
+        sys->SetNumThreads(num_threads, 1, 1);
+        sys->EnableParallelUpdate(num_threads > 1);
+
+        std::shared_ptr<ChBody> prev;
+        for (int i = 0; i < num_bodies; i++) {
+            auto body = chrono_types::make_shared<ChBody>();
+            body->SetPos(ChVector<>(i * 0.1, rand() % 1000 / 1000.0, rand() % 1000 / 1000.0));
+            body->SetWvel_loc(ChVector<>(rand() % 1000 / 1000.0, 0, 0));
+            sys->AddBody(body);
+            if (prev) {
+                auto spring = chrono_types::make_shared<ChLinkTSDA>();
+                spring->Initialize(prev, body, true, ChVector<>(0, 0, 0), ChVector<>(0, 0, 0), false, 0.1);
+                spring->SetSpringCoefficient(100);
+                spring->SetDampingCoefficient(1);
+                sys->AddLink(spring);
+            }
+            prev = body;
+        }
+
+        sys->Setup();
+        sys->Update();
+
+        x.setZero(sys->GetNcoords_x(), sys);
+        v.setZero(sys->GetNcoords_v(), sys);
+        R.setZero(sys->GetNcoords_v());
+        sys->StateGather(x, v, T);
+    }
+
+    void TearDown(const ::benchmark::State&) override { delete sys; }
+
+    ChSystemNSC* sys;
+    ChState x;
+    ChStateDelta v;
+    ChVectorDynamic<> R;
+    double T;
+};
+
+static void AssemblyArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"bodies", "threads"});
+    for (int num_bodies : {1000, 10000, 100000})
+        for (int num_threads : {1, 2, 4, 8})
+            b->Args({num_bodies, num_threads});
+}
+
+BENCHMARK_DEFINE_F(AssemblyFixture, Update)(benchmark::State& st) {
+    for (auto _ : st) {
+        sys->Update(false);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_bodylist().size());
+}
+BENCHMARK_REGISTER_F(AssemblyFixture, Update)->Apply(AssemblyArgs)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(AssemblyFixture, StateScatter)(benchmark::State& st) {
+    for (auto _ : st) {
+        sys->StateScatter(x, v, T, false);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_bodylist().size());
+}
+BENCHMARK_REGISTER_F(AssemblyFixture, StateScatter)->Apply(AssemblyArgs)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(AssemblyFixture, LoadResidual_F)(benchmark::State& st) {
+    for (auto _ : st) {
+        sys->LoadResidual_F(R, 1.0);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_bodylist().size());
+}
+BENCHMARK_REGISTER_F(AssemblyFixture, LoadResidual_F)->Apply(AssemblyArgs)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(AssemblyFixture, LoadResidual_Mv)(benchmark::State& st) {
+    for (auto _ : st) {
+        sys->LoadResidual_Mv(R, v, 1.0);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_bodylist().size());
+}
+BENCHMARK_REGISTER_F(AssemblyFixture, LoadResidual_Mv)->Apply(AssemblyArgs)->Unit(benchmark::kMicrosecond);
+
 ////BENCHMARK_MAIN();
@@ -0,0 +1,131 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark for the state gather/scatter functions on a granular (debris)
+// system: a pile of many small spheres on a fixed ground. These functions are
+// called by the integrators at every step and, for such systems, are dominated
+// by the traversal of the body list. The benchmarks are run with and without
+// the parallel update of bodies, and with and without the body state block
+// (structure-of-arrays storage of the body states).
+//
+// =============================================================================
+
+#include <benchmark/benchmark.h>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+using namespace chrono;
+
+// Benchmarking fixture: create a pile of spheres with the specified number of particles (first argument), use the
+// specified number of threads (second argument) for the parallel update of bodies, and enable the body state block if
+// the third argument is not zero.
+class GranularFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        int num_particles = (int)st.range(0);
+        int num_threads = (int)st.range(1);
+        bool state_block = st.range(2) != 0;
+
+        sys = new ChSystemNSC();
+        sys->SetNumThreads(num_threads, 1, 1);
+        sys->EnableParallelUpdate(num_threads > 1);
+        sys->EnableBodyStateBlock(state_block);
+
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+        auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, false, true, mat);
+        ground->SetPos(ChVector<>(0, -0.5, 0));
+        ground->SetBodyFixed(true);
+        sys->AddBody(ground);
+
+        // Layers of 50x50 particles, with a small perturbation of the lattice positions
+        double radius = 0.05;
+        int num_side = 50;
+        for (int i = 0; i < num_particles; i++) {
+            int ix = i % num_side;
+            int iz = (i / num_side) % num_side;
+            int iy = i / (num_side * num_side);
+            ChVector<> pos(2.1 * radius * (ix - num_side / 2) + 0.01 * radius * (rand() % 100),
+                           radius + 2.1 * radius * iy,
+                           2.1 * radius * (iz - num_side / 2) + 0.01 * radius * (rand() % 100));
+            auto particle = chrono_types::make_shared<ChBodyEasySphere>(radius, 2500, false, true, mat);
+            particle->SetPos(pos);
+            particle->SetPos_dt(ChVector<>(0, -0.1 * (rand() % 100) / 100.0, 0));
+            sys->AddBody(particle);
+        }
+
+        sys->Setup();
+        sys->Update();
+
+        x.setZero(sys->GetNcoords_x(), sys);
+        v.setZero(sys->GetNcoords_v(), sys);
+        x_new.setZero(sys->GetNcoords_x(), sys);
+        Dv.setZero(sys->GetNcoords_v(), sys);
+        Dv.setConstant(1e-6);
+        sys->StateGather(x, v, T);
+    }
+
+    void TearDown(const ::benchmark::State&) override { delete sys; }
+
+    ChSystemNSC* sys;
+    ChState x;
+    ChStateDelta v;
+    ChState x_new;
+    ChStateDelta Dv;
+    double T;
+};
+
+static void GranularArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"particles", "threads", "block"});
+    for (int num_particles : {10000, 50000})
+        for (int num_threads : {1, 2, 4, 8})
+            for (int state_block : {0, 1})
+                b->Args({num_particles, num_threads, state_block});
+}
+
+BENCHMARK_DEFINE_F(GranularFixture, StateGather)(benchmark::State& st) {
+    for (auto _ : st) {
+        sys->StateGather(x, v, T);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_bodylist().size());
+}
+BENCHMARK_REGISTER_F(GranularFixture, StateGather)->Apply(GranularArgs)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(GranularFixture, StateScatter)(benchmark::State& st) {
+    for (auto _ : st) {
+        sys->StateScatter(x, v, T, true);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_bodylist().size());
+}
+BENCHMARK_REGISTER_F(GranularFixture, StateScatter)->Apply(GranularArgs)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(GranularFixture, StateIncrementX)(benchmark::State& st) {
+    for (auto _ : st) {
+        sys->StateIncrementX(x_new, x, Dv);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_bodylist().size());
+}
+BENCHMARK_REGISTER_F(GranularFixture, StateIncrementX)->Apply(GranularArgs)->Unit(benchmark::kMicrosecond);
+
+// Gather, increment, and scatter the states, as done by the integrators at each step
+BENCHMARK_DEFINE_F(GranularFixture, GatherScatter)(benchmark::State& st) {
+    for (auto _ : st) {
+        sys->StateGather(x, v, T);
+        sys->StateIncrementX(x_new, x, Dv);
+        sys->StateScatter(x_new, v, T, true);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_bodylist().size());
+}
+BENCHMARK_REGISTER_F(GranularFixture, GatherScatter)->Apply(GranularArgs)->Unit(benchmark::kMicrosecond);
@@ -13,15 +13,25 @@
 // =============================================================================
 //
 // Benchmark test for contact simulation using NSC contact.
+// Also includes a benchmark of the NSC contact container storage (contact
+// insertion and traversal) for large numbers of contacts, comparing the
+// contact pools with the previous std::list storage, and a thread scaling
+// benchmark of the parallel (colored) PSOR solver.
 //
 // =============================================================================
 
+#include <list>
+#include <vector>
+
 #include "chrono/ChConfig.h"
 #include "chrono/utils/ChBenchmark.h"
 
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChBodyEasy.h"
 #include "chrono/physics/ChLinkMotorRotationSpeed.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChSolverPSOR.h"
 
 #include "chrono/assets/ChColorAsset.h"
 
@@ -127,6 +137,18 @@ void MixerTestNSC<N>::SimulateVis() {
 #endif
 }
 
+// Same mixer model, solved with the PSOR solver in parallel (colored) mode using the specified number of threads.
+template <int N, int NTHREADS>
+class MixerTestNSCColored : public MixerTestNSC<N> {
+  public:
+    MixerTestNSCColored() {
+        auto solver = chrono_types::make_shared<ChSolverPSOR>();
+        solver->EnableColoring(true);
+        this->GetSystem()->SetSolver(solver);
+        this->GetSystem()->SetNumThreads(NTHREADS, 1, 1);
+    }
+};
+
 // =============================================================================
 
 #define NUM_SKIP_STEPS 2000  // number of steps for hot start
@@ -135,6 +157,208 @@ void MixerTestNSC<N>::SimulateVis() {
 CH_BM_SIMULATION_LOOP(MixerNSC032, MixerTestNSC<32>,  NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(MixerNSC064, MixerTestNSC<64>,  NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 
+using MixerTestNSC064_T1 = MixerTestNSCColored<64, 1>;
+using MixerTestNSC064_T2 = MixerTestNSCColored<64, 2>;
+using MixerTestNSC064_T4 = MixerTestNSCColored<64, 4>;
+using MixerTestNSC064_T8 = MixerTestNSCColored<64, 8>;
+
+CH_BM_SIMULATION_LOOP(MixerNSC064_ColoredPSOR_T1, MixerTestNSC064_T1, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSC064_ColoredPSOR_T2, MixerTestNSC064_T2, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSC064_ColoredPSOR_T4, MixerTestNSC064_T4, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSC064_ColoredPSOR_T8, MixerTestNSC064_T8, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
+// =============================================================================
+
+// Benchmark of the NSC contact container alone. A set of N synthetic collision pairs between spheres is inserted in
+// the container (reusing the contact objects from the previous pass, as done at each step by the collision system),
+// after which all contacts are traversed as done by the solver interface and the state functions.
+static void ContactContainerNSC(benchmark::State& st) {
+    int num_contacts = (int)st.range(0);
+    int num_bodies = 1000;
+
+    ChSystemNSC sys;
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < num_bodies; i++) {
+        auto body = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+        body->SetPos(ChVector<>(i * 1.0, 0, 0));
+        sys.Add(body);
+        bodies.push_back(body);
+    }
+    sys.Setup();
+    sys.Update();
+
+    std::vector<collision::ChCollisionInfo> cinfos(num_contacts);
+    for (int i = 0; i < num_contacts; i++) {
+        auto& bA = bodies[i % num_bodies];
+        auto& bB = bodies[(i + 1 + i / num_bodies) % num_bodies];
+        cinfos[i].modelA = bA->GetCollisionModel().get();
+        cinfos[i].modelB = bB->GetCollisionModel().get();
+        cinfos[i].vpA = bA->GetPos() + ChVector<>(0.5, 0, 0);
+        cinfos[i].vpB = bB->GetPos() - ChVector<>(0.5, 0, 0);
+        cinfos[i].vN = ChVector<>(1, 0, 0);
+        cinfos[i].distance = -0.001;
+    }
+
+    auto container = std::static_pointer_cast<ChContactContainerNSC>(sys.GetContactContainer());
+    ChSystemDescriptor descriptor;
+    ChVectorDynamic<> Qc;
+
+    while (st.KeepRunning()) {
+        container->BeginAddContact();
+        for (const auto& cinfo : cinfos)
+            container->AddContact(cinfo, mat, mat);
+        container->EndAddContact();
+
+        descriptor.BeginInsertion();
+        container->InjectConstraints(descriptor);
+        descriptor.EndInsertion();
+
+        Qc.setZero(container->GetDOC_d());
+        container->IntLoadConstraint_C(0, Qc, 1.0, false, 0.1);
+        container->ConstraintsBiReset();
+        container->ConstraintsBiLoad_C(1.0, 0.1, false);
+        container->ConstraintsFetch_react(1.0);
+    }
+    st.counters["contacts"] = container->GetNcontacts();
+}
+
+BENCHMARK(ContactContainerNSC)->Unit(benchmark::kMillisecond)->Arg(10000)->Arg(100000);
+
+// Contact storage of ChContactContainerNSC (contiguous contact pool).
+template <class Tcont>
+class PoolStorage {
+  public:
+    void Begin() { pool.Rewind(); }
+    template <class Ta, class Tb>
+    void Add(ChContactContainer* container,
+             Ta* objA,
+             Tb* objB,
+             const collision::ChCollisionInfo& cinfo,
+             const ChMaterialCompositeNSC& cmat) {
+        pool.Add(container, objA, objB, cinfo, cmat);
+    }
+    void End() { pool.Trim(); }
+    typename ChContactPool<Tcont>::iterator begin() const { return pool.begin(); }
+    typename ChContactPool<Tcont>::iterator end() const { return pool.end(); }
+
+  private:
+    ChContactPool<Tcont> pool;
+};
+
+// Previous contact storage of ChContactContainerNSC (baseline): heap-allocated contacts in a std::list. Contacts are
+// reused across insertion passes through an iterator to the last reused contact; those not reused are deleted.
+template <class Tcont>
+class ListStorage {
+  public:
+    ~ListStorage() {
+        for (auto contact : list)
+            delete contact;
+    }
+    void Begin() { last = list.begin(); }
+    template <class Ta, class Tb>
+    void Add(ChContactContainer* container,
+             Ta* objA,
+             Tb* objB,
+             const collision::ChCollisionInfo& cinfo,
+             const ChMaterialCompositeNSC& cmat) {
+        if (last != list.end()) {
+            (*last)->Reset(objA, objB, cinfo, cmat);
+            last++;
+        } else {
+            list.push_back(new Tcont(container, objA, objB, cinfo, cmat));
+            last = list.end();
+        }
+    }
+    void End() {
+        while (last != list.end()) {
+            delete (*last);
+            last = list.erase(last);
+        }
+    }
+    typename std::list<Tcont*>::const_iterator begin() const { return list.begin(); }
+    typename std::list<Tcont*>::const_iterator end() const { return list.end(); }
+
+  private:
+    std::list<Tcont*> list;
+    typename std::list<Tcont*>::iterator last;
+};
+
+// Benchmark of the NSC contact storage alone, with the same synthetic collision pairs and the same sequence of
+// operations as in the ContactContainerNSC benchmark (serial traversals), for the contact pool and for the previous
+// std::list storage.
+template <template <class> class Storage>
+static void ContactStorageNSC(benchmark::State& st) {
+    using Tcont = ChContactContainerNSC::ChContactNSC_6_6;
+
+    int num_contacts = (int)st.range(0);
+    int num_bodies = 1000;
+
+    ChSystemNSC sys;
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < num_bodies; i++) {
+        auto body = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+        body->SetPos(ChVector<>(i * 1.0, 0, 0));
+        sys.Add(body);
+        bodies.push_back(body);
+    }
+    sys.Setup();
+    sys.Update();
+
+    std::vector<collision::ChCollisionInfo> cinfos(num_contacts);
+    std::vector<std::pair<ChContactable_1vars<6>*, ChContactable_1vars<6>*>> pairs(num_contacts);
+    for (int i = 0; i < num_contacts; i++) {
+        auto& bA = bodies[i % num_bodies];
+        auto& bB = bodies[(i + 1 + i / num_bodies) % num_bodies];
+        pairs[i].first = bA.get();
+        pairs[i].second = bB.get();
+        cinfos[i].modelA = bA->GetCollisionModel().get();
+        cinfos[i].modelB = bB->GetCollisionModel().get();
+        cinfos[i].vpA = bA->GetPos() + ChVector<>(0.5, 0, 0);
+        cinfos[i].vpB = bB->GetPos() - ChVector<>(0.5, 0, 0);
+        cinfos[i].vN = ChVector<>(1, 0, 0);
+        cinfos[i].distance = -0.001;
+    }
+
+    ChContactContainer* container = sys.GetContactContainer().get();
+    ChMaterialCompositionStrategy strategy;
+    Storage<Tcont> storage;
+    ChSystemDescriptor descriptor;
+    ChVectorDynamic<> Qc;
+
+    while (st.KeepRunning()) {
+        storage.Begin();
+        for (int i = 0; i < num_contacts; i++) {
+            ChMaterialCompositeNSC cmat(&strategy, mat, mat);
+            storage.Add(container, pairs[i].first, pairs[i].second, cinfos[i], cmat);
+        }
+        storage.End();
+
+        descriptor.BeginInsertion();
+        for (auto contact : storage)
+            contact->InjectConstraints(descriptor);
+        descriptor.EndInsertion();
+
+        Qc.setZero(3 * num_contacts);
+        unsigned int offset = 0;
+        for (auto contact : storage) {
+            contact->ContIntLoadConstraint_C(offset, Qc, 1.0, false, 0.1);
+            offset += 3;
+        }
+        for (auto contact : storage)
+            contact->ConstraintsBiReset();
+        for (auto contact : storage)
+            contact->ConstraintsBiLoad_C(1.0, 0.1, false);
+        for (auto contact : storage)
+            contact->ConstraintsFetch_react(1.0);
+    }
+    st.counters["contacts"] = num_contacts;
+}
+
+BENCHMARK_TEMPLATE(ContactStorageNSC, PoolStorage)->Unit(benchmark::kMillisecond)->Arg(10000)->Arg(100000);
+BENCHMARK_TEMPLATE(ContactStorageNSC, ListStorage)->Unit(benchmark::kMillisecond)->Arg(10000)->Arg(100000);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
@@ -0,0 +1,123 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for resting contact (stacks of boxes) using NSC contact.
+// Compares the PSOR solver without warm start, with warm start from the
+// collision manifolds only, and with warm start from the persistent contact
+// cache of the NSC contact container. All variants use the same solver
+// tolerance; the average number of solver iterations per step is reported.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+enum class WarmStartType { NONE, MANIFOLD, CACHE };
+
+template <int N, WarmStartType W>
+class StackTestNSC : public utils::ChBenchmarkTest {
+  public:
+    StackTestNSC();
+    ~StackTestNSC() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override {
+        m_system->DoStepDynamics(m_step);
+        m_iterations += m_solver->GetIterations();
+        m_steps++;
+    }
+
+    void ResetIterations() {
+        m_iterations = 0;
+        m_steps = 0;
+    }
+    double GetAverageIterations() const { return m_steps > 0 ? (double)m_iterations / m_steps : 0; }
+
+  private:
+    ChSystemNSC* m_system;
+    std::shared_ptr<ChSolverPSOR> m_solver;
+    double m_step;
+    long m_iterations;
+    long m_steps;
+};
+
+template <int N, WarmStartType W>
+StackTestNSC<N, W>::StackTestNSC() : m_system(new ChSystemNSC()), m_step(1e-3), m_iterations(0), m_steps(0) {
+    m_system->Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    m_solver = chrono_types::make_shared<ChSolverPSOR>();
+    m_solver->SetMaxIterations(500);
+    m_solver->SetTolerance(1e-6);
+    m_solver->EnableWarmStart(W != WarmStartType::NONE);
+    m_system->SetSolver(m_solver);
+
+    auto container = std::static_pointer_cast<ChContactContainerNSC>(m_system->GetContactContainer());
+    container->EnableContactCache(W == WarmStartType::CACHE);
+    container->SetContactCacheTolerance(0.02);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.6f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    m_system->Add(ground);
+
+    // 4x4 stacks of N boxes each
+    for (int ix = 0; ix < 4; ix++) {
+        for (int iz = 0; iz < 4; iz++) {
+            for (int iy = 0; iy < N; iy++) {
+                auto box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, false, true, mat);
+                box->SetPos(ChVector<>(-3 + 2.0 * ix, 0.25 + 0.5 * iy, -3 + 2.0 * iz));
+                m_system->Add(box);
+            }
+        }
+    }
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 500  // number of steps for settling the stacks
+#define NUM_SIM_STEPS 500   // number of simulation steps for each benchmark
+
+template <int N, WarmStartType W>
+static void StackNSC(benchmark::State& st) {
+    StackTestNSC<N, W> test;
+    test.Simulate(NUM_SKIP_STEPS);
+    test.ResetIterations();
+    for (auto _ : st) {
+        test.Simulate(NUM_SIM_STEPS);
+    }
+    auto container = std::static_pointer_cast<ChContactContainerNSC>(test.GetSystem()->GetContactContainer());
+    st.counters["iterations"] = test.GetAverageIterations();
+    st.counters["contacts"] = container->GetNcontacts();
+    st.counters["cached"] = container->GetNumCachedContacts();
+}
+
+BENCHMARK_TEMPLATE(StackNSC, 10, WarmStartType::NONE)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(StackNSC, 10, WarmStartType::MANIFOLD)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(StackNSC, 10, WarmStartType::CACHE)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(StackNSC, 20, WarmStartType::NONE)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(StackNSC, 20, WarmStartType::MANIFOLD)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(StackNSC, 20, WarmStartType::CACHE)->Unit(benchmark::kMillisecond);
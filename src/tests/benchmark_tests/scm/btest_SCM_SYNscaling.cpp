@@ -20,6 +20,11 @@
 // - demo_VEH_DeformableSoilAndTire
 // - demo_VEH_HMMWV_DefSoil
 //
+// For a thread scaling curve, run with a fixed number of ranks and 1, 2, 4, ...
+// SCM threads (-n). Each run appends a line to 'stats_<ranks>_<threads>.out'
+// with the average ray testing and ray casting times per step (ms) on rank 0,
+// followed by the RTF of all ranks.
+//
 // =============================================================================
 
 #include "chrono/physics/ChSystemSMC.h"
@@ -348,6 +353,8 @@ int main(int argc, char* argv[]) {
     int step_number = 0;
 
     double chrono_step = 0;
+    double raytest = 0;
+    double raycast = 0;
 
     ChTimer<> timer;
     timer.start();
@@ -370,6 +377,8 @@ int main(int argc, char* argv[]) {
                 if (node_id == 0) {
                     std::string fname = "stats_" + std::to_string(num_nodes) + "_" + std::to_string(nthreads) + ".out";
                     std::ofstream ofile(fname.c_str(), std::ios_base::app);
+                    int nsteps = (int)(end_time / step_size);
+                    ofile << raytest / nsteps << "  " << raycast / nsteps << "  ";
                     for (int i = 0; i < num_nodes; i++)
                         ofile << all_rtf[i] << "  ";
                     ofile << endl;
@@ -436,6 +445,8 @@ int main(int argc, char* argv[]) {
 #endif
 
         chrono_step += sys.GetTimerStep();
+        raytest += terrain.GetTimerRayTesting();
+        raycast += terrain.GetTimerRayCasting();
 
         // Increment frame number
         step_number++;
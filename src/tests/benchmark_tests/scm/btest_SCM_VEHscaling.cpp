@@ -12,6 +12,12 @@
 // Author: Radu Serban
 // =============================================================================
 //
+// Benchmark for the scaling of SCM deformable terrain with the number of threads.
+// An HMMWV is driven on SCM terrain with a given number of SCM and collision
+// threads. If a maximum number of threads is specified (-m), the simulation is
+// repeated with 1, 2, 4, ... threads (up to the given maximum) and a table with
+// the resulting scaling curve is printed and written to 'scaling.out'.
+//
 // The global reference frame has Z up.
 // All units SI.
 // =============================================================================
@@ -67,6 +73,9 @@ bool chrono_collsys = false;
 // Number of SCM and collision threads
 int nthreads = 4;
 
+// Maximum number of threads for a scaling study (no scaling study if 0)
+int max_threads = 0;
+
 // Moving patches under each wheel
 bool wheel_patches = false;
 
@@ -81,6 +90,7 @@ bool visualize = false;
 // Forward declares for straight forward helper functions
 void AddCommandLineOptions(ChCLI& cli);
 void PrintStepStatistics(std::ostream& os, const ChSystem& sys);
+double RunSimulation();
 
 // =============================================================================
 
@@ -99,6 +109,7 @@ int main(int argc, char* argv[]) {
     step_size = cli.GetAsType<double>("step_size");
     end_time = cli.GetAsType<double>("end_time");
     nthreads = cli.GetAsType<int>("nthreads");
+    max_threads = cli.GetAsType<int>("max_threads");
     wheel_patches = cli.GetAsType<bool>("wheel_patches");
 
     chrono_collsys = cli.GetAsType<bool>("csys");
@@ -115,6 +126,34 @@ int main(int argc, char* argv[]) {
     visualize = false;
 #endif
 
+    if (max_threads <= 0) {
+        RunSimulation();
+        return 0;
+    }
+
+    // Scaling study (no run-time visualization)
+    visualize = false;
+    std::vector<int> num_threads;
+    std::vector<double> rtf;
+    for (nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+        num_threads.push_back(nthreads);
+        rtf.push_back(RunSimulation());
+    }
+
+    std::ofstream ofile("scaling.out");
+    cout << "\nSCALING (threads, RTF, speedup):" << endl;
+    for (size_t i = 0; i < num_threads.size(); i++) {
+        cout << "  " << num_threads[i] << "  " << rtf[i] << "  " << rtf[0] / rtf[i] << endl;
+        ofile << num_threads[i] << " " << rtf[i] << " " << rtf[0] / rtf[i] << endl;
+    }
+    ofile.close();
+    cout << "\nOUTPUT FILE: scaling.out" << endl;
+
+    return 0;
+}
+
+// Run the benchmark simulation with the current settings and return the RTF.
+double RunSimulation() {
     std::cout << "Collision system: " << (chrono_collsys ? "Chrono" : "Bullet") << std::endl;
     std::cout << "Num SCM threads: " << nthreads << std::endl;
 
@@ -256,6 +295,8 @@ int main(int argc, char* argv[]) {
     double raytest = 0;
     double raycast = 0;
 
+    double rtf = 0;
+
     ChTimer<> timer;
     timer.start();
 
@@ -265,7 +306,7 @@ int main(int argc, char* argv[]) {
         if (time > end_time) {
             if (!stats_done) {
                 timer.stop();
-                double rtf = timer() / end_time;
+                rtf = timer() / end_time;
                 int nsteps = (int)(end_time / step_size);
 
                 std::string fname = "stats_" + std::to_string(nthreads) + ".out";
@@ -336,13 +377,14 @@ int main(int argc, char* argv[]) {
         step_number++;
     }
 
-    return 0;
+    return rtf;
 }
 
 void AddCommandLineOptions(ChCLI& cli) {
     cli.AddOption<double>("Test", "s,step_size", "Step size", std::to_string(step_size));
     cli.AddOption<double>("Test", "e,end_time", "End time", std::to_string(end_time));
     cli.AddOption<int>("Test", "n,nthreads", "Number threads", std::to_string(nthreads));
+    cli.AddOption<int>("Test", "m,max_threads", "Max. number threads for scaling study", std::to_string(max_threads));
     cli.AddOption<bool>("Test", "c,csys", "Use Chrono multicore collision (false: Bullet)", std ::to_string(chrono_collsys));
     cli.AddOption<bool>("Test", "w,wheel_patches", "Use patches under each wheel", std::to_string(wheel_patches));
     cli.AddOption<bool>("Test", "v,vis", "Enable run-time visualization", std::to_string(visualize));
@@ -0,0 +1,141 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for batches of HMMWV double lane change maneuvers, run with
+// ChVehicleBatchRunner. The runs of a batch differ in the target speed.
+// The vehicle, powertrain and tires are constructed from JSON specification
+// files, so that each batch also exercises the shared cache of parsed JSON
+// documents. Compares the throughput (runs per hour) of a single worker thread
+// (the equivalent of running the maneuvers one after the other, one per
+// process) with that of several worker threads, with and without the cache.
+//
+// =============================================================================
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/driver/ChPathFollowerDriver.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/utils/ChUtilsJSON.h"
+#include "chrono_vehicle/utils/ChVehicleBatchRunner.h"
+#include "chrono_vehicle/utils/ChVehiclePath.h"
+#include "chrono_vehicle/wheeled_vehicle/vehicle/WheeledVehicle.h"
+
+#include "benchmark/benchmark.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// =============================================================================
+
+class HmmwvDlcRun : public ChVehicleBatchRunner::Instance {
+  public:
+    HmmwvDlcRun(double speed, std::shared_ptr<ChBezierCurve> path);
+
+    virtual ChSystem* GetSystem() override { return m_vehicle->GetSystem(); }
+    virtual void Advance(double step) override;
+    virtual void GetOutput(std::vector<double>& values) override;
+
+  private:
+    std::unique_ptr<WheeledVehicle> m_vehicle;
+    std::unique_ptr<RigidTerrain> m_terrain;
+    std::unique_ptr<ChPathFollowerDriver> m_driver;
+};
+
+HmmwvDlcRun::HmmwvDlcRun(double speed, std::shared_ptr<ChBezierCurve> path) {
+    m_vehicle = std::unique_ptr<WheeledVehicle>(
+        new WheeledVehicle(vehicle::GetDataFile("hmmwv/vehicle/HMMWV_Vehicle.json"), ChContactMethod::SMC));
+    m_vehicle->Initialize(ChCoordsys<>(ChVector<>(-120, 0, 0.7), QUNIT));
+    m_vehicle->GetChassis()->SetFixed(false);
+
+    auto powertrain = ReadPowertrainJSON(vehicle::GetDataFile("hmmwv/powertrain/HMMWV_ShaftsPowertrain.json"));
+    m_vehicle->InitializePowertrain(powertrain);
+
+    for (auto& axle : m_vehicle->GetAxles()) {
+        for (auto& wheel : axle->GetWheels()) {
+            auto tire = ReadTireJSON(vehicle::GetDataFile("hmmwv/tire/HMMWV_TMeasyTire.json"));
+            m_vehicle->InitializeTire(tire, wheel, VisualizationType::NONE);
+        }
+    }
+
+    m_terrain = std::unique_ptr<RigidTerrain>(new RigidTerrain(m_vehicle->GetSystem()));
+    auto patch_material = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    patch_material->SetFriction(0.9f);
+    patch_material->SetRestitution(0.01f);
+    patch_material->SetYoungModulus(2e7f);
+    m_terrain->AddPatch(patch_material, ChVector<>(0, 0, 0), ChVector<>(0, 0, 1), 300, 20, 1, false, 1, false);
+    m_terrain->Initialize();
+
+    // The path is shared (read-only) by all runs
+    m_driver = std::unique_ptr<ChPathFollowerDriver>(new ChPathFollowerDriver(*m_vehicle, path, "my_path", speed));
+    m_driver->GetSteeringController().SetLookAheadDistance(5.0);
+    m_driver->GetSteeringController().SetGains(0.8, 0, 0);
+    m_driver->GetSpeedController().SetGains(0.4, 0, 0);
+    m_driver->Initialize();
+}
+
+void HmmwvDlcRun::Advance(double step) {
+    double time = m_vehicle->GetSystem()->GetChTime();
+    ChDriver::Inputs driver_inputs = m_driver->GetInputs();
+    m_driver->Synchronize(time);
+    m_terrain->Synchronize(time);
+    m_vehicle->Synchronize(time, driver_inputs, *m_terrain);
+    m_driver->Advance(step);
+    m_terrain->Advance(step);
+    m_vehicle->Advance(step);
+}
+
+void HmmwvDlcRun::GetOutput(std::vector<double>& values) {
+    const auto& pos = m_vehicle->GetVehiclePos();
+    values.push_back(pos.x());
+    values.push_back(pos.y());
+    values.push_back(m_vehicle->GetVehicleSpeed());
+}
+
+// =============================================================================
+
+static void HmmwvBatch(benchmark::State& st) {
+    int num_threads = (int)st.range(0);
+    bool use_cache = st.range(1) != 0;
+    int num_runs = 8;
+
+    EnableCacheJSON(use_cache);
+    auto path = DoubleLaneChangePath(ChVector<>(-125, 0, 0.1), 28.93, 3.6105, 25.0, 50.0, false);
+
+    ChVehicleBatchRunner runner(num_runs);
+    runner.SetNumThreads(num_threads);
+    runner.SetStepSize(2e-3);
+    runner.SetEndTime(4.0);
+    runner.SetOutputStep(0.1);
+    runner.SetOutputChannels({"x", "y", "speed"});
+
+    for (auto _ : st) {
+        // Start each batch with an empty cache, so that cached batches include parsing all files once
+        ClearCacheJSON();
+        runner.Run([&path](int run) {
+            return std::unique_ptr<ChVehicleBatchRunner::Instance>(new HmmwvDlcRun(8.0 + 0.5 * run, path));
+        });
+    }
+
+    st.counters["runs_per_hour"] = runner.GetRunsPerHour();
+    st.counters["failed"] = (double)runner.GetFailedRuns().size();
+    st.counters["records"] = (double)runner.GetColumn("time").size();
+}
+
+static void HmmwvBatchArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"threads", "cache"});
+    for (int num_threads : {1, 2, 4, 8})
+        for (int use_cache : {0, 1})
+            b->Args({num_threads, use_cache});
+}
+
+BENCHMARK(HmmwvBatch)->Apply(HmmwvBatchArgs)->Unit(benchmark::kMillisecond)->Iterations(1)->UseRealTime();
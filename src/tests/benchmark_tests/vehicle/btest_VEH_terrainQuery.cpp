@@ -0,0 +1,108 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for RigidTerrain height queries on a height-map patch.
+// Compares queries through ray casting into the patch collision model with
+// queries on a baked height-field (number of queries per second). For the
+// baked height-field, the largest difference from ray casting at the query
+// points and the error estimate reported by the terrain are also reported.
+//
+// =============================================================================
+
+#include <random>
+
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "benchmark/benchmark.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// =============================================================================
+
+class TerrainQueryTest {
+  public:
+    TerrainQueryTest(bool baked, double resolution);
+
+    RigidTerrain& GetTerrain() { return *m_terrain; }
+
+    std::vector<ChVector<>> m_points;
+
+  private:
+    ChSystemNSC m_system;
+    std::unique_ptr<RigidTerrain> m_terrain;
+};
+
+TerrainQueryTest::TerrainQueryTest(bool baked, double resolution) {
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    m_terrain = std::unique_ptr<RigidTerrain>(new RigidTerrain(&m_system));
+    m_terrain->AddPatch(mat, CSYSNORM, vehicle::GetDataFile("terrain/height_maps/bump64.bmp"), 64, 64, 0, 3, true, 0,
+                        false);
+    m_terrain->EnableHeightFieldCache(baked, resolution);
+    m_terrain->Initialize();
+
+    // Make sure the collision models are up to date for ray casting
+    m_system.Setup();
+    m_system.Update();
+    m_system.ComputeCollisions();
+
+    // Random query points over the patch
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-31.9, 31.9);
+    for (int i = 0; i < 10000; i++)
+        m_points.push_back(ChVector<>(dist(gen), dist(gen), 5));
+}
+
+// =============================================================================
+
+static void RayCast(benchmark::State& st) {
+    TerrainQueryTest test(false, 0);
+    auto& terrain = test.GetTerrain();
+    double sum = 0;
+    for (auto _ : st) {
+        for (const auto& p : test.m_points)
+            sum += terrain.GetHeight(p);
+    }
+    benchmark::DoNotOptimize(sum);
+    st.counters["queries_per_sec"] =
+        benchmark::Counter((double)test.m_points.size(), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+static void HeightField(benchmark::State& st) {
+    double resolution = 0.01 * st.range(0);
+    TerrainQueryTest test(true, resolution);
+    auto& terrain = test.GetTerrain();
+    double sum = 0;
+    for (auto _ : st) {
+        for (const auto& p : test.m_points)
+            sum += terrain.GetHeight(p);
+    }
+    benchmark::DoNotOptimize(sum);
+    st.counters["queries_per_sec"] =
+        benchmark::Counter((double)test.m_points.size(), benchmark::Counter::kIsIterationInvariantRate);
+
+    // Compare against ray casting
+    TerrainQueryTest exact(false, 0);
+    double max_error = 0;
+    for (const auto& p : test.m_points)
+        max_error = std::max(max_error, std::abs(terrain.GetHeight(p) - exact.GetTerrain().GetHeight(p)));
+    st.counters["max_error"] = max_error;
+    st.counters["error_estimate"] = terrain.GetHeightFieldError();
+}
+
+BENCHMARK(RayCast)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(HeightField)->Unit(benchmark::kMillisecond)->UseRealTime()->Arg(100)->Arg(50)->Arg(25);
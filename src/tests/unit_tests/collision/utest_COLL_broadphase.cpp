@@ -0,0 +1,180 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for the incremental and hybrid broadphase of the Chrono collision
+// system. The candidate pairs found by the incremental broadphase are compared
+// against those of a full broadphase, for a scene with mostly static (fixed or
+// sleeping) shapes and a few moving shapes. The candidate pairs and ray hits
+// found with the hybrid grid / AABB-tree broadphase are compared against those
+// of the grid broadphase, for a scene with shapes of very different sizes.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+#include "utest_COLL_scene.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// Create a scene with a fixed ground, a layer of sleeping spheres, and a few moving spheres.
+static std::shared_ptr<ChCollisionSystemChrono> CreateIncrementalScene(ChSystemNSC& sys,
+                                                                       bool incremental,
+                                                                       std::vector<std::shared_ptr<ChBody>>& moving) {
+    auto coll = SetChronoCollisionSystem(sys, ChVector<int>(8, 2, 8));
+    coll->EnableIncrementalBroadphase(incremental);
+
+    SceneParams params;
+    params.num_items = ChVector<int>(15, 1, 15);
+    params.first = ChVector<>(-7, 0.5, -7);
+    params.spacing = ChVector<>(0.95, 1, 0.95);
+    params.sleeping = true;
+    CreateScene(sys, params);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    for (int i = 0; i < 5; i++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.4, 1000, false, true, mat);
+        sphere->SetPos(ChVector<>(-6 + 2.5 * i, 1.2, -6));
+        sys.AddBody(sphere);
+        moving.push_back(sphere);
+    }
+
+    return coll;
+}
+
+// Return the sorted list of candidate pairs (as pairs of shape identifiers).
+static std::vector<std::pair<int, int>> GetPairs(ChCollisionSystemChrono& coll) {
+    std::vector<std::pair<int, int>> pairs;
+    for (const auto& p : coll.GetOverlappingPairs())
+        pairs.push_back(std::make_pair(std::min(p.x, p.y), std::max(p.x, p.y)));
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+TEST(ChBroadphase, incremental) {
+    ChSystemNSC sys_full;
+    ChSystemNSC sys_inc;
+    std::vector<std::shared_ptr<ChBody>> moving_full;
+    std::vector<std::shared_ptr<ChBody>> moving_inc;
+    auto coll_full = CreateIncrementalScene(sys_full, false, moving_full);
+    auto coll_inc = CreateIncrementalScene(sys_inc, true, moving_inc);
+
+    sys_full.Setup();
+    sys_inc.Setup();
+
+    for (int step = 0; step < 60; step++) {
+        // Move the active spheres through the layer of sleeping spheres
+        for (size_t i = 0; i < moving_full.size(); i++) {
+            ChVector<> pos(-6 + 2.5 * i + 0.05 * step, 1.2 - 0.01 * step, -6 + 0.2 * step);
+            moving_full[i]->SetPos(pos);
+            moving_inc[i]->SetPos(pos);
+        }
+
+        // Move one sphere outside the current grid (forces a grid rebuild)
+        if (step == 40) {
+            moving_full[0]->SetPos(ChVector<>(0, 30, 0));
+            moving_inc[0]->SetPos(ChVector<>(0, 30, 0));
+        }
+
+        // Wake up one of the sleeping spheres
+        if (step == 20) {
+            sys_full.Get_bodylist()[50]->SetSleeping(false);
+            sys_inc.Get_bodylist()[50]->SetSleeping(false);
+        }
+
+        sys_full.Update();
+        sys_inc.Update();
+        sys_full.ComputeCollisions();
+        sys_inc.ComputeCollisions();
+
+        auto pairs_full = GetPairs(*coll_full);
+        auto pairs_inc = GetPairs(*coll_inc);
+        ASSERT_EQ(pairs_full.size(), pairs_inc.size()) << "step " << step;
+        ASSERT_TRUE(pairs_full == pairs_inc) << "step " << step;
+        ASSERT_GT(pairs_full.size(), 0u);
+    }
+}
+
+// Create a scene with a large fixed ground, a layer of spheres (a few of them moving), and a long fixed conveyor.
+static std::shared_ptr<ChCollisionSystemChrono> CreateMixedScene(ChSystemNSC& sys,
+                                                                 bool hybrid,
+                                                                 std::vector<std::shared_ptr<ChBody>>& moving) {
+    auto coll = SetChronoCollisionSystem(sys, ChVector<int>(16, 4, 16));
+    coll->EnableHybridBroadphase(hybrid, 10);
+
+    SceneParams params;
+    params.num_items = ChVector<int>(15, 1, 15);
+    params.first = ChVector<>(-7, 0.5, -7);
+    params.spacing = ChVector<>(0.95, 1, 0.95);
+    auto spheres = CreateScene(sys, params);
+    for (int ix = 0; ix < 15; ix += 5) {
+        for (int iz = 0; iz < 15; iz += 5)
+            moving.push_back(spheres[ix * 15 + iz]);
+    }
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    auto conveyor = chrono_types::make_shared<ChBodyEasyBox>(18, 0.2, 1, 1000, false, true, mat);
+    conveyor->SetPos(ChVector<>(0, 1.1, 3));
+    conveyor->SetBodyFixed(true);
+    sys.AddBody(conveyor);
+
+    return coll;
+}
+
+TEST(ChBroadphase, hybrid) {
+    ChSystemNSC sys_grid;
+    ChSystemNSC sys_hybrid;
+    std::vector<std::shared_ptr<ChBody>> moving_grid;
+    std::vector<std::shared_ptr<ChBody>> moving_hybrid;
+    auto coll_grid = CreateMixedScene(sys_grid, false, moving_grid);
+    auto coll_hybrid = CreateMixedScene(sys_hybrid, true, moving_hybrid);
+
+    sys_grid.Setup();
+    sys_hybrid.Setup();
+
+    for (int step = 0; step < 30; step++) {
+        // Lift the moving spheres through the conveyor
+        for (size_t i = 0; i < moving_grid.size(); i++) {
+            ChVector<> pos = moving_grid[i]->GetPos() + ChVector<>(0.01, 0.05, 0.02);
+            moving_grid[i]->SetPos(pos);
+            moving_hybrid[i]->SetPos(pos);
+        }
+
+        sys_grid.Update();
+        sys_hybrid.Update();
+        sys_grid.ComputeCollisions();
+        sys_hybrid.ComputeCollisions();
+
+        auto pairs_grid = GetPairs(*coll_grid);
+        auto pairs_hybrid = GetPairs(*coll_hybrid);
+        ASSERT_EQ(pairs_grid.size(), pairs_hybrid.size()) << "step " << step;
+        ASSERT_TRUE(pairs_grid == pairs_hybrid) << "step " << step;
+        ASSERT_GT(pairs_grid.size(), 0u);
+    }
+
+    // Vertical rays must hit the same shapes at the same distance
+    for (int i = 0; i < 20; i++) {
+        ChVector<> from(-9.5 + 1.0 * i, 5, -9.5 + 1.0 * i);
+        ChVector<> to(-9.5 + 1.0 * i, -5, -9.5 + 1.0 * i);
+        ChCollisionSystem::ChRayhitResult res_grid;
+        ChCollisionSystem::ChRayhitResult res_hybrid;
+        bool hit_grid = coll_grid->RayHit(from, to, res_grid);
+        bool hit_hybrid = coll_hybrid->RayHit(from, to, res_hybrid);
+        ASSERT_EQ(hit_grid, hit_hybrid) << "ray " << i;
+        ASSERT_TRUE(hit_grid);
+        ASSERT_NEAR(res_grid.abs_hitPoint.y(), res_hybrid.abs_hitPoint.y(), 1e-6) << "ray " << i;
+    }
+}
@@ -0,0 +1,119 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the narrowphase feature identifiers reported by the Chrono
+// collision system. The contact points of a multi-contact shape pair (boxes
+// resting on each other) must carry distinct feature identifiers, so that they
+// are matched separately by the persistent contact cache of the NSC contact
+// container.
+//
+// =============================================================================
+
+#include <map>
+#include <set>
+#include <utility>
+
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+
+#include "gtest/gtest.h"
+
+#include "utest_COLL_scene.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+class FeatureCollector : public ChContactContainer::AddContactCallback {
+  public:
+    virtual void OnAddContact(const ChCollisionInfo& cinfo, ChMaterialComposite* const material) override {
+        auto key = std::make_pair(cinfo.shapeA, cinfo.shapeB);
+        features[key].push_back(std::make_pair(cinfo.featureA, cinfo.featureB));
+    }
+    std::map<std::pair<ChCollisionShape*, ChCollisionShape*>, std::vector<std::pair<int, int>>> features;
+};
+
+// Create a few stacks of boxes resting on a ground box.
+static void CreateStacks(ChSystemNSC& sys) {
+    sys.Set_G_acc(ChVector<>(0, -9.81, 0));
+    SetChronoCollisionSystem(sys, ChVector<int>(4, 4, 4));
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.6f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    for (int ix = 0; ix < 2; ix++) {
+        for (int iy = 0; iy < 3; iy++) {
+            auto box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, false, true, mat);
+            box->SetPos(ChVector<>(-1 + 2.0 * ix, 0.25 + 0.5 * iy, 0));
+            sys.AddBody(box);
+        }
+    }
+}
+
+TEST(ChCollisionSystemChrono, contact_features) {
+    ChSystemNSC sys;
+    CreateStacks(sys);
+
+    auto collector = chrono_types::make_shared<FeatureCollector>();
+    sys.GetContactContainer()->RegisterAddContactCallback(collector);
+
+    sys.Setup();
+    sys.Update();
+    sys.ComputeCollisions();
+
+    // Each box touches the box or the ground below it over a face
+    ASSERT_EQ(collector->features.size(), 6u);
+    for (const auto& pair : collector->features) {
+        const auto& features = pair.second;
+        ASSERT_GT(features.size(), 1u);
+
+        // Features on each side are distinct and non-negative
+        std::set<int> featuresA;
+        std::set<int> featuresB;
+        for (const auto& f : features) {
+            ASSERT_GE(f.first, 0);
+            ASSERT_GE(f.second, 0);
+            featuresA.insert(f.first);
+            featuresB.insert(f.second);
+        }
+        ASSERT_EQ(featuresA.size(), features.size());
+        ASSERT_EQ(featuresB.size(), features.size());
+    }
+}
+
+TEST(ChCollisionSystemChrono, contact_cache) {
+    ChSystemNSC sys;
+    CreateStacks(sys);
+
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(200);
+    solver->EnableWarmStart(true);
+    sys.SetSolver(solver);
+
+    auto container = std::static_pointer_cast<ChContactContainerNSC>(sys.GetContactContainer());
+    container->EnableContactCache(true);
+    container->SetContactCacheTolerance(0.02);
+
+    for (int i = 0; i < 200; i++)
+        sys.DoStepDynamics(1e-3);
+
+    // At rest, (almost) all contacts are matched in the cache
+    int num_contacts = container->GetNcontacts();
+    ASSERT_GT(num_contacts, 6);
+    ASSERT_GE(container->GetNumCachedContacts(), 0.9 * num_contacts);
+}
@@ -0,0 +1,106 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the batched narrowphase of the Chrono collision system.
+// The contacts found with the batched sphere-sphere, box-sphere, and box-box
+// kernels are compared against those of the scalar narrowphase dispatch, for a
+// scene with a mix of spheres and (rotated) boxes resting on a ground box.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "utest_COLL_scene.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+struct ContactData {
+    ChVector<> pA;
+    ChVector<> pB;
+    ChVector<> normal;
+    double distance;
+    double eff_radius;
+};
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& cforce,
+                                 const ChVector<>& ctorque,
+                                 ChContactable* modA,
+                                 ChContactable* modB) override {
+        contacts.push_back({pA, pB, plane_coord.Get_A_Xaxis(), distance, eff_radius});
+        return true;
+    }
+    std::vector<ContactData> contacts;
+};
+
+// Create a scene with a fixed ground box and a perturbed lattice of spheres and rotated boxes.
+static void CreateMixedScene(ChSystemNSC& sys, bool batched, ChNarrowphase::Algorithm algorithm) {
+    auto coll = SetChronoCollisionSystem(sys, ChVector<int>(8, 4, 8));
+    coll->SetNarrowphaseAlgorithm(algorithm);
+    coll->EnableBatchedNarrowphase(batched);
+
+    SceneParams params;
+    params.num_items = ChVector<int>(12, 4, 12);
+    params.first = ChVector<>(-5.5, 0.45, -5.5);
+    params.spacing = ChVector<>(0.95, 0.9, 0.95);
+    params.box_period = 3;
+    params.perturbation = 0.1;
+    CreateScene(sys, params);
+}
+
+static std::vector<ContactData> GetContacts(ChSystemNSC& sys) {
+    sys.Setup();
+    sys.Update();
+    sys.ComputeCollisions();
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+    return collector->contacts;
+}
+
+static void CompareContacts(ChNarrowphase::Algorithm algorithm) {
+    ChSystemNSC sys_scalar;
+    ChSystemNSC sys_batched;
+    CreateMixedScene(sys_scalar, false, algorithm);
+    CreateMixedScene(sys_batched, true, algorithm);
+
+    auto contacts_scalar = GetContacts(sys_scalar);
+    auto contacts_batched = GetContacts(sys_batched);
+
+    ASSERT_GT(contacts_scalar.size(), 0u);
+    ASSERT_EQ(contacts_scalar.size(), contacts_batched.size());
+    for (size_t i = 0; i < contacts_scalar.size(); i++) {
+        const auto& c1 = contacts_scalar[i];
+        const auto& c2 = contacts_batched[i];
+        ASSERT_NEAR((c1.pA - c2.pA).Length(), 0, 1e-10) << "contact " << i;
+        ASSERT_NEAR((c1.pB - c2.pB).Length(), 0, 1e-10) << "contact " << i;
+        ASSERT_NEAR((c1.normal - c2.normal).Length(), 0, 1e-10) << "contact " << i;
+        ASSERT_NEAR(c1.distance, c2.distance, 1e-10) << "contact " << i;
+        ASSERT_NEAR(c1.eff_radius, c2.eff_radius, 1e-10) << "contact " << i;
+    }
+}
+
+TEST(ChNarrowphaseBatch, prims) {
+    CompareContacts(ChNarrowphase::Algorithm::PRIMS);
+}
+
+TEST(ChNarrowphaseBatch, hybrid) {
+    CompareContacts(ChNarrowphase::Algorithm::HYBRID);
+}
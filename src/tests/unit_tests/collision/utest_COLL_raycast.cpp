@@ -0,0 +1,166 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for the ray-hit queries of the collision systems. The results of
+// batched ray queries are compared against those of individual ray queries and
+// ray queries against a given collision model are checked, for both the Bullet
+// and (if available) the Chrono collision systems.
+//
+// =============================================================================
+
+#include "chrono/collision/ChCollisionSystemBullet.h"
+
+#include "gtest/gtest.h"
+
+#include "utest_COLL_scene.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// Create the test scene (a grid of spheres on a fixed ground), with a few rotated boxes added above it.
+static void CreateRayScene(ChSystemNSC& sys) {
+    CreateScene(sys, SceneParams());
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    for (int i = 0; i < 4; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(1.0, 0.6, 0.8, 1000, false, true, mat);
+        box->SetPos(ChVector<>(-3 + 2.0 * i, 2.0, 7));
+        box->SetRot(Q_from_AngY(0.3 * i));
+        sys.AddBody(box);
+    }
+
+    sys.Setup();
+    sys.Update();
+    sys.ComputeCollisions();
+}
+
+// Generate a set of (mostly vertical) rays covering the scene.
+static void GenerateRays(std::vector<ChVector<>>& from, std::vector<ChVector<>>& to) {
+    for (int i = 0; i < 41; i++) {
+        for (int j = 0; j < 41; j++) {
+            double x = -10 + 0.5 * i + 0.01;
+            double z = -10 + 0.5 * j + 0.02;
+            from.push_back(ChVector<>(x, 5, z));
+            to.push_back(ChVector<>(x + 0.2 * (j % 3), -5, z - 0.1 * (i % 4)));
+        }
+    }
+    // A few horizontal rays, some missing everything
+    for (int i = 0; i < 10; i++) {
+        from.push_back(ChVector<>(-15, 0.5 + 0.4 * i, -4 + 0.9 * i));
+        to.push_back(ChVector<>(15, 0.5 + 0.4 * i, -4 + 0.9 * i));
+    }
+}
+
+// Compare the results of a batched ray query with those of individual ray queries.
+static void CheckBatch(ChCollisionSystem& coll) {
+    std::vector<ChVector<>> from;
+    std::vector<ChVector<>> to;
+    GenerateRays(from, to);
+
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    int num_hits = coll.RayHit(from, to, results);
+    ASSERT_EQ(results.size(), from.size());
+
+    int num_hits_single = 0;
+    for (size_t i = 0; i < from.size(); i++) {
+        ChCollisionSystem::ChRayhitResult result;
+        bool hit = coll.RayHit(from[i], to[i], result);
+        ASSERT_EQ(hit, results[i].hit) << "ray " << i;
+        if (!hit)
+            continue;
+        num_hits_single++;
+        ASSERT_EQ(result.hitModel, results[i].hitModel) << "ray " << i;
+        ASSERT_NEAR((result.abs_hitPoint - results[i].abs_hitPoint).Length(), 0, 1e-9) << "ray " << i;
+        ASSERT_NEAR((result.abs_hitNormal - results[i].abs_hitNormal).Length(), 0, 1e-9) << "ray " << i;
+        ASSERT_NEAR(result.dist_factor, results[i].dist_factor, 1e-9) << "ray " << i;
+    }
+
+    ASSERT_EQ(num_hits, num_hits_single);
+    ASSERT_GT(num_hits, 41 * 41 / 2);
+    ASSERT_LT(num_hits, (int)from.size());
+}
+
+// Check ray queries against individual collision models.
+static void CheckModel(ChSystemNSC& sys, ChCollisionSystem& coll) {
+    auto ground = sys.Get_bodylist()[0]->GetCollisionModel().get();
+    auto sphere = sys.Get_bodylist()[1]->GetCollisionModel().get();  // sphere at (-4, 0.5, -4)
+    auto other = sys.Get_bodylist()[2]->GetCollisionModel().get();   // sphere at (-4, 0.5, -2)
+
+    // Height of the ground, as found by a ray which does not hit any sphere
+    ChCollisionSystem::ChRayhitResult result;
+    ASSERT_TRUE(coll.RayHit(ChVector<>(-5, 5, -5), ChVector<>(-5, -5, -5), result));
+    ASSERT_EQ(result.hitModel, ground);
+    double ground_height = result.abs_hitPoint.y();
+
+    // A ray through the center of the first sphere hits the sphere first
+    ChVector<> from(-4, 5, -4);
+    ChVector<> to(-4, -5, -4);
+    ASSERT_TRUE(coll.RayHit(from, to, result));
+    ASSERT_EQ(result.hitModel, sphere);
+    double sphere_height = result.abs_hitPoint.y();
+    ASSERT_GT(sphere_height, ground_height + 0.5);
+
+    // Querying the sphere model gives the same hit
+    ChCollisionSystem::ChRayhitResult result_model;
+    ASSERT_TRUE(coll.RayHit(from, to, sphere, result_model));
+    ASSERT_EQ(result_model.hitModel, sphere);
+    ASSERT_NEAR(result_model.abs_hitPoint.y(), sphere_height, 1e-9);
+
+    // Querying the ground model ignores the sphere
+    ASSERT_TRUE(coll.RayHit(from, to, ground, result_model));
+    ASSERT_EQ(result_model.hitModel, ground);
+    ASSERT_NEAR(result_model.abs_hitPoint.y(), ground_height, 1e-9);
+    ASSERT_NEAR(result_model.abs_hitNormal.y(), 1, 1e-9);
+
+    // Querying a model not on the ray path gives no hit
+    ASSERT_FALSE(coll.RayHit(from, to, other, result_model));
+    ASSERT_FALSE(result_model.hit);
+}
+
+TEST(ChCollisionSystemBullet, ray_batch) {
+    ChSystemNSC sys;
+    CreateRayScene(sys);
+    CheckBatch(*sys.GetCollisionSystem());
+}
+
+TEST(ChCollisionSystemBullet, ray_model) {
+    ChSystemNSC sys;
+    CreateRayScene(sys);
+    CheckModel(sys, *sys.GetCollisionSystem());
+}
+
+#ifdef CHRONO_COLLISION
+
+TEST(ChCollisionSystemChrono, ray_batch) {
+    ChSystemNSC sys;
+    SetChronoCollisionSystem(sys, ChVector<int>(8, 2, 8));
+    CreateRayScene(sys);
+    CheckBatch(*sys.GetCollisionSystem());
+}
+
+TEST(ChCollisionSystemChrono, ray_batch_hybrid) {
+    ChSystemNSC sys;
+    SetChronoCollisionSystem(sys, ChVector<int>(8, 2, 8))->EnableHybridBroadphase(true, 10);
+    CreateRayScene(sys);
+    CheckBatch(*sys.GetCollisionSystem());
+}
+
+TEST(ChCollisionSystemChrono, ray_model) {
+    ChSystemNSC sys;
+    SetChronoCollisionSystem(sys, ChVector<int>(8, 2, 8));
+    CreateRayScene(sys);
+    CheckModel(sys, *sys.GetCollisionSystem());
+}
+
+#endif
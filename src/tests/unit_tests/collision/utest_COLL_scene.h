@@ -0,0 +1,100 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Common test scene for the collision detection unit tests: a fixed ground box
+// with a (possibly perturbed) lattice of spheres and rotated boxes above it.
+//
+// =============================================================================
+
+#ifndef UTEST_COLL_SCENE_H
+#define UTEST_COLL_SCENE_H
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#ifdef CHRONO_COLLISION
+    #include "chrono/collision/ChCollisionSystemChrono.h"
+#endif
+
+// Parameters of the test scene.
+struct SceneParams {
+    chrono::ChVector<int> num_items = chrono::ChVector<int>(5, 1, 5);  // number of lattice items in each direction
+    chrono::ChVector<> first = chrono::ChVector<>(-4, 0.5, -4);          // position of the first lattice item
+    chrono::ChVector<> spacing = chrono::ChVector<>(2, 1, 2);            // lattice spacing in each direction
+    double radius = 0.5;                                                  // sphere radius
+    int box_period = 0;  // items with (ix + iy + iz) a multiple of box_period are rotated boxes (0: spheres only)
+    chrono::ChVector<> box_size = chrono::ChVector<>(0.8, 0.6, 0.7);  // box dimensions
+    double perturbation = 0;  // amplitude of the deterministic perturbation of the lattice positions (x and z)
+    bool sleeping = false;    // put all lattice items to sleep
+};
+
+// Create the test scene. The ground is the first body in the system; the lattice items follow, ordered by x, then y,
+// then z index (z fastest). Return the lattice items.
+inline std::vector<std::shared_ptr<chrono::ChBody>> CreateScene(chrono::ChSystemNSC& sys, const SceneParams& params) {
+    using namespace chrono;
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> items;
+    for (int ix = 0; ix < params.num_items.x(); ix++) {
+        for (int iy = 0; iy < params.num_items.y(); iy++) {
+            for (int iz = 0; iz < params.num_items.z(); iz++) {
+                double dx = params.perturbation * std::sin(1.3 * ix + 0.7 * iy + 0.3 * iz);
+                double dz = params.perturbation * std::cos(0.4 * ix + 1.1 * iy + 0.9 * iz);
+                ChVector<> pos = params.first + ChVector<>(params.spacing.x() * ix + dx, params.spacing.y() * iy,
+                                                           params.spacing.z() * iz + dz);
+                std::shared_ptr<ChBody> body;
+                if (params.box_period > 0 && (ix + iy + iz) % params.box_period == 0) {
+                    const auto& size = params.box_size;
+                    body = chrono_types::make_shared<ChBodyEasyBox>(size.x(), size.y(), size.z(), 1000, false, true,
+                                                                    mat);
+                    body->SetRot(Q_from_Euler123(ChVector<>(0.3 * ix, 0.2 * iy, 0.1 * iz)));
+                } else {
+                    body = chrono_types::make_shared<ChBodyEasySphere>(params.radius, 1000, false, true, mat);
+                }
+                body->SetPos(pos);
+                body->SetSleeping(params.sleeping);
+                sys.AddBody(body);
+                items.push_back(body);
+            }
+        }
+    }
+
+    return items;
+}
+
+#ifdef CHRONO_COLLISION
+
+// Attach a Chrono collision system with a broadphase grid of given resolution to the system. Return the collision
+// system, for further configuration.
+inline std::shared_ptr<chrono::collision::ChCollisionSystemChrono> SetChronoCollisionSystem(
+    chrono::ChSystemNSC& sys,
+    const chrono::ChVector<int>& resolution) {
+    auto coll = chrono_types::make_shared<chrono::collision::ChCollisionSystemChrono>();
+    coll->SetBroadphaseGridResolution(resolution);
+    sys.SetCollisionSystem(coll);
+    return coll;
+}
+
+#endif
+
+#endif
@@ -77,3 +77,29 @@ TEST(SparseMatrix, pattern_learner) {
 	
 
 }
+
+TEST(SparseMatrix, add_in_place) {
+    // Uncompressed matrix with reserved space (2 nonzeros per row)
+    ChSparseMatrix spmat(3, 3);
+    spmat.reserve(Eigen::VectorXi::Constant(3, 2));
+    spmat.SetElement(1, 2, 1.0);
+
+    ASSERT_TRUE(spmat.AddElementInPlace(1, 2, 0.5));  // existing element
+    ASSERT_TRUE(spmat.AddElementInPlace(1, 0, 2.0));  // inserted in the reserved space, before (1,2)
+    ASSERT_FALSE(spmat.AddElementInPlace(1, 1, 3.0));  // no space left in row 1
+    ASSERT_TRUE(spmat.AddElementInPlace(0, 0, 4.0));
+    ASSERT_TRUE(spmat.AddElementInPlace(0, 0, 4.0));
+
+    ASSERT_NEAR(spmat.coeff(1, 2), 1.5, precision);
+    ASSERT_NEAR(spmat.coeff(1, 0), 2.0, precision);
+    ASSERT_NEAR(spmat.coeff(1, 1), 0.0, precision);
+    ASSERT_NEAR(spmat.coeff(0, 0), 8.0, precision);
+    ASSERT_EQ(spmat.nonZeros(), 3);
+
+    // Compressed matrix: only existing elements can be added in place
+    spmat.makeCompressed();
+    ASSERT_TRUE(spmat.AddElementInPlace(1, 0, 1.0));
+    ASSERT_FALSE(spmat.AddElementInPlace(2, 2, 1.0));
+    ASSERT_NEAR(spmat.coeff(1, 0), 3.0, precision);
+    ASSERT_EQ(spmat.nonZeros(), 3);
+}
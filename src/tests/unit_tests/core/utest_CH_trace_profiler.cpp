@@ -0,0 +1,85 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test of the trace profiler (per-thread recording, ring buffers, Chrome trace
+// export).
+//
+// =============================================================================
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "chrono/utils/ChTraceProfiler.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+TEST(ChTraceProfilerTest, record_export) {
+    ChTraceProfiler::Clear();
+
+    // Nothing is recorded while disabled
+    ChTraceProfiler::Enable(false);
+    { ChTraceScope scope("disabled", "test"); }
+    ASSERT_EQ(ChTraceProfiler::GetNumSpans(), 0);
+
+    // Nested scopes, recorded from several threads
+    ChTraceProfiler::Enable(true);
+#pragma omp parallel for num_threads(4)
+    for (int i = 0; i < 8; i++) {
+        ChTraceScope outer("outer", "test");
+        { ChTraceScope inner("inner \"quoted\"", "test"); }
+    }
+    ChTraceProfiler::Enable(false);
+
+    ASSERT_EQ(ChTraceProfiler::GetNumSpans(), 16);
+    ASSERT_GE(ChTraceProfiler::GetNumThreads(), 1);
+
+    std::stringstream ss;
+    ChTraceProfiler::ExportChromeTrace(ss);
+    std::string json = ss.str();
+    ASSERT_NE(json.find("\"traceEvents\""), std::string::npos);
+    ASSERT_NE(json.find("\"name\":\"outer\""), std::string::npos);
+    ASSERT_NE(json.find("\"name\":\"inner \\\"quoted\\\"\""), std::string::npos);
+    ASSERT_EQ(json.find("disabled"), std::string::npos);
+
+    ChTraceProfiler::Clear();
+    ASSERT_EQ(ChTraceProfiler::GetNumSpans(), 0);
+}
+
+TEST(ChTraceProfilerTest, ring_buffer) {
+    ChTraceProfiler::SetBufferSize(10);
+    ChTraceProfiler::Clear();
+
+    // Only the most recent spans are kept once the buffer is full
+    ChTraceProfiler::Enable(true);
+    for (int i = 0; i < 25; i++) {
+        CH_TRACE_BEGIN(span, ChTraceProfiler::Intern("span" + std::to_string(i)), "test");
+        CH_TRACE_END(span);
+    }
+    ChTraceProfiler::Enable(false);
+
+#ifdef CHRONO_TRACE_PROFILER
+    ASSERT_EQ(ChTraceProfiler::GetNumSpans(), 10);
+    std::stringstream ss;
+    ChTraceProfiler::ExportChromeTrace(ss);
+    ASSERT_EQ(ss.str().find("\"span14\""), std::string::npos);
+    ASSERT_NE(ss.str().find("\"span15\""), std::string::npos);
+    ASSERT_NE(ss.str().find("\"span24\""), std::string::npos);
+#else
+    ASSERT_EQ(ChTraceProfiler::GetNumSpans(), 0);
+#endif
+
+    ChTraceProfiler::SetBufferSize(65536);
+    ChTraceProfiler::Clear();
+}
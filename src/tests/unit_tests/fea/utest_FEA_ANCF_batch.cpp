@@ -0,0 +1,230 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the batched evaluation of ANCF elements in a ChMesh.
+// For meshes of ChElementBeamANCF_3333, ChElementShellANCF_3833, and
+// ChElementHexaANCF_3843 elements in a deformed and moving configuration, the
+// internal forces and the element Jacobians obtained with the batched kernels
+// are compared against those calculated by the elements themselves.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementBeamANCF_3333.h"
+#include "chrono/fea/ChElementHexaANCF_3843.h"
+#include "chrono/fea/ChElementShellANCF_3833.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Deterministic perturbation vector.
+static ChVector<> Perturbation(int i, double scale) {
+    return scale * ChVector<>(std::sin(1.1 * i + 0.3), std::cos(0.7 * i + 0.5), std::sin(1.9 * i + 1.3));
+}
+
+// Move the mesh nodes to a deformed configuration and assign nodal velocities.
+static void Deform(std::shared_ptr<ChMesh> mesh) {
+    int i = 0;
+    for (auto& node : mesh->GetNodes()) {
+        i++;
+        if (auto n = std::dynamic_pointer_cast<ChNodeFEAxyz>(node)) {
+            n->SetPos(n->GetPos() + Perturbation(i, 0.01));
+            n->SetPos_dt(Perturbation(i + 1, 0.5));
+        }
+        if (auto n = std::dynamic_pointer_cast<ChNodeFEAxyzD>(node)) {
+            n->SetD(n->GetD() + Perturbation(i + 2, 0.05));
+            n->SetD_dt(Perturbation(i + 3, 0.2));
+        }
+        if (auto n = std::dynamic_pointer_cast<ChNodeFEAxyzDD>(node)) {
+            n->SetDD(n->GetDD() + Perturbation(i + 4, 0.05));
+            n->SetDD_dt(Perturbation(i + 5, 0.2));
+        }
+        if (auto n = std::dynamic_pointer_cast<ChNodeFEAxyzDDD>(node)) {
+            n->SetD(n->GetD() + Perturbation(i + 2, 0.05));
+            n->SetD_dt(Perturbation(i + 3, 0.2));
+            n->SetDD(n->GetDD() + Perturbation(i + 4, 0.05));
+            n->SetDD_dt(Perturbation(i + 5, 0.2));
+            n->SetDDD(n->GetDDD() + Perturbation(i + 6, 0.05));
+            n->SetDDD_dt(Perturbation(i + 7, 0.2));
+        }
+    }
+}
+
+// Compare the internal forces and the element Jacobians with and without batched evaluation.
+static void Compare(ChSystemSMC& sys, std::shared_ptr<ChMesh> mesh, unsigned int num_batched) {
+    mesh->SetAutomaticGravity(false);
+    sys.Setup();
+    sys.Update();
+    Deform(mesh);
+
+    ChVectorDynamic<> R_ref(sys.GetNcoords_w());
+    ChVectorDynamic<> R_batch(sys.GetNcoords_w());
+    std::vector<ChMatrixDynamic<>> K_ref;
+
+    R_ref.setZero();
+    mesh->EnableBatchedANCF(false);
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R_ref, 0.5);
+    mesh->KRMmatricesLoad(1.3, 0.7, 0.2);
+    for (auto& element : mesh->GetElements())
+        K_ref.push_back(std::static_pointer_cast<ChElementGeneric>(element)->Kstiffness().Get_K());
+
+    R_batch.setZero();
+    mesh->EnableBatchedANCF(true);
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R_batch, 0.5);
+    mesh->KRMmatricesLoad(1.3, 0.7, 0.2);
+    ASSERT_EQ(mesh->GetNumBatchedElements(), num_batched);
+
+    ASSERT_GT(R_ref.norm(), 0);
+    ASSERT_LT((R_ref - R_batch).norm(), 1e-10 * R_ref.norm());
+
+    for (unsigned int ie = 0; ie < mesh->GetNelements(); ie++) {
+        auto element = std::static_pointer_cast<ChElementGeneric>(mesh->GetElement(ie));
+        ChMatrixDynamic<> K_batch = element->Kstiffness().Get_K();
+        ASSERT_LT((K_ref[ie] - K_batch).norm(), 1e-10 * K_ref[ie].norm()) << "element " << ie;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static void TestBeam(bool damping) {
+    ChSystemSMC sys;
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    auto material = chrono_types::make_shared<ChMaterialBeamANCF>(7850, 210e9, 0.3, 10.0 / 12.0, 10.0 / 12.0);
+
+    int num_elements = 7;
+    double dx = 0.2;
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(0, 0, 0), VECT_Y, VECT_Z);
+    nodeA->SetFixed(true);
+    mesh->AddNode(nodeA);
+    for (int i = 1; i <= num_elements; i++) {
+        auto nodeC = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(dx * (i - 0.5), 0, 0), VECT_Y, VECT_Z);
+        auto nodeB = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(dx * i, 0, 0), VECT_Y, VECT_Z);
+        mesh->AddNode(nodeC);
+        mesh->AddNode(nodeB);
+
+        auto element = chrono_types::make_shared<ChElementBeamANCF_3333>();
+        element->SetNodes(nodeA, nodeB, nodeC);
+        element->SetDimensions(dx, 0.02, 0.03);
+        element->SetMaterial(material);
+        element->SetAlphaDamp(damping ? 0.01 : 0.0);
+        // One element uses the "Pre-Integration" method and is not batched
+        if (i == 3)
+            element->SetIntFrcCalcMethod(ChElementBeamANCF_3333::IntFrcMethod::PreInt);
+        mesh->AddElement(element);
+
+        nodeA = nodeB;
+    }
+
+    Compare(sys, mesh, num_elements - 1);
+}
+
+TEST(ChElementBatch, beam_3333) {
+    TestBeam(false);
+}
+
+TEST(ChElementBatch, beam_3333_damping) {
+    TestBeam(true);
+}
+
+// -----------------------------------------------------------------------------
+
+static void TestShell(bool damping) {
+    ChSystemSMC sys;
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    auto material = chrono_types::make_shared<ChMaterialShellANCF>(7850, 210e9, 0.3);
+
+    double L = 0.5;
+    double H = 0.25;
+    ChVector<> dir(0, 0, 1);
+    ChVector<> curv(0, 0, 0);
+    for (int i = 0; i < 5; i++) {
+        double x = i * L;
+        auto nodeA = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(x, 0, 0), dir, curv);
+        auto nodeB = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(x + L, 0, 0), dir, curv);
+        auto nodeC = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(x + L, H, 0), dir, curv);
+        auto nodeD = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(x, H, 0), dir, curv);
+        auto nodeE = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(x + L / 2, 0, 0), dir, curv);
+        auto nodeF = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(x + L, H / 2, 0), dir, curv);
+        auto nodeG = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(x + L / 2, H, 0), dir, curv);
+        auto nodeH = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(x, H / 2, 0), dir, curv);
+        for (auto& node : {nodeA, nodeB, nodeC, nodeD, nodeE, nodeF, nodeG, nodeH})
+            mesh->AddNode(node);
+
+        auto element = chrono_types::make_shared<ChElementShellANCF_3833>();
+        element->SetNodes(nodeA, nodeB, nodeC, nodeD, nodeE, nodeF, nodeG, nodeH);
+        element->SetDimensions(L, H);
+        element->AddLayer(0.005, 0, material);
+        element->AddLayer(0.005, 30 * CH_C_DEG_TO_RAD, material);
+        element->SetAlphaDamp(damping ? 0.01 : 0.0);
+        mesh->AddElement(element);
+    }
+
+    Compare(sys, mesh, 5);
+}
+
+TEST(ChElementBatch, shell_3833) {
+    TestShell(false);
+}
+
+TEST(ChElementBatch, shell_3833_damping) {
+    TestShell(true);
+}
+
+// -----------------------------------------------------------------------------
+
+static void TestHexa(bool damping) {
+    ChSystemSMC sys;
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    auto material = chrono_types::make_shared<ChMaterialHexaANCF>(7850, 210e9, 0.3);
+
+    double L = 0.2;
+    for (int i = 0; i < 5; i++) {
+        double x = i * L;
+        std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> nodes;
+        for (auto& pos : {ChVector<>(x, 0, 0), ChVector<>(x + L, 0, 0), ChVector<>(x + L, L, 0), ChVector<>(x, L, 0),
+                          ChVector<>(x, 0, L), ChVector<>(x + L, 0, L), ChVector<>(x + L, L, L), ChVector<>(x, L, L)}) {
+            auto node = chrono_types::make_shared<ChNodeFEAxyzDDD>(pos);
+            mesh->AddNode(node);
+            nodes.push_back(node);
+        }
+
+        auto element = chrono_types::make_shared<ChElementHexaANCF_3843>();
+        element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3], nodes[4], nodes[5], nodes[6], nodes[7]);
+        element->SetDimensions(L, L, L);
+        element->SetMaterial(material);
+        element->SetAlphaDamp(damping ? 0.01 : 0.0);
+        mesh->AddElement(element);
+    }
+
+    Compare(sys, mesh, 5);
+}
+
+TEST(ChElementBatch, hexa_3843) {
+    TestHexa(false);
+}
+
+TEST(ChElementBatch, hexa_3843_damping) {
+    TestHexa(true);
+}
@@ -0,0 +1,195 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the Craig-Bampton reduced-order element.
+// A cantilever made of ChElementHexaCorot_8 elements is reduced to the nodes
+// of its two end faces and a few fixed-interface modes. The static response
+// of the reduced model to loads applied at the boundary nodes must match that
+// of the full mesh exactly, including the recovered interior displacements;
+// the dynamic response must match that of the full mesh closely.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChElementCraigBampton.h"
+#include "chrono/fea/ChElementHexaCorot_8.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+struct Cantilever {
+    std::shared_ptr<ChMesh> mesh;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> root;  // nodes at x = 0
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> tip;   // nodes at x = L
+};
+
+// Create a cantilever of hexahedral elements, along the x axis.
+static Cantilever CreateCantilever() {
+    int nx = 10;
+    int ny = 2;
+    int nz = 2;
+    double length = 1.0;
+    double width = 0.1;
+
+    auto material = chrono_types::make_shared<ChContinuumElastic>();
+    material->Set_E(2e8);
+    material->Set_v(0.3);
+    material->Set_density(1000);
+
+    Cantilever c;
+    c.mesh = chrono_types::make_shared<ChMesh>();
+
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int i = 0; i <= nx; i++) {
+        for (int j = 0; j <= ny; j++) {
+            for (int k = 0; k <= nz; k++) {
+                ChVector<> pos(i * length / nx, j * width / ny, k * width / nz);
+                auto node = chrono_types::make_shared<ChNodeFEAxyz>(pos);
+                c.mesh->AddNode(node);
+                nodes.push_back(node);
+                if (i == 0)
+                    c.root.push_back(node);
+                if (i == nx)
+                    c.tip.push_back(node);
+            }
+        }
+    }
+
+    auto N = [&](int i, int j, int k) { return nodes[(i * (ny + 1) + j) * (nz + 1) + k]; };
+    for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) {
+            for (int k = 0; k < nz; k++) {
+                auto element = chrono_types::make_shared<ChElementHexaCorot_8>();
+                element->SetNodes(N(i, j, k), N(i, j + 1, k), N(i, j + 1, k + 1), N(i, j, k + 1),          //
+                                  N(i + 1, j, k), N(i + 1, j + 1, k), N(i + 1, j + 1, k + 1), N(i + 1, j, k + 1));
+                element->SetMaterial(material);
+                c.mesh->AddElement(element);
+            }
+        }
+    }
+
+    return c;
+}
+
+// Replace the cantilever mesh with a mesh containing a single Craig-Bampton element.
+static std::shared_ptr<ChElementCraigBampton> Reduce(Cantilever& c, int num_modes) {
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> boundary = c.root;
+    boundary.insert(boundary.end(), c.tip.begin(), c.tip.end());
+
+    auto element = chrono_types::make_shared<ChElementCraigBampton>();
+    element->Initialize(c.mesh, boundary, num_modes);
+
+    c.mesh = chrono_types::make_shared<ChMesh>();
+    for (auto& node : boundary)
+        c.mesh->AddNode(node);
+    c.mesh->AddNode(element->GetModalNode());
+    c.mesh->AddElement(element);
+
+    return element;
+}
+
+static void SetupSystem(ChSystemSMC& sys, Cantilever& c) {
+    sys.Add(c.mesh);
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+    for (auto& node : c.root)
+        node->SetFixed(true);
+}
+
+TEST(ChElementCraigBampton, static_response) {
+    Cantilever full = CreateCantilever();
+    Cantilever reduced = CreateCantilever();
+    auto element = Reduce(reduced, 4);
+    ASSERT_EQ(element->GetNdofs(), 3 * 18 + 4);
+
+    ChSystemSMC sys_full;
+    ChSystemSMC sys_reduced;
+    sys_full.Set_G_acc(ChVector<>(0, 0, 0));
+    sys_reduced.Set_G_acc(ChVector<>(0, 0, 0));
+    SetupSystem(sys_full, full);
+    SetupSystem(sys_reduced, reduced);
+
+    for (size_t i = 0; i < full.tip.size(); i++) {
+        full.tip[i]->SetForce(ChVector<>(10, 20, -30));
+        reduced.tip[i]->SetForce(ChVector<>(10, 20, -30));
+    }
+
+    sys_full.DoStaticLinear();
+    sys_reduced.DoStaticLinear();
+
+    double disp = (full.tip[0]->GetPos() - full.tip[0]->GetX0()).Length();
+    ASSERT_GT(disp, 1e-6);
+    for (size_t i = 0; i < full.tip.size(); i++) {
+        double err = (full.tip[i]->GetPos() - reduced.tip[i]->GetPos()).Length();
+        ASSERT_LT(err, 1e-8 * disp) << "node " << i;
+    }
+
+    // The recovered displacements of the interior nodes match those of the full mesh (no modal response to loads
+    // applied at the boundary nodes)
+    ChVectorDynamic<> u;
+    element->GetFullDisplacements(u);
+    const auto& nodes = full.mesh->GetNodes();
+    ASSERT_EQ(u.size(), 3 * (int)nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        auto node = std::static_pointer_cast<ChNodeFEAxyz>(nodes[i]);
+        double err = (ChVector<>(u.segment(3 * i, 3)) - (node->GetPos() - node->GetX0())).Length();
+        ASSERT_LT(err, 1e-8 * disp) << "node " << i;
+    }
+}
+
+TEST(ChElementCraigBampton, dynamic_response) {
+    Cantilever full = CreateCantilever();
+    Cantilever reduced = CreateCantilever();
+    auto element = Reduce(reduced, 6);
+
+    // Fixed-interface frequencies are sorted and positive
+    const auto& freq = element->GetFrequencies();
+    ASSERT_EQ(freq.size(), 6);
+    ASSERT_GT(freq(0), 0);
+    for (int k = 1; k < freq.size(); k++)
+        ASSERT_GE(freq(k), freq(k - 1));
+
+    ChSystemSMC sys_full;
+    ChSystemSMC sys_reduced;
+    sys_full.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys_reduced.Set_G_acc(ChVector<>(0, 0, -9.81));
+    SetupSystem(sys_full, full);
+    SetupSystem(sys_reduced, reduced);
+    sys_full.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    sys_reduced.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    double max_disp = 0;
+    double max_err = 0;
+    for (int i = 0; i < 50; i++) {
+        sys_full.DoStepDynamics(2e-4);
+        sys_reduced.DoStepDynamics(2e-4);
+        auto node_full = full.tip.back();
+        auto node_reduced = reduced.tip.back();
+        max_disp = std::max(max_disp, (node_full->GetPos() - node_full->GetX0()).Length());
+        max_err = std::max(max_err, (node_full->GetPos() - node_reduced->GetPos()).Length());
+    }
+
+    ASSERT_GT(max_disp, 1e-6);
+    ASSERT_LT(max_err, 0.02 * max_disp);
+
+    // The recovered displacements of the boundary nodes are those of the reduced model
+    ChVectorDynamic<> u;
+    element->GetFullDisplacements(u);
+    ASSERT_EQ(u.size(), 3 * 11 * 9);
+    ChVector<> tip_disp = reduced.tip.back()->GetPos() - reduced.tip.back()->GetX0();
+    ASSERT_NEAR((ChVector<>(u.segment(3 * (11 * 9 - 1), 3)) - tip_disp).Length(), 0, 1e-12);
+}
@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for reuse of the Newton matrix across steps in the implicit
+// integrators (HHT and Euler implicit).
+// An ANCF cable cantilever falls under gravity. The simulation is performed with
+// and without Newton matrix reuse. Results must agree within the integrator
+// tolerances, with significantly fewer calls to the solver setup when reusing.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/fea/ChElementCableANCF.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Simulate the cable and return the final tip position. Also return the total number of solver setup calls.
+static ChVector<> Simulate(ChTimestepper::Type type, bool reuse, int& num_setups) {
+    ChSystemSMC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    system.Add(mesh);
+
+    auto section = chrono_types::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.02);
+    section->SetYoungModulus(1e7);
+    section->SetDensity(1000);
+    section->SetI(CH_C_PI / 4.0 * std::pow(0.01, 4));
+
+    int num_elements = 10;
+    double length = 1.0;
+    std::shared_ptr<ChNodeFEAxyzD> node_prev;
+    for (int i = 0; i <= num_elements; i++) {
+        auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * length / num_elements, 0, 0),
+                                                             ChVector<>(1, 0, 0));
+        mesh->AddNode(node);
+        if (i == 0) {
+            node->SetFixed(true);
+        } else {
+            auto element = chrono_types::make_shared<ChElementCableANCF>();
+            element->SetNodes(node_prev, node);
+            element->SetSection(section);
+            mesh->AddElement(element);
+        }
+        node_prev = node;
+    }
+    auto tip = node_prev;
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->LockSparsityPattern(true);
+    system.SetSolver(solver);
+
+    system.SetTimestepperType(type);
+    auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(system.GetTimestepper());
+    integrator->SetMaxiters(20);
+    integrator->SetAbsTolerances(1e-8);
+    integrator->SetJacobianReuse(reuse);
+    if (type == ChTimestepper::Type::HHT) {
+        auto hht = std::static_pointer_cast<ChTimestepperHHT>(system.GetTimestepper());
+        hht->SetStepControl(false);
+    }
+
+    num_setups = 0;
+    for (int i = 0; i < 500; i++) {
+        system.DoStepDynamics(1e-3);
+        num_setups += integrator->GetNumSetupCalls();
+    }
+
+    return tip->GetPos();
+}
+
+class JacobianReuseTest : public ::testing::TestWithParam<ChTimestepper::Type> {};
+
+TEST_P(JacobianReuseTest, cantilever) {
+    int setups_full, setups_reuse;
+    auto pos_full = Simulate(GetParam(), false, setups_full);
+    auto pos_reuse = Simulate(GetParam(), true, setups_reuse);
+
+    ASSERT_LT(setups_reuse, setups_full / 2);
+    ASSERT_NEAR(pos_full.x(), pos_reuse.x(), 1e-3);
+    ASSERT_NEAR(pos_full.y(), pos_reuse.y(), 1e-3);
+}
+
+INSTANTIATE_TEST_SUITE_P(FEA,
+                         JacobianReuseTest,
+                         ::testing::Values(ChTimestepper::Type::HHT, ChTimestepper::Type::EULER_IMPLICIT));
@@ -0,0 +1,105 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the parallel (colored) loading of the FEA stiffness blocks in
+// the assembled system matrix. A plate of ANCF shell elements is assembled and
+// solved with a direct sparse solver using one and several threads, first with
+// the sparsity pattern learner (reserved, uncompressed matrix) and then with the
+// locked, compressed sparsity pattern. The assembled matrices and the solutions
+// must agree.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Create a clamped square plate of N x N ANCF shell elements.
+static std::shared_ptr<ChNodeFEAxyzD> CreatePlate(ChSystemSMC& system, int N) {
+    system.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    system.Add(mesh);
+
+    double length = 1;
+    double thickness = 0.01;
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(500, 2.1e7, 0.3);
+
+    double dx = length / N;
+    ChVector<> dir(0, 0, 1);
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int j = 0; j <= N; j++) {
+        for (int i = 0; i <= N; i++) {
+            auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, j * dx, 0), dir);
+            node->SetFixed(i == 0);
+            mesh->AddNode(node);
+            nodes.push_back(node);
+        }
+    }
+
+    for (int j = 0; j < N; j++) {
+        for (int i = 0; i < N; i++) {
+            int n0 = j * (N + 1) + i;
+            auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+            element->SetNodes(nodes[n0], nodes[n0 + 1], nodes[n0 + N + 2], nodes[n0 + N + 1]);
+            element->SetDimensions(dx, dx);
+            element->AddLayer(thickness, 0, mat);
+            element->SetAlphaDamp(0.0);
+            mesh->AddElement(element);
+        }
+    }
+
+    return nodes.back();
+}
+
+TEST(ChSystemDescriptor, kblock_assembly) {
+    int N = 16;
+
+    ChSystemSMC sys_serial;
+    ChSystemSMC sys_parallel;
+    auto tip_serial = CreatePlate(sys_serial, N);
+    auto tip_parallel = CreatePlate(sys_parallel, N);
+    sys_serial.SetNumThreads(1);
+    sys_parallel.SetNumThreads(4);
+
+    auto solver_serial = chrono_types::make_shared<ChSolverSparseLU>();
+    auto solver_parallel = chrono_types::make_shared<ChSolverSparseLU>();
+    solver_serial->LockSparsityPattern(true);
+    solver_parallel->LockSparsityPattern(true);
+    sys_serial.SetSolver(solver_serial);
+    sys_parallel.SetSolver(solver_parallel);
+
+    // The first call uses the sparsity pattern learner; the second one reuses the compressed matrix.
+    for (int i = 0; i < 2; i++) {
+        sys_serial.DoStaticLinear();
+        sys_parallel.DoStaticLinear();
+
+        const auto& Z_serial = solver_serial->GetMatrix();
+        const auto& Z_parallel = solver_parallel->GetMatrix();
+        ASSERT_EQ(Z_serial.nonZeros(), Z_parallel.nonZeros());
+        double norm = Z_serial.norm();
+        double diff = (Z_serial - Z_parallel).norm();
+        ASSERT_LT(diff, 1e-12 * norm) << "call " << i;
+
+        ASSERT_NEAR((tip_serial->GetPos() - tip_parallel->GetPos()).Length(), 0, 1e-10) << "call " << i;
+    }
+
+    ASSERT_LT(tip_serial->GetPos().z(), 0);
+}
@@ -0,0 +1,149 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the preconditioners of the Chrono iterative linear solvers.
+// A pendulum made of an ANCF cable attached to the ground and carrying a rigid
+// body at its free end (a saddle-point problem) is simulated with MINRES and
+// GMRES using the available preconditioners. The results must agree with those
+// obtained with a direct sparse solver. Preconditioners which are not symmetric
+// positive definite are replaced by the diagonal preconditioner in MINRES.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/fea/ChElementCableANCF.h"
+#include "chrono/fea/ChLinkPointFrame.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Create the cable pendulum and return the body at its free end.
+static std::shared_ptr<ChBody> CreatePendulum(ChSystemSMC& sys) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    auto section = chrono_types::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.02);
+    section->SetYoungModulus(1e7);
+    section->SetDensity(1000);
+
+    int num_elements = 10;
+    double length = 1.0;
+    double dx = length / num_elements;
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int i = 0; i <= num_elements; i++) {
+        auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, 0, 0), ChVector<>(1, 0, 0));
+        mesh->AddNode(node);
+        nodes.push_back(node);
+    }
+    for (int i = 0; i < num_elements; i++) {
+        auto element = chrono_types::make_shared<ChElementCableANCF>();
+        element->SetNodes(nodes[i], nodes[i + 1]);
+        element->SetSection(section);
+        mesh->AddElement(element);
+    }
+
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetPos(ChVector<>(length, 0, 0));
+    body->SetMass(2);
+    body->SetInertiaXX(ChVector<>(0.01, 0.01, 0.01));
+    sys.AddBody(body);
+
+    auto joint_ground = chrono_types::make_shared<ChLinkPointFrame>();
+    joint_ground->Initialize(nodes.front(), ground);
+    sys.Add(joint_ground);
+
+    auto joint_body = chrono_types::make_shared<ChLinkPointFrame>();
+    joint_body->Initialize(nodes.back(), body);
+    sys.Add(joint_body);
+
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    return body;
+}
+
+// Reference solution, obtained with a direct sparse solver.
+static ChVector<> Reference(int num_steps, double step) {
+    ChSystemSMC sys;
+    auto body = CreatePendulum(sys);
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(step);
+    return body->GetPos();
+}
+
+static void Check(std::shared_ptr<ChIterativeSolverLS> solver, std::shared_ptr<ChPreconditioner> precond) {
+    int num_steps = 5;
+    double step = 1e-3;
+
+    ChSystemSMC sys;
+    auto body = CreatePendulum(sys);
+    solver->SetMaxIterations(1000);
+    solver->SetTolerance(1e-12);
+    solver->SetPreconditioner(precond);
+    sys.SetSolver(solver);
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(step);
+
+    ChVector<> ref = Reference(num_steps, step);
+    ASSERT_NEAR((body->GetPos() - ref).Length(), 0, 1e-8);
+    ASSERT_GT(solver->GetTimeSetup_Preconditioner(), 0);
+    ASSERT_GT(solver->GetTimeSolve_Preconditioner(), 0);
+    ASSERT_LE(solver->GetTimeSolve_Preconditioner(), solver->GetTimeSolve_SolverCall());
+}
+
+TEST(ChPreconditioner, block_jacobi_minres) {
+    Check(chrono_types::make_shared<ChSolverMINRES>(), chrono_types::make_shared<ChPreconditionerBlockJacobi>());
+}
+
+TEST(ChPreconditioner, block_jacobi_gmres) {
+    Check(chrono_types::make_shared<ChSolverGMRES>(), chrono_types::make_shared<ChPreconditionerBlockJacobi>());
+}
+
+TEST(ChPreconditioner, ilu0_gmres) {
+    Check(chrono_types::make_shared<ChSolverGMRES>(), chrono_types::make_shared<ChPreconditionerILU0>());
+}
+
+TEST(ChPreconditioner, ilu0_minres) {
+    auto precond = chrono_types::make_shared<ChPreconditionerILU0>();
+    Check(chrono_types::make_shared<ChSolverMINRES>(), precond);
+    ASSERT_FALSE(precond->IsSymmetricPositiveDefinite());
+}
+
+TEST(ChPreconditioner, ic0_minres) {
+    // The problem matrix is indefinite, so that pivots are replaced and MINRES falls back to the diagonal
+    auto precond = chrono_types::make_shared<ChPreconditionerIC0>();
+    Check(chrono_types::make_shared<ChSolverMINRES>(), precond);
+    ASSERT_GT(precond->GetNumShiftedPivots(), 0);
+    ASSERT_FALSE(precond->IsSymmetricPositiveDefinite());
+}
+
+TEST(ChPreconditioner, schur_minres) {
+    Check(chrono_types::make_shared<ChSolverMINRES>(), chrono_types::make_shared<ChPreconditionerSchur>());
+}
+
+TEST(ChPreconditioner, schur_gmres) {
+    Check(chrono_types::make_shared<ChSolverGMRES>(), chrono_types::make_shared<ChPreconditionerSchur>());
+}
@@ -0,0 +1,169 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Chrono::Multicore unit test for the matrix-free Shur product.
+// Two identical NSC systems (a pile of spheres and boxes on a fixed ground) are
+// advanced by one step, one with the assembled contact Jacobian and one with the
+// matrix-free contact Jacobian products. The Shur products N*x and the normal
+// contact products D_n^T*v of the two systems are then compared.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+#include "chrono_multicore/solver/ChSolverMulticore.h"
+
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+
+static ChSystemMulticoreNSC* CreateSystem(SolverMode mode, bool matrix_free) {
+    ChSystemMulticoreNSC* sys = new ChSystemMulticoreNSC;
+    sys->Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys->SetNumThreads(1);
+
+    sys->GetSettings()->solver.solver_mode = mode;
+    sys->GetSettings()->solver.max_iteration_normal = 10;
+    sys->GetSettings()->solver.max_iteration_sliding = mode != SolverMode::NORMAL ? 10 : 0;
+    sys->GetSettings()->solver.max_iteration_spinning = mode == SolverMode::SPINNING ? 10 : 0;
+    sys->GetSettings()->solver.max_iteration_bilateral = 0;
+    sys->GetSettings()->solver.matrix_free = matrix_free;
+    sys->GetSettings()->collision.collision_envelope = 0.005;
+    sys->GetSettings()->collision.bins_per_axis = vec3(10, 10, 10);
+    sys->ChangeSolverType(SolverType::APGD);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+    mat->SetRollingFriction(0.01f);
+    mat->SetSpinningFriction(0.01f);
+
+    std::shared_ptr<ChBody> ground(sys->NewBody());
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), mat, ChVector<>(1, 1, 0.1), ChVector<>(0, 0, -0.1));
+    ground->GetCollisionModel()->BuildModel();
+    sys->AddBody(ground);
+
+    // Lattice of touching spheres, with every third item replaced by a rotated box
+    double radius = 0.05;
+    double mass = 1;
+    for (int ix = 0; ix < 4; ix++) {
+        for (int iy = 0; iy < 4; iy++) {
+            for (int iz = 0; iz < 3; iz++) {
+                std::shared_ptr<ChBody> body(sys->NewBody());
+                body->SetMass(mass);
+                body->SetInertiaXX(0.4 * mass * radius * radius * ChVector<>(1, 1, 1));
+                body->SetPos(ChVector<>(2 * radius * (ix - 1.5), 2 * radius * (iy - 1.5), radius + 2 * radius * iz));
+                body->SetCollide(true);
+                body->GetCollisionModel()->ClearModel();
+                if ((ix + iy + iz) % 3 == 0) {
+                    body->SetRot(Q_from_AngZ(0.2 * ix + 0.1 * iy));
+                    utils::AddBoxGeometry(body.get(), mat, ChVector<>(0.8, 0.9, 1.0) * radius);
+                } else {
+                    utils::AddSphereGeometry(body.get(), mat, radius);
+                }
+                body->GetCollisionModel()->BuildModel();
+                sys->AddBody(body);
+            }
+        }
+    }
+
+    sys->DoStepDynamics(1e-3);
+
+    return sys;
+}
+
+// Compare two vectors, with a tolerance relative to their largest entry.
+static void CompareVectors(const DynamicVector<real>& a, const DynamicVector<real>& b, real rtol) {
+    ASSERT_EQ(a.size(), b.size());
+    real scale = 0;
+    for (size_t i = 0; i < a.size(); i++)
+        scale = std::max(scale, std::abs(a[i]));
+    ASSERT_GT(scale, 0);
+    for (size_t i = 0; i < a.size(); i++)
+        ASSERT_NEAR(a[i], b[i], rtol * scale) << "index " << i;
+}
+
+class ShurMatrixFreeTest : public ::testing::TestWithParam<SolverMode> {
+  protected:
+    ShurMatrixFreeTest() {
+        sys_assembled = CreateSystem(GetParam(), false);
+        sys_matrix_free = CreateSystem(GetParam(), true);
+    }
+    ~ShurMatrixFreeTest() {
+        delete sys_assembled;
+        delete sys_matrix_free;
+    }
+
+    ChSystemMulticoreNSC* sys_assembled;
+    ChSystemMulticoreNSC* sys_matrix_free;
+};
+
+TEST_P(ShurMatrixFreeTest, products) {
+    ChMulticoreDataManager* dm_a = sys_assembled->data_manager;
+    ChMulticoreDataManager* dm_f = sys_matrix_free->data_manager;
+
+    ASSERT_FALSE(dm_a->rigid_rigid->IsMatrixFree());
+    ASSERT_TRUE(dm_f->rigid_rigid->IsMatrixFree());
+    ASSERT_GT(dm_a->cd_data->num_rigid_contacts, 0u);
+    ASSERT_EQ(dm_a->cd_data->num_rigid_contacts, dm_f->cd_data->num_rigid_contacts);
+    ASSERT_EQ(dm_a->num_constraints, dm_f->num_constraints);
+
+    ChShurProduct shur_a;
+    ChShurProduct shur_f;
+    shur_a.Setup(dm_a);
+    shur_f.Setup(dm_f);
+
+    // Shur products, for all (local) solver modes up to the system's solver mode
+    uint n = dm_a->num_constraints;
+    DynamicVector<real> x(n);
+    for (uint i = 0; i < n; i++)
+        x[i] = std::sin(0.37 * i) + 0.5;
+
+    std::vector<SolverMode> local_modes = {SolverMode::NORMAL, SolverMode::SLIDING, SolverMode::SPINNING};
+    for (auto local_mode : local_modes) {
+        if (local_mode > GetParam())
+            break;
+        dm_a->settings.solver.local_solver_mode = local_mode;
+        dm_f->settings.solver.local_solver_mode = local_mode;
+
+        DynamicVector<real> Nx_a(n);
+        DynamicVector<real> Nx_f(n);
+        shur_a(x, Nx_a);
+        shur_f(x, Nx_f);
+        CompareVectors(Nx_a, Nx_f, 1e-10);
+    }
+
+    // Normal contact products
+    uint num_dof = 6 * dm_a->num_rigid_bodies;
+    DynamicVector<real> v(num_dof);
+    for (uint i = 0; i < num_dof; i++)
+        v[i] = std::cos(0.23 * i);
+
+    DynamicVector<real> D_n_T_v_a;
+    DynamicVector<real> D_n_T_v_f;
+    shur_a.NormalContactProduct(v, D_n_T_v_a);
+    shur_f.NormalContactProduct(v, D_n_T_v_f);
+    ASSERT_EQ(D_n_T_v_a.size(), dm_a->cd_data->num_rigid_contacts);
+    CompareVectors(D_n_T_v_a, D_n_T_v_f, 1e-10);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoMulticore,
+                         ShurMatrixFreeTest,
+                         ::testing::Values(SolverMode::NORMAL, SolverMode::SLIDING, SolverMode::SPINNING));
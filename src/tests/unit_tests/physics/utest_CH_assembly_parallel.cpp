@@ -0,0 +1,234 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the parallel update of bodies and links in ChAssembly and for
+// the body state block.
+// A chain of bodies connected by springs, with a few links which are always
+// processed sequentially (actuators and motors sharing a motor function), is
+// simulated with and without parallel update.
+// State functions (residual loads) and the resulting motion must agree. The
+// same holds with the body state block enabled, for which the state gather,
+// scatter and increment are also compared against the per-body functions.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/physics/ChLinkLinActuator.h"
+#include "chrono/physics/ChLinkMotorRotationSpeed.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static void CreateModel(ChSystemNSC& system, int num_threads, bool parallel) {
+    system.SetNumThreads(num_threads, 1, 1);
+    system.EnableParallelUpdate(parallel);
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    // Motor function shared by several motors
+    auto motor_fun = chrono_types::make_shared<ChFunction_Sine>(0, 2, 1);
+
+    std::shared_ptr<ChBody> prev = ground;
+    for (int i = 0; i < 2000; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetPos(ChVector<>((i + 1) * 0.1, 0, 0));
+        body->SetWvel_loc(ChVector<>(0.1 * (i % 7), 0, 0.2));
+        system.AddBody(body);
+
+        auto spring = chrono_types::make_shared<ChLinkTSDA>();
+        spring->Initialize(prev, body, false, prev->GetPos(), body->GetPos(), false, 0.09);
+        spring->SetSpringCoefficient(1000);
+        spring->SetDampingCoefficient(10);
+        system.AddLink(spring);
+
+        // A few links which are not thread safe
+        if (i % 500 == 0) {
+            auto actuator = chrono_types::make_shared<ChLinkLinActuator>();
+            actuator->Initialize(ground, body, false, ChCoordsys<>(ground->GetPos()), ChCoordsys<>(body->GetPos()));
+            actuator->Set_lin_offset((body->GetPos() - ground->GetPos()).Length());
+            system.AddLink(actuator);
+        }
+        if (i % 500 == 250) {
+            auto motor = chrono_types::make_shared<ChLinkMotorRotationSpeed>();
+            motor->Initialize(body, ground, ChFrame<>(body->GetPos()));
+            motor->SetMotorFunction(motor_fun);
+            system.AddLink(motor);
+        }
+
+        prev = body;
+    }
+
+    system.SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+    system.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+}
+
+TEST(ChAssembly, thread_safety_flags) {
+    std::shared_ptr<ChPhysicsItem> spring = chrono_types::make_shared<ChLinkTSDA>();
+    std::shared_ptr<ChPhysicsItem> actuator = chrono_types::make_shared<ChLinkLinActuator>();
+    std::shared_ptr<ChPhysicsItem> motor = chrono_types::make_shared<ChLinkMotorRotationSpeed>();
+    ASSERT_TRUE(spring->IsUpdateThreadSafe());
+    ASSERT_FALSE(actuator->IsUpdateThreadSafe());
+    ASSERT_FALSE(motor->IsUpdateThreadSafe());
+}
+
+TEST(ChAssembly, parallel_residuals) {
+    ChSystemNSC sys_serial;
+    ChSystemNSC sys_parallel;
+    CreateModel(sys_serial, 1, false);
+    CreateModel(sys_parallel, 4, true);
+
+    ChVectorDynamic<> R[2];
+    ChSystemNSC* systems[2] = {&sys_serial, &sys_parallel};
+    for (int k = 0; k < 2; k++) {
+        auto sys = systems[k];
+        sys->Setup();
+        sys->Update();
+
+        ChState x(sys->GetNcoords_x(), sys);
+        ChStateDelta v(sys->GetNcoords_v(), sys);
+        double T;
+        sys->StateGather(x, v, T);
+        sys->StateScatter(x, v, T, true);
+
+        R[k].setZero(sys->GetNcoords_v());
+        sys->LoadResidual_F(R[k], 1.0);
+        sys->LoadResidual_Mv(R[k], v, 2.0);
+    }
+
+    ASSERT_EQ(R[0].size(), R[1].size());
+    for (int i = 0; i < R[0].size(); i++)
+        ASSERT_NEAR(R[0](i), R[1](i), 1e-9 * (1 + std::abs(R[0](i))));
+}
+
+TEST(ChAssembly, parallel_simulation) {
+    ChSystemNSC sys_serial;
+    ChSystemNSC sys_parallel;
+    CreateModel(sys_serial, 1, false);
+    CreateModel(sys_parallel, 4, true);
+
+    for (int i = 0; i < 20; i++) {
+        sys_serial.DoStepDynamics(1e-3);
+        sys_parallel.DoStepDynamics(1e-3);
+    }
+
+    const auto& bodies_serial = sys_serial.Get_bodylist();
+    const auto& bodies_parallel = sys_parallel.Get_bodylist();
+    for (size_t i = 0; i < bodies_serial.size(); i++) {
+        ASSERT_NEAR(bodies_serial[i]->GetPos().x(), bodies_parallel[i]->GetPos().x(), 1e-8);
+        ASSERT_NEAR(bodies_serial[i]->GetPos().y(), bodies_parallel[i]->GetPos().y(), 1e-8);
+        ASSERT_NEAR(bodies_serial[i]->GetPos().z(), bodies_parallel[i]->GetPos().z(), 1e-8);
+    }
+}
+
+TEST(ChAssembly, body_state_block_functions) {
+    ChSystemNSC sys_default;
+    ChSystemNSC sys_block;
+    CreateModel(sys_default, 1, false);
+    CreateModel(sys_block, 4, true);
+    sys_block.EnableBodyStateBlock(true);
+
+    ChSystemNSC* systems[2] = {&sys_default, &sys_block};
+    ChState x[2];
+    ChStateDelta v[2];
+    ChState x_new[2];
+    ChState x_scat[2];
+    ChStateDelta v_scat[2];
+    ChVectorDynamic<> R[2];
+    for (int k = 0; k < 2; k++) {
+        auto sys = systems[k];
+        sys->Setup();
+        sys->Update();
+
+        int nx = sys->GetNcoords_x();
+        int nv = sys->GetNcoords_v();
+        double T;
+        x[k].setZero(nx, sys);
+        v[k].setZero(nv, sys);
+        sys->StateGather(x[k], v[k], T);
+
+        // Increment by a rotation and translation
+        ChStateDelta Dv(nv, sys);
+        for (int i = 0; i < nv; i++)
+            Dv(i) = 1e-3 * std::sin(0.1 * i);
+        x_new[k].setZero(nx, sys);
+        sys->StateIncrementX(x_new[k], x[k], Dv);
+
+        // Scatter the new state, then gather it back
+        ChStateDelta v_new(nv, sys);
+        v_new = v[k] + Dv;
+        sys->StateScatter(x_new[k], v_new, T + 1e-3, true);
+        x_scat[k].setZero(nx, sys);
+        v_scat[k].setZero(nv, sys);
+        sys->StateGather(x_scat[k], v_scat[k], T);
+
+        R[k].setZero(nv);
+        sys->LoadResidual_Mv(R[k], v_new, 2.0);
+    }
+
+    ASSERT_EQ(x[0].size(), x[1].size());
+    for (int i = 0; i < x[0].size(); i++) {
+        ASSERT_NEAR(x[0](i), x[1](i), 1e-12);
+        ASSERT_NEAR(x_new[0](i), x_new[1](i), 1e-12);
+        ASSERT_NEAR(x_scat[0](i), x_scat[1](i), 1e-12);
+        ASSERT_NEAR(x_scat[1](i), x_new[1](i), 1e-12);
+    }
+    ASSERT_EQ(v[0].size(), v[1].size());
+    for (int i = 0; i < v[0].size(); i++) {
+        ASSERT_NEAR(v[0](i), v[1](i), 1e-12);
+        ASSERT_NEAR(v_scat[0](i), v_scat[1](i), 1e-12);
+        ASSERT_NEAR(R[0](i), R[1](i), 1e-12 * (1 + std::abs(R[0](i))));
+    }
+
+    // Body states after the scatter
+    const auto& bodies_default = sys_default.Get_bodylist();
+    const auto& bodies_block = sys_block.Get_bodylist();
+    for (size_t i = 0; i < bodies_default.size(); i++) {
+        ASSERT_NEAR((bodies_default[i]->GetPos() - bodies_block[i]->GetPos()).Length(), 0, 1e-12);
+        ASSERT_NEAR((bodies_default[i]->GetRot() - bodies_block[i]->GetRot()).Length(), 0, 1e-12);
+        ASSERT_NEAR((bodies_default[i]->GetPos_dt() - bodies_block[i]->GetPos_dt()).Length(), 0, 1e-12);
+        ASSERT_NEAR((bodies_default[i]->GetWvel_loc() - bodies_block[i]->GetWvel_loc()).Length(), 0, 1e-12);
+    }
+}
+
+TEST(ChAssembly, body_state_block) {
+    ChSystemNSC sys_default;
+    ChSystemNSC sys_block;
+    CreateModel(sys_default, 1, false);
+    CreateModel(sys_block, 4, true);
+    sys_block.EnableBodyStateBlock(true);
+
+    for (int i = 0; i < 20; i++) {
+        sys_default.DoStepDynamics(1e-3);
+        sys_block.DoStepDynamics(1e-3);
+    }
+
+    const auto& bodies_default = sys_default.Get_bodylist();
+    const auto& bodies_block = sys_block.Get_bodylist();
+    for (size_t i = 0; i < bodies_default.size(); i++) {
+        ASSERT_NEAR(bodies_default[i]->GetPos().x(), bodies_block[i]->GetPos().x(), 1e-8);
+        ASSERT_NEAR(bodies_default[i]->GetPos().y(), bodies_block[i]->GetPos().y(), 1e-8);
+        ASSERT_NEAR(bodies_default[i]->GetPos().z(), bodies_block[i]->GetPos().z(), 1e-8);
+        ASSERT_NEAR(bodies_default[i]->GetRot().e0(), bodies_block[i]->GetRot().e0(), 1e-8);
+        ASSERT_NEAR(bodies_default[i]->GetRot().e1(), bodies_block[i]->GetRot().e1(), 1e-8);
+        ASSERT_NEAR(bodies_default[i]->GetRot().e3(), bodies_block[i]->GetRot().e3(), 1e-8);
+    }
+}
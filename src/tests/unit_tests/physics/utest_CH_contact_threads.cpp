@@ -0,0 +1,210 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the multithreaded contact container state functions.
+// A layer of spheres resting on a fixed plate (with enough contacts to trigger
+// the parallel code path) is simulated with 1 and with several threads. The
+// resulting body states must match up to round-off in the reductions.
+// The single-threaded run must also match, bit for bit, a run with contact
+// containers which evaluate and load all contacts serially, one at a time.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChContactContainerSMC.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+// NSC contact container with serial residual loading (reference).
+class SerialContactContainerNSC : public ChContactContainerNSC {
+  public:
+    virtual void IntLoadResidual_CqL(const unsigned int off_L,
+                                     ChVectorDynamic<>& R,
+                                     const ChVectorDynamic<>& L,
+                                     const double c) override {
+        unsigned int coffset = 0;
+        Load(coffset, contactlist_6_6, off_L, R, L, c, 3);
+        Load(coffset, contactlist_6_3, off_L, R, L, c, 3);
+        Load(coffset, contactlist_3_3, off_L, R, L, c, 3);
+        Load(coffset, contactlist_333_3, off_L, R, L, c, 3);
+        Load(coffset, contactlist_333_6, off_L, R, L, c, 3);
+        Load(coffset, contactlist_333_333, off_L, R, L, c, 3);
+        Load(coffset, contactlist_666_3, off_L, R, L, c, 3);
+        Load(coffset, contactlist_666_6, off_L, R, L, c, 3);
+        Load(coffset, contactlist_666_333, off_L, R, L, c, 3);
+        Load(coffset, contactlist_666_666, off_L, R, L, c, 3);
+        Load(coffset, contactlist_6_6_rolling, off_L, R, L, c, 6);
+    }
+
+  private:
+    template <class Tcont>
+    static void Load(unsigned int& coffset,
+                     ChContactPool<Tcont>& contactlist,
+                     const unsigned int off_L,
+                     ChVectorDynamic<>& R,
+                     const ChVectorDynamic<>& L,
+                     const double c,
+                     const int stride) {
+        for (size_t i = 0; i < contactlist.size(); i++) {
+            contactlist[i]->ContIntLoadResidual_CqL(off_L + coffset, R, L, c);
+            coffset += stride;
+        }
+    }
+};
+
+// SMC contact container with serial contact force evaluation and residual loading (reference).
+class SerialContactContainerSMC : public ChContactContainerSMC {
+  public:
+    virtual void EndAddContact() override {
+        ChContactContainerSMC::EndAddContact();
+        // Evaluate all contacts again, one at a time and in order
+        Evaluate(contactlist_3_3);
+        Evaluate(contactlist_6_3);
+        Evaluate(contactlist_6_6);
+        Evaluate(contactlist_333_3);
+        Evaluate(contactlist_333_6);
+        Evaluate(contactlist_333_333);
+        Evaluate(contactlist_666_3);
+        Evaluate(contactlist_666_6);
+        Evaluate(contactlist_666_333);
+        Evaluate(contactlist_666_666);
+    }
+
+    virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override {
+        Load(contactlist_3_3, R, c);
+        Load(contactlist_6_3, R, c);
+        Load(contactlist_6_6, R, c);
+        Load(contactlist_333_3, R, c);
+        Load(contactlist_333_6, R, c);
+        Load(contactlist_333_333, R, c);
+        Load(contactlist_666_3, R, c);
+        Load(contactlist_666_6, R, c);
+        Load(contactlist_666_333, R, c);
+        Load(contactlist_666_666, R, c);
+    }
+
+  private:
+    template <class Tcont>
+    static void Evaluate(ChContactPool<Tcont>& contactlist) {
+        for (size_t i = 0; i < contactlist.size(); i++)
+            contactlist[i]->Evaluate();
+    }
+
+    template <class Tcont>
+    static void Load(ChContactPool<Tcont>& contactlist, ChVectorDynamic<>& R, const double c) {
+        for (size_t i = 0; i < contactlist.size(); i++)
+            contactlist[i]->ContIntLoadResidual_F(R, c);
+    }
+};
+
+// ====================================================================================
+
+class ContactThreadsTest : public ::testing::TestWithParam<ChContactMethod> {
+  protected:
+    // Simulate the model with the specified number of threads and return the final body positions.
+    // If requested, use the serial reference contact containers.
+    std::vector<ChVector<>> Simulate(int num_threads, int& num_contacts, bool serial_reference = false);
+};
+
+std::vector<ChVector<>> ContactThreadsTest::Simulate(int num_threads, int& num_contacts, bool serial_reference) {
+    auto method = GetParam();
+
+    ChSystem* system;
+    std::shared_ptr<ChMaterialSurface> material;
+    double step;
+    if (method == ChContactMethod::SMC) {
+        system = new ChSystemSMC;
+        material = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+        step = 1e-4;
+        if (serial_reference)
+            system->SetContactContainer(chrono_types::make_shared<SerialContactContainerSMC>());
+    } else {
+        system = new ChSystemNSC;
+        material = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+        step = 1e-3;
+        if (serial_reference)
+            system->SetContactContainer(chrono_types::make_shared<SerialContactContainerNSC>());
+    }
+    system->SetNumThreads(num_threads, 1, 1);
+    system->Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    double radius = 0.1;
+    int n = 20;
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(n * 2 * radius + 1, 0.2, n * 2 * radius + 1, 1000, false,
+                                                           true, material);
+    ground->SetPos(ChVector<>(0, -0.1, 0));
+    ground->SetBodyFixed(true);
+    system->AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> balls;
+    for (int ix = 0; ix < n; ix++) {
+        for (int iz = 0; iz < n; iz++) {
+            auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, material);
+            ball->SetPos(ChVector<>((ix - n / 2) * 2.5 * radius, 0.99 * radius, (iz - n / 2) * 2.5 * radius));
+            system->AddBody(ball);
+            balls.push_back(ball);
+        }
+    }
+
+    for (int i = 0; i < 100; i++)
+        system->DoStepDynamics(step);
+
+    num_contacts = system->GetNcontacts();
+
+    std::vector<ChVector<>> pos;
+    for (auto& ball : balls)
+        pos.push_back(ball->GetPos());
+
+    delete system;
+    return pos;
+}
+
+TEST_P(ContactThreadsTest, serial_vs_parallel) {
+    int nc1, nc4;
+    auto pos1 = Simulate(1, nc1);
+    auto pos4 = Simulate(4, nc4);
+
+    ASSERT_GT(nc1, ChContactContainer::min_parallel_contacts);
+    ASSERT_EQ(nc1, nc4);
+    for (size_t i = 0; i < pos1.size(); i++) {
+        ASSERT_NEAR(pos1[i].x(), pos4[i].x(), 1e-8);
+        ASSERT_NEAR(pos1[i].y(), pos4[i].y(), 1e-8);
+        ASSERT_NEAR(pos1[i].z(), pos4[i].z(), 1e-8);
+    }
+}
+
+TEST_P(ContactThreadsTest, serial_reference) {
+    int nc1, ncr;
+    auto pos1 = Simulate(1, nc1);
+    auto posr = Simulate(1, ncr, true);
+
+    ASSERT_GT(nc1, ChContactContainer::min_parallel_contacts);
+    ASSERT_EQ(nc1, ncr);
+    for (size_t i = 0; i < pos1.size(); i++) {
+        ASSERT_EQ(pos1[i].x(), posr[i].x());
+        ASSERT_EQ(pos1[i].y(), posr[i].y());
+        ASSERT_EQ(pos1[i].z(), posr[i].z());
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Physics, ContactThreadsTest, ::testing::Values(ChContactMethod::NSC, ChContactMethod::SMC));
@@ -0,0 +1,124 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the reuse of the symbolic factorization in ChDirectSolverLS.
+// A chain of pendulums is simulated with a sparse LU solver reusing the
+// symbolic factorization. The symbolic analysis must be performed only once
+// while the matrix sparsity pattern is unchanged, and again whenever a link is
+// added or removed. The results must agree with those obtained with a full
+// (symbolic and numeric) factorization at each step.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class PendulumChain {
+  public:
+    PendulumChain(bool reuse) {
+        system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+        solver = chrono_types::make_shared<ChSolverSparseLU>();
+        solver->ReuseSymbolicFactorization(reuse);
+        system.SetSolver(solver);
+        system.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+        ground = chrono_types::make_shared<ChBody>();
+        ground->SetBodyFixed(true);
+        system.AddBody(ground);
+
+        std::shared_ptr<ChBody> prev = ground;
+        for (int i = 0; i < 10; i++) {
+            auto body = chrono_types::make_shared<ChBody>();
+            body->SetPos(ChVector<>(i + 1.0, 0, 0));
+            system.AddBody(body);
+
+            auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+            joint->Initialize(prev, body, ChCoordsys<>(ChVector<>(i, 0, 0)));
+            system.AddLink(joint);
+
+            prev = body;
+        }
+        last = prev;
+    }
+
+    // Attach the end of the chain to the ground, at its current position.
+    void AddExtraLink() {
+        extra = chrono_types::make_shared<ChLinkLockSpherical>();
+        extra->Initialize(last, ground, ChCoordsys<>(last->GetPos()));
+        system.AddLink(extra);
+    }
+
+    void Advance(int num_steps) {
+        for (int i = 0; i < num_steps; i++)
+            system.DoStepDynamics(1e-3);
+    }
+
+    ChSystemNSC system;
+    std::shared_ptr<ChSolverSparseLU> solver;
+    std::shared_ptr<ChBody> ground;
+    std::shared_ptr<ChBody> last;
+    std::shared_ptr<ChLinkLockSpherical> extra;
+};
+
+// Check that the body states of the two systems agree.
+static void CompareStates(PendulumChain& chain1, PendulumChain& chain2) {
+    const auto& bodies1 = chain1.system.Get_bodylist();
+    const auto& bodies2 = chain2.system.Get_bodylist();
+    ASSERT_EQ(bodies1.size(), bodies2.size());
+    for (size_t i = 0; i < bodies1.size(); i++) {
+        ASSERT_NEAR((bodies1[i]->GetPos() - bodies2[i]->GetPos()).Length(), 0, 1e-10);
+        ASSERT_NEAR((bodies1[i]->GetPos_dt() - bodies2[i]->GetPos_dt()).Length(), 0, 1e-9);
+        ASSERT_NEAR((bodies1[i]->GetWvel_par() - bodies2[i]->GetWvel_par()).Length(), 0, 1e-9);
+    }
+}
+
+TEST(ChDirectSolverLS, symbolic_reuse) {
+    PendulumChain chain(true);  // reuse of symbolic factorization
+    PendulumChain ref(false);   // full factorization at each step
+
+    // Unchanged sparsity pattern: a single symbolic analysis
+    chain.Advance(5);
+    ref.Advance(5);
+    ASSERT_GE(chain.solver->GetNumSetupCalls(), 5);
+    ASSERT_EQ(chain.solver->GetNumAnalyzeCalls(), 1);
+    ASSERT_EQ(ref.solver->GetNumAnalyzeCalls(), 0);
+    CompareStates(chain, ref);
+
+    // Adding a link changes the sparsity pattern: new symbolic analysis
+    chain.AddExtraLink();
+    ref.AddExtraLink();
+    chain.Advance(5);
+    ref.Advance(5);
+    ASSERT_EQ(chain.solver->GetNumAnalyzeCalls(), 2);
+    CompareStates(chain, ref);
+
+    // Removing the link changes the sparsity pattern again
+    chain.system.RemoveLink(chain.extra);
+    ref.system.RemoveLink(ref.extra);
+    chain.Advance(5);
+    ref.Advance(5);
+    ASSERT_EQ(chain.solver->GetNumAnalyzeCalls(), 3);
+    CompareStates(chain, ref);
+
+    // The chain is still moving, so the numeric factorizations were not trivially identical
+    ASSERT_GT(chain.last->GetPos_dt().Length(), 1e-3);
+}
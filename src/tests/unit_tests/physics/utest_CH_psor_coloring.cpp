@@ -0,0 +1,95 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the parallel (colored) mode of the PSOR solver.
+// A few layers of spheres settle on a fixed plate. The colored solver must
+// produce results that do not depend on the number of threads and that agree
+// with the default (serial) PSOR solver at rest.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Simulate the model and return the final sphere positions.
+static std::vector<ChVector<>> Simulate(bool coloring, int num_threads, int& num_colors) {
+    ChSystemNSC system;
+    system.SetNumThreads(num_threads, 1, 1);
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->EnableColoring(coloring);
+    solver->SetMaxIterations(100);
+    system.SetSolver(solver);
+
+    auto material = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    material->SetFriction(0.5f);
+
+    double radius = 0.1;
+    int n = 8;
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(n * 2 * radius + 1, 0.2, n * 2 * radius + 1, 1000, false,
+                                                           true, material);
+    ground->SetPos(ChVector<>(0, -0.1, 0));
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> balls;
+    for (int iy = 0; iy < 3; iy++) {
+        for (int ix = 0; ix < n; ix++) {
+            for (int iz = 0; iz < n; iz++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, material);
+                ball->SetPos(ChVector<>((ix - n / 2) * 2 * radius, (2 * iy + 1) * radius, (iz - n / 2) * 2 * radius));
+                system.AddBody(ball);
+                balls.push_back(ball);
+            }
+        }
+    }
+
+    for (int i = 0; i < 200; i++)
+        system.DoStepDynamics(1e-3);
+
+    num_colors = solver->GetNumColors();
+
+    std::vector<ChVector<>> pos;
+    for (auto& ball : balls)
+        pos.push_back(ball->GetPos());
+    return pos;
+}
+
+TEST(ChSolverPSOR, coloring) {
+    int nc_serial, nc1, nc4;
+    auto pos_serial = Simulate(false, 1, nc_serial);
+    auto pos1 = Simulate(true, 1, nc1);
+    auto pos4 = Simulate(true, 4, nc4);
+
+    ASSERT_EQ(nc_serial, 0);
+    ASSERT_GT(nc1, 1);
+    ASSERT_EQ(nc1, nc4);
+
+    for (size_t i = 0; i < pos1.size(); i++) {
+        // Colored solver: independent of the number of threads (up to round-off in contact reductions)
+        ASSERT_NEAR(pos1[i].x(), pos4[i].x(), 1e-8);
+        ASSERT_NEAR(pos1[i].y(), pos4[i].y(), 1e-8);
+        ASSERT_NEAR(pos1[i].z(), pos4[i].z(), 1e-8);
+        // Colored vs. serial solver: same resting configuration
+        ASSERT_NEAR(pos1[i].y(), pos_serial[i].y(), 1e-3);
+    }
+}
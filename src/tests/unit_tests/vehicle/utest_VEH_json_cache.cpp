@@ -0,0 +1,126 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the cache of parsed JSON specification files. Several HMMWV
+// vehicles (WheeledVehicle with JSON powertrain and tires) are constructed
+// concurrently from the cache and simulated for a short time. Their topology
+// and final states must match those of a vehicle constructed without the cache.
+//
+// =============================================================================
+
+#include <thread>
+#include <vector>
+
+#include "chrono/core/ChGlobal.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/utils/ChUtilsJSON.h"
+#include "chrono_vehicle/wheeled_vehicle/vehicle/WheeledVehicle.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Summary of a short vehicle simulation.
+struct VehicleResult {
+    int num_bodies;
+    int num_links;
+    int num_coords;
+    ChVector<> pos;
+    ChQuaternion<> rot;
+    double speed;
+};
+
+// Construct an HMMWV from its JSON specification files and simulate it on flat terrain with constant driver inputs.
+static VehicleResult SimulateVehicle() {
+    WheeledVehicle vehicle(vehicle::GetDataFile("hmmwv/vehicle/HMMWV_Vehicle.json"), ChContactMethod::SMC);
+    vehicle.Initialize(ChCoordsys<>(ChVector<>(0, 0, 0.5), QUNIT));
+    vehicle.GetChassis()->SetFixed(false);
+
+    auto powertrain = ReadPowertrainJSON(vehicle::GetDataFile("hmmwv/powertrain/HMMWV_ShaftsPowertrain.json"));
+    vehicle.InitializePowertrain(powertrain);
+
+    for (auto& axle : vehicle.GetAxles()) {
+        for (auto& wheel : axle->GetWheels()) {
+            auto tire = ReadTireJSON(vehicle::GetDataFile("hmmwv/tire/HMMWV_TMeasyTire.json"));
+            vehicle.InitializeTire(tire, wheel, VisualizationType::NONE);
+        }
+    }
+
+    auto system = vehicle.GetSystem();
+    system->SetNumThreads(1, 1, 1);
+
+    RigidTerrain terrain(system);
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    terrain.AddPatch(mat, ChVector<>(0, 0, 0), ChVector<>(0, 0, 1), 100, 20);
+    terrain.Initialize();
+
+    ChDriver::Inputs inputs = {0.1, 0.5, 0.0};
+    double step = 2e-3;
+    for (int i = 0; i < 250; i++) {
+        double time = system->GetChTime();
+        terrain.Synchronize(time);
+        vehicle.Synchronize(time, inputs, terrain);
+        terrain.Advance(step);
+        vehicle.Advance(step);
+    }
+
+    VehicleResult result;
+    result.num_bodies = system->GetNbodies();
+    result.num_links = system->GetNlinks();
+    result.num_coords = system->GetNcoords_w();
+    result.pos = vehicle.GetVehiclePos();
+    result.rot = vehicle.GetVehicleRot();
+    result.speed = vehicle.GetVehicleSpeed();
+    return result;
+}
+
+TEST(ChUtilsJSON, cache_concurrent) {
+    vehicle::SetDataPath(GetChronoDataPath() + "vehicle/");
+
+    // Reference: vehicle constructed without the cache
+    EnableCacheJSON(false);
+    ClearCacheJSON();
+    VehicleResult ref = SimulateVehicle();
+    ASSERT_GT(ref.num_bodies, 0);
+
+    // Construct and simulate several vehicles concurrently, all reading their specification files from the cache
+    EnableCacheJSON(true);
+    int num_instances = 4;
+    std::vector<VehicleResult> results(num_instances);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_instances; i++)
+        threads.push_back(std::thread([&results, i]() { results[i] = SimulateVehicle(); }));
+    for (auto& t : threads)
+        t.join();
+
+    EnableCacheJSON(false);
+    ClearCacheJSON();
+
+    for (const auto& res : results) {
+        EXPECT_EQ(res.num_bodies, ref.num_bodies);
+        EXPECT_EQ(res.num_links, ref.num_links);
+        EXPECT_EQ(res.num_coords, ref.num_coords);
+        EXPECT_NEAR(res.pos.x(), ref.pos.x(), 1e-10);
+        EXPECT_NEAR(res.pos.y(), ref.pos.y(), 1e-10);
+        EXPECT_NEAR(res.pos.z(), ref.pos.z(), 1e-10);
+        EXPECT_NEAR(res.rot.e0(), ref.rot.e0(), 1e-10);
+        EXPECT_NEAR(res.rot.e1(), ref.rot.e1(), 1e-10);
+        EXPECT_NEAR(res.rot.e2(), ref.rot.e2(), 1e-10);
+        EXPECT_NEAR(res.rot.e3(), ref.rot.e3(), 1e-10);
+        EXPECT_NEAR(res.speed, ref.speed, 1e-10);
+    }
+}
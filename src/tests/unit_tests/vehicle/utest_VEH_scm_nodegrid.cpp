@@ -0,0 +1,282 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the tiled grid of node records used by the SCM deformable soil.
+// Records are inserted across tile boundaries, at negative grid coordinates, and
+// in far tiles outside the directory range set with Reset. Tiles are compacted
+// and expanded again; the node levels read from compacted tiles and all stored
+// record fields must survive the round trip.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+namespace chrono {
+namespace vehicle {
+
+// Access to the (private) node grid of the SCM soil.
+class SCMNodeGridTest {
+  public:
+    using NodeGrid = SCMDeformableSoil::NodeGrid;
+    using NodeRecord = SCMDeformableSoil::NodeRecord;
+    static int TileCoord(int i) { return NodeGrid::TileCoord(i); }
+};
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+using NodeGrid = SCMNodeGridTest::NodeGrid;
+using NodeRecord = SCMNodeGridTest::NodeRecord;
+
+static const int TILE_SIZE = NodeGrid::TILE_SIZE;
+
+// Create a node record with all fields set to values specific to the given node.
+static NodeRecord MakeRecord(const ChVector2<int>& ij) {
+    double s = ij.x() + 1000.0 * ij.y();
+    NodeRecord nr(0.5 + s, 0.25 + s, ChVector<>(0.1, 0.2, 1.0 + 1e-3 * s));
+    nr.hit_level = 2 + s;
+    nr.sinkage = 3 + s;
+    nr.sinkage_plastic = 4 + s;
+    nr.sinkage_elastic = 5 + s;
+    nr.sigma = 6 + s;
+    nr.sigma_yield = 7 + s;
+    nr.kshear = 8 + s;
+    nr.tau = 9 + s;
+    nr.erosion = true;
+    nr.massremainder = 10 + s;
+    nr.step_plastic_flow = 11 + s;
+    return nr;
+}
+
+// Check all fields of a node record against the record created for the given node.
+static void CheckRecord(const NodeRecord& nr, const ChVector2<int>& ij) {
+    NodeRecord ref = MakeRecord(ij);
+    ASSERT_EQ(nr.level_initial, ref.level_initial);
+    ASSERT_EQ(nr.level, ref.level);
+    ASSERT_EQ(nr.hit_level, ref.hit_level);
+    ASSERT_EQ(nr.normal, ref.normal);
+    ASSERT_EQ(nr.sinkage, ref.sinkage);
+    ASSERT_EQ(nr.sinkage_plastic, ref.sinkage_plastic);
+    ASSERT_EQ(nr.sinkage_elastic, ref.sinkage_elastic);
+    ASSERT_EQ(nr.sigma, ref.sigma);
+    ASSERT_EQ(nr.sigma_yield, ref.sigma_yield);
+    ASSERT_EQ(nr.kshear, ref.kshear);
+    ASSERT_EQ(nr.tau, ref.tau);
+    ASSERT_EQ(nr.erosion, ref.erosion);
+    ASSERT_EQ(nr.massremainder, ref.massremainder);
+    ASSERT_EQ(nr.step_plastic_flow, ref.step_plastic_flow);
+}
+
+// Check the fields of a node record restored from a compacted tile. The persistent fields must match the record
+// created for the given node; the quantities reset at each step must have their default values.
+static void CheckExpandedRecord(const NodeRecord& nr, const ChVector2<int>& ij) {
+    NodeRecord ref = MakeRecord(ij);
+    NodeRecord def;
+    ASSERT_EQ(nr.level_initial, ref.level_initial);
+    ASSERT_EQ(nr.level, ref.level);
+    ASSERT_EQ(nr.normal, ref.normal);
+    ASSERT_EQ(nr.sinkage, ref.sinkage);
+    ASSERT_EQ(nr.sinkage_plastic, ref.sinkage_plastic);
+    ASSERT_EQ(nr.sigma_yield, ref.sigma_yield);
+    ASSERT_EQ(nr.kshear, ref.kshear);
+    ASSERT_EQ(nr.massremainder, ref.massremainder);
+    ASSERT_EQ(nr.hit_level, def.hit_level);
+    ASSERT_EQ(nr.sinkage_elastic, def.sinkage_elastic);
+    ASSERT_EQ(nr.sigma, def.sigma);
+    ASSERT_EQ(nr.tau, def.tau);
+    ASSERT_EQ(nr.erosion, def.erosion);
+    ASSERT_EQ(nr.step_plastic_flow, def.step_plastic_flow);
+}
+
+// Irregular set of nodes in the tile with given tile coordinates, spanning all mask words of the tile.
+static std::vector<ChVector2<int>> TileNodes(int ti, int tj) {
+    std::vector<ChVector2<int>> nodes;
+    for (int k = 0; k < NodeGrid::TILE_NODES; k++) {
+        if ((k * 7) % 5 == 0 || k % 64 == 63)
+            nodes.push_back(ChVector2<int>(ti * TILE_SIZE + k % TILE_SIZE, tj * TILE_SIZE + k / TILE_SIZE));
+    }
+    return nodes;
+}
+
+TEST(SCMNodeGrid, tile_coord) {
+    ASSERT_EQ(SCMNodeGridTest::TileCoord(0), 0);
+    ASSERT_EQ(SCMNodeGridTest::TileCoord(TILE_SIZE - 1), 0);
+    ASSERT_EQ(SCMNodeGridTest::TileCoord(TILE_SIZE), 1);
+    ASSERT_EQ(SCMNodeGridTest::TileCoord(-1), -1);
+    ASSERT_EQ(SCMNodeGridTest::TileCoord(-TILE_SIZE), -1);
+    ASSERT_EQ(SCMNodeGridTest::TileCoord(-TILE_SIZE - 1), -2);
+    for (int i = -3 * TILE_SIZE; i <= 3 * TILE_SIZE; i++) {
+        int t = SCMNodeGridTest::TileCoord(i);
+        ASSERT_LE(t * TILE_SIZE, i);
+        ASSERT_GT((t + 1) * TILE_SIZE, i);
+    }
+}
+
+TEST(SCMNodeGrid, insert_find) {
+    NodeGrid grid;
+    grid.Reset(100, 100);
+
+    // Nodes on both sides of tile boundaries (including negative coordinates) and in far tiles
+    std::vector<ChVector2<int>> nodes = {
+        {0, 0},        {TILE_SIZE - 1, 0},   {TILE_SIZE, 0},      {-1, 0},       {0, -1},
+        {-1, -1},      {-TILE_SIZE, -1},     {-TILE_SIZE - 1, 5}, {100, -100},   {-100, 100},
+        {5000, 5000},  {-5000, 5000},        {-5000, -5001},      {101 + TILE_SIZE * 3, 0}};
+    for (const auto& ij : nodes) {
+        ASSERT_FALSE(grid.Contains(ij));
+        ASSERT_EQ(grid.Find(ij), nullptr);
+        grid.Insert(ij, MakeRecord(ij));
+    }
+    ASSERT_EQ(grid.GetNumNodes(), nodes.size());
+
+    // Inserting an existing node does not modify its record
+    grid.Insert(nodes[0], MakeRecord(ChVector2<int>(7, 7)));
+    ASSERT_EQ(grid.GetNumNodes(), nodes.size());
+
+    for (const auto& ij : nodes) {
+        ASSERT_TRUE(grid.Contains(ij));
+        NodeRecord* nr = grid.Find(ij);
+        ASSERT_NE(nr, nullptr);
+        CheckRecord(*nr, ij);
+        double level;
+        ASSERT_TRUE(grid.GetLevel(ij, level));
+        ASSERT_EQ(level, MakeRecord(ij).level);
+    }
+
+    // Neighbors of the recorded nodes have no records
+    for (const auto& ij : {ChVector2<int>(1, 0), ChVector2<int>(-2, 0), ChVector2<int>(TILE_SIZE + 1, 0),
+                           ChVector2<int>(5001, 5000), ChVector2<int>(-5000, -5000)}) {
+        ASSERT_FALSE(grid.Contains(ij));
+        ASSERT_EQ(grid.Find(ij), nullptr);
+        double level;
+        ASSERT_FALSE(grid.GetLevel(ij, level));
+    }
+
+    // One tile per distinct pair of tile coordinates
+    std::vector<std::pair<int, int>> tiles;
+    for (const auto& ij : nodes)
+        tiles.push_back({SCMNodeGridTest::TileCoord(ij.x()), SCMNodeGridTest::TileCoord(ij.y())});
+    std::sort(tiles.begin(), tiles.end());
+    tiles.erase(std::unique(tiles.begin(), tiles.end()), tiles.end());
+    ASSERT_EQ(grid.GetNumTiles(), tiles.size());
+
+    // All node levels are collected, at the proper grid coordinates
+    std::vector<std::pair<ChVector2<int>, double>> levels;
+    grid.GetLevels(levels);
+    ASSERT_EQ(levels.size(), nodes.size());
+    for (const auto& l : levels) {
+        ASSERT_NE(std::find(nodes.begin(), nodes.end(), l.first), nodes.end());
+        ASSERT_EQ(l.second, MakeRecord(l.first).level);
+    }
+
+    // Reset removes all records
+    grid.Reset(100, 100);
+    ASSERT_EQ(grid.GetNumNodes(), 0u);
+    ASSERT_EQ(grid.GetNumTiles(), 0u);
+    for (const auto& ij : nodes)
+        ASSERT_FALSE(grid.Contains(ij));
+}
+
+TEST(SCMNodeGrid, compact_expand) {
+    NodeGrid grid;
+    grid.Reset(2 * TILE_SIZE, 2 * TILE_SIZE);
+
+    // Two tiles in the directory range (one at negative coordinates) and one far tile
+    std::vector<std::vector<ChVector2<int>>> tiles = {TileNodes(0, 0), TileNodes(-2, -1), TileNodes(-40, 25)};
+    size_t num_nodes = 0;
+    for (const auto& tile : tiles) {
+        for (const auto& ij : tile)
+            grid.Insert(ij, MakeRecord(ij));
+        num_nodes += tile.size();
+    }
+    ASSERT_EQ(grid.GetNumNodes(), num_nodes);
+    ASSERT_EQ(grid.GetNumTiles(), 3u);
+    ASSERT_EQ(grid.GetNumCompactTiles(), 0u);
+
+    // No compaction if disabled or while tiles are not idle long enough
+    grid.Advance(false, 0);
+    ASSERT_EQ(grid.GetNumCompactTiles(), 0u);
+    grid.Advance(true, 5);
+    ASSERT_EQ(grid.GetNumCompactTiles(), 0u);
+
+    // Compact all tiles
+    grid.Advance(true, 0);
+    ASSERT_EQ(grid.GetNumCompactTiles(), 3u);
+    ASSERT_EQ(grid.GetNumNodes(), num_nodes);
+
+    // Levels and records of recorded nodes are read from the compacted tiles (without expanding them)
+    for (const auto& tile : tiles) {
+        for (const auto& ij : tile) {
+            ASSERT_TRUE(grid.Contains(ij));
+            double level;
+            ASSERT_TRUE(grid.GetLevel(ij, level));
+            ASSERT_EQ(level, MakeRecord(ij).level);
+        }
+    }
+    for (int k = 0; k < NodeGrid::TILE_NODES; k++) {
+        ChVector2<int> ij(k % TILE_SIZE, k / TILE_SIZE);
+        bool recorded = std::find(tiles[0].begin(), tiles[0].end(), ij) != tiles[0].end();
+        double level;
+        ASSERT_EQ(grid.GetLevel(ij, level), recorded);
+    }
+    std::vector<std::pair<ChVector2<int>, double>> levels;
+    grid.GetLevels(levels);
+    ASSERT_EQ(levels.size(), num_nodes);
+    for (const auto& l : levels)
+        ASSERT_EQ(l.second, MakeRecord(l.first).level);
+    ASSERT_EQ(grid.GetNumCompactTiles(), 3u);
+
+    // Accessing a tile expands it; all stored fields survive the round trip
+    for (size_t t = 0; t < tiles.size(); t++) {
+        for (const auto& ij : tiles[t]) {
+            NodeRecord* nr = grid.Find(ij);
+            ASSERT_NE(nr, nullptr);
+            CheckExpandedRecord(*nr, ij);
+        }
+        ASSERT_EQ(grid.GetNumCompactTiles(), tiles.size() - t - 1);
+    }
+
+    // Only tiles idle over the specified number of steps are compacted again
+    grid.Advance(true, 1);
+    ASSERT_EQ(grid.GetNumCompactTiles(), 0u);
+    grid.Find(tiles[1][0]);
+    grid.Advance(true, 1);
+    ASSERT_EQ(grid.GetNumCompactTiles(), 2u);
+
+    // Inserting in a compacted tile expands it and keeps the existing records
+    ChVector2<int> ij_new(1, 0);
+    ASSERT_FALSE(grid.Contains(ij_new));
+    grid.Insert(ij_new, MakeRecord(ij_new));
+    ASSERT_EQ(grid.GetNumCompactTiles(), 1u);
+    ASSERT_EQ(grid.GetNumNodes(), num_nodes + 1);
+    CheckRecord(*grid.Find(ij_new), ij_new);
+    for (const auto& ij : tiles[0])
+        CheckExpandedRecord(*grid.Find(ij), ij);
+
+    // A second round trip preserves the records as well
+    grid.Advance(true, 0);
+    ASSERT_EQ(grid.GetNumCompactTiles(), 3u);
+    for (const auto& tile : tiles) {
+        for (const auto& ij : tile)
+            CheckExpandedRecord(*grid.Find(ij), ij);
+    }
+    ASSERT_EQ(grid.GetNumCompactTiles(), 0u);
+}